@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+
+# Generates libchimara/unicode-tables.h, the case mapping and canonical
+# normalization tables used by libchimara/case.c. The data comes from the
+# Unicode database built into Python, so the tables follow whatever Unicode
+# version the running Python supports. Run it from the top source directory:
+#
+#   python3 build-aux/gen_unicode_tables.py > libchimara/unicode-tables.h
+
+import sys
+import unicodedata
+
+MAX_CODEPOINT = 0x110000
+SHIFT = 6
+BLOCK_SIZE = 1 << SHIFT
+
+# Hangul syllables are composed and decomposed algorithmically in case.c
+SBASE = 0xAC00
+SCOUNT = 11172
+
+
+def is_hangul_syllable(cp):
+    return SBASE <= cp < SBASE + SCOUNT
+
+
+def codepoints():
+    for cp in range(MAX_CODEPOINT):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        yield cp
+
+
+def two_stage(values, default):
+    """Split a dict of code point -> value into a two-stage lookup table.
+    Returns (limit, stage1, stage2): code points at or above limit all have
+    the default value."""
+    top = max(values) + 1 if values else 1
+    limit = (top + BLOCK_SIZE - 1) // BLOCK_SIZE * BLOCK_SIZE
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for base in range(0, limit, BLOCK_SIZE):
+        block = tuple(values.get(cp, default)
+                      for cp in range(base, base + BLOCK_SIZE))
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return limit, stage1, stage2
+
+
+def ctype(values):
+    top = max(values)
+    if top < 0x100:
+        return 'guint8'
+    if top < 0x10000:
+        return 'guint16'
+    return 'guint32'
+
+
+def emit_array(out, decl, values, fmt='{}', per_line=12):
+    out.append(decl + ' = {')
+    for ix in range(0, len(values), per_line):
+        chunk = values[ix:ix + per_line]
+        out.append('\t' + ', '.join(fmt.format(v) for v in chunk) + ',')
+    out.append('};')
+    out.append('')
+
+
+def emit_two_stage(out, prefix, values, default):
+    limit, stage1, stage2 = two_stage(values, default)
+    out.append('#define {}_LIMIT 0x{:X}'.format(prefix.upper(), limit))
+    out.append('')
+    emit_array(out, 'static const {} {}_stage1[]'.format(ctype(stage1), prefix),
+        stage1)
+    emit_array(out, 'static const {} {}_stage2[]'.format(ctype(stage2), prefix),
+        stage2)
+    return len(stage1) * (1 if ctype(stage1) == 'guint8' else 2) + \
+        len(stage2) * {'guint8': 1, 'guint16': 2, 'guint32': 4}[ctype(stage2)]
+
+
+def case_tables(out):
+    # Special (multi-character) mappings are stored in case_special as a length
+    # followed by the characters; offset 0 means "no special mapping".
+    special = [0]
+    special_index = {}
+    records = {}
+    record_list = []
+    record_of = {}
+    max_expansion = 1
+
+    def add_special(seq):
+        nonlocal max_expansion
+        key = tuple(seq)
+        if key not in special_index:
+            special_index[key] = len(special)
+            special.append(len(seq))
+            special.extend(seq)
+        max_expansion = max(max_expansion, len(seq))
+        return special_index[key]
+
+    for cp in codepoints():
+        ch = chr(cp)
+        # Order must match the CaseMode enum in case.c
+        mapped = (ch.upper(), ch.lower(), ch.title())
+        if all(m == ch for m in mapped):
+            continue
+        deltas = []
+        specials = []
+        for m in mapped:
+            if len(m) == 1:
+                deltas.append(ord(m) - cp)
+                specials.append(0)
+            else:
+                deltas.append(0)
+                specials.append(add_special([ord(c) for c in m]))
+        rec = tuple(deltas + specials)
+        if rec not in records:
+            records[rec] = len(record_list) + 1
+            record_list.append(rec)
+        record_of[cp] = records[rec]
+
+    out.append('/* Case mapping: a two-stage table gives the index of each '
+        'character\'s record in')
+    out.append(' * case_records. Record 0 is the identity mapping. */')
+    out.append('#define CASE_MAX_EXPANSION {}'.format(max_expansion))
+    size = emit_two_stage(out, 'case', record_of, 0)
+    out.append('static const CaseRecord case_records[] = {')
+    out.append('\t{ { 0, 0, 0 }, { 0, 0, 0 } },')
+    for rec in record_list:
+        out.append('\t{{ {{ {}, {}, {} }}, {{ {}, {}, {} }} }},'.format(*rec))
+    out.append('};')
+    out.append('')
+    emit_array(out, 'static const glui32 case_special[]', special,
+        fmt='0x{:04X}', per_line=8)
+    size += (len(record_list) + 1) * 20 + len(special) * 4
+    return size
+
+
+def decomposition(cp):
+    """Canonical decomposition of a single code point, not applied
+    recursively, or None."""
+    d = unicodedata.decomposition(chr(cp))
+    if not d or d.startswith('<'):
+        return None
+    return [int(x, 16) for x in d.split()]
+
+
+def normalization_tables(out):
+    ccc = {}
+    decomp_of = {}
+    decomp_data = [0]
+    decomp_index = {}
+    max_decomp = 1
+    pairs = []
+
+    for cp in codepoints():
+        ch = chr(cp)
+        cc = unicodedata.combining(ch)
+        if cc:
+            ccc[cp] = cc
+        if is_hangul_syllable(cp):
+            continue
+        full = unicodedata.normalize('NFD', ch)
+        if full != ch:
+            seq = tuple(ord(c) for c in full)
+            if seq not in decomp_index:
+                decomp_index[seq] = len(decomp_data)
+                decomp_data.append(len(seq))
+                decomp_data.extend(seq)
+            decomp_of[cp] = decomp_index[seq]
+            max_decomp = max(max_decomp, len(seq))
+        # Primary composites: characters with a two-character canonical
+        # decomposition that survive NFC, i.e. are not excluded from
+        # composition
+        d = decomposition(cp)
+        if d and len(d) == 2 and unicodedata.normalize('NFC', ch) == ch:
+            pairs.append((d[0], d[1], cp))
+
+    # Below these limits nothing decomposes, has a combining class or takes
+    # part in composition, so the normalization functions can skip them
+    nfd_quick = min(set(ccc) | set(decomp_of))
+    nfc_quick = min([cp for cp in decomp_of
+        if unicodedata.normalize('NFC', chr(cp)) != chr(cp)] +
+        [second for first, second, composite in pairs] + list(ccc))
+
+    pairs.sort()
+    out.append('/* Canonical normalization. norm_decomp gives the offset into '
+        'norm_decomp_data of')
+    out.append(' * each character\'s full canonical decomposition, stored as a '
+        'length followed')
+    out.append(' * by the characters; offset 0 means the character does not '
+        'decompose. Hangul')
+    out.append(' * syllables are handled algorithmically. */')
+    out.append('#define NFD_QUICK_LIMIT 0x{:04X}'.format(nfd_quick))
+    out.append('#define NFC_QUICK_LIMIT 0x{:04X}'.format(nfc_quick))
+    out.append('#define NORM_MAX_DECOMPOSITION {}'.format(max_decomp))
+    out.append('')
+    size = emit_two_stage(out, 'norm_ccc', ccc, 0)
+    size += emit_two_stage(out, 'norm_decomp', decomp_of, 0)
+    emit_array(out, 'static const glui32 norm_decomp_data[]', decomp_data,
+        fmt='0x{:04X}', per_line=8)
+    out.append('/* Primary composites, sorted by first and then second '
+        'character */')
+    out.append('static const CompositionPair norm_compositions[] = {')
+    for first, second, composite in pairs:
+        out.append('\t{{ 0x{:04X}, 0x{:04X}, 0x{:04X} }},'.format(first, second,
+            composite))
+    out.append('};')
+    out.append('')
+    size += len(decomp_data) * 4 + len(pairs) * 12
+    return size
+
+
+def main():
+    out = []
+    out.append('/* Generated by build-aux/gen_unicode_tables.py from Unicode {}. '
+        'Do not edit. */'.format(unicodedata.unidata_version))
+    out.append('')
+    out.append('#ifndef UNICODE_TABLES_H')
+    out.append('#define UNICODE_TABLES_H')
+    out.append('')
+    out.append('#define UNICODE_TABLES_SHIFT {}'.format(SHIFT))
+    out.append('#define UNICODE_TABLES_MASK 0x{:X}'.format(BLOCK_SIZE - 1))
+    out.append('')
+    size = case_tables(out)
+    size += normalization_tables(out)
+    out.append('#endif /* UNICODE_TABLES_H */')
+    print('\n'.join(out))
+    print('Table size: {} bytes'.format(size), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
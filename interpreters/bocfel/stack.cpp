@@ -86,15 +86,31 @@ static uint16_t pop_stack()
     return *--sp;
 }
 
+// Save states pushed onto a save stack (@save_undo and /ps) don’t
+// carry dynamic memory as a CMem/UMem chunk. Instead, memory is split
+// into fixed-size pages, and each page which is unchanged since the
+// most recent state on the same stack shares that state’s copy. This
+// avoids compressing all of dynamic memory against the story file on
+// every turn, and most pages are stored only once no matter how many
+// states refer to them. A full Quetzal image is only built if the state
+// has to be written to disk, i.e. as part of an autosave.
+static constexpr uint32_t SNAPSHOT_PAGE_SIZE = 256;
+
+using SnapshotPage = std::shared_ptr<const std::vector<uint8_t>>;
+
 struct SaveState {
 public:
     SaveType savetype;
+    // If “pages” is empty, this is a full Quetzal image; otherwise it
+    // contains every chunk apart from dynamic memory.
     std::vector<uint8_t> quetzal;
+    std::vector<SnapshotPage> pages;
     std::string desc;
 
-    SaveState(SaveType savetype_, const char *desc_, std::vector<uint8_t> quetzal_) :
+    SaveState(SaveType savetype_, const char *desc_, std::vector<uint8_t> quetzal_, std::vector<SnapshotPage> pages_ = {}) :
         savetype(savetype_),
         quetzal(std::move(quetzal_)),
+        pages(std::move(pages_)),
         desc(desc_ == nullptr ? format_time() : desc_)
     {
     }
@@ -140,7 +156,16 @@ struct SaveStack {
     // not enough saves available, remove all saves.
     void trim_saves(size_t n) {
         states.erase(states.begin(), n > states.size() ? states.end() : states.begin() + n);
-        states.shrink_to_fit();
+    }
+
+    // Pages of the most recent state, against which a new state is
+    // compared.
+    const std::vector<SnapshotPage> *latest_pages() const {
+        if (states.empty() || states.front().pages.empty()) {
+            return nullptr;
+        }
+
+        return &states.front().pages;
     }
 
     void clear() {
@@ -444,9 +469,9 @@ void zpush_stack()
     branch_if(true);
 }
 
-// Compress dynamic memory according to Quetzal. On failure,
-// std::bad_alloc is thrown.
-static std::vector<uint8_t> compress_memory()
+// Compress dynamic memory (either the current memory or a copy of it)
+// according to Quetzal. On failure, std::bad_alloc is thrown.
+static std::vector<uint8_t> compress_memory(const uint8_t *mem)
 {
     long i = 0;
     std::vector<uint8_t> compressed;
@@ -459,7 +484,7 @@ static std::vector<uint8_t> compress_memory()
         // Count zeroes. Stop counting when:
         // • The end of dynamic memory is reached, or
         // • A non-zero value is found
-        while (i < header.static_start && (byte(i) ^ dynamic_memory[i]) == 0) {
+        while (i < header.static_start && (mem[i] ^ dynamic_memory[i]) == 0) {
             i++;
         }
 
@@ -479,7 +504,7 @@ static std::vector<uint8_t> compress_memory()
         }
 
         // The current byte differs from the story, so write it.
-        compressed.push_back(byte(i) ^ dynamic_memory[i]);
+        compressed.push_back(mem[i] ^ dynamic_memory[i]);
 
         i++;
     }
@@ -516,6 +541,47 @@ static bool uncompress_memory(const uint8_t *compressed, uint32_t size)
     return true;
 }
 
+// Split dynamic memory into pages, sharing each page that is the same
+// as in “prev” (if any). On failure, std::bad_alloc is thrown.
+static std::vector<SnapshotPage> snapshot_memory(const std::vector<SnapshotPage> *prev)
+{
+    std::vector<SnapshotPage> pages;
+
+    pages.reserve((header.static_start + SNAPSHOT_PAGE_SIZE - 1) / SNAPSHOT_PAGE_SIZE);
+
+    for (uint32_t addr = 0; addr < header.static_start; addr += SNAPSHOT_PAGE_SIZE) {
+        uint32_t len = std::min<uint32_t>(SNAPSHOT_PAGE_SIZE, header.static_start - addr);
+        size_t i = pages.size();
+
+        if (prev != nullptr && i < prev->size() &&
+            (*prev)[i]->size() == len &&
+            std::memcmp((*prev)[i]->data(), &memory[addr], len) == 0) {
+
+            pages.push_back((*prev)[i]);
+        } else {
+            pages.push_back(std::make_shared<const std::vector<uint8_t>>(&memory[addr], &memory[addr + len]));
+        }
+    }
+
+    return pages;
+}
+
+// Reverse of the above function.
+static bool unsnapshot_memory(const std::vector<SnapshotPage> &pages)
+{
+    uint32_t addr = 0;
+
+    for (const auto &page : pages) {
+        if (addr + page->size() > header.static_start) {
+            return false;
+        }
+        std::memcpy(&memory[addr], page->data(), page->size());
+        addr += page->size();
+    }
+
+    return addr == header.static_start;
+}
+
 static IFF::TypeID write_ifhd(IO &savefile)
 {
     savefile.write16(header.release);
@@ -549,7 +615,7 @@ static IFF::TypeID write_mem(IO &savefile)
     IFF::TypeID type = IFF::TypeID(&"UMem");
 
     try {
-        compressed = compress_memory();
+        compressed = compress_memory(memory);
         // It is possible for the compressed memory size to be larger than
         // uncompressed; in this case, don’t use compressed memory.
         if (compressed.size() < header.static_start) {
@@ -628,6 +694,50 @@ static IFF::TypeID write_args(IO &savefile, SaveOpcode saveopcode)
     return IFF::TypeID(&"Args");
 }
 
+// Build a full Quetzal image for the specified save state, adding a
+// memory chunk to it if its memory is stored in pages.
+static std::vector<uint8_t> state_quetzal(const SaveState &state)
+{
+    if (state.pages.empty()) {
+        return state.quetzal;
+    }
+
+    std::vector<uint8_t> mem;
+    mem.reserve(header.static_start);
+    for (const auto &page : state.pages) {
+        mem.insert(mem.end(), page->begin(), page->end());
+    }
+
+    std::vector<uint8_t> compressed = compress_memory(mem.data());
+    IFF::TypeID type = IFF::TypeID(&"CMem");
+    if (compressed.size() >= header.static_start) {
+        compressed = std::move(mem);
+        type = IFF::TypeID(&"UMem");
+    }
+
+    // The memory chunk goes at the end of the FORM, which is not
+    // necessarily the end of the buffer.
+    uint32_t form_size = (static_cast<uint32_t>(state.quetzal[4]) << 24) |
+                         (static_cast<uint32_t>(state.quetzal[5]) << 16) |
+                         (static_cast<uint32_t>(state.quetzal[6]) <<  8) |
+                         (static_cast<uint32_t>(state.quetzal[7]) <<  0);
+    IO io(std::vector<uint8_t>(state.quetzal.begin(), state.quetzal.begin() + 8 + form_size), IO::Mode::WriteOnly);
+    io.seek(0, IO::SeekFrom::End);
+    io.write32(type.val());
+    io.write32(compressed.size());
+    if (!compressed.empty()) {
+        io.write_exact(compressed.data(), compressed.size());
+    }
+    if ((compressed.size() & 1) == 1) {
+        io.write8(0); // padding
+    }
+    long file_size = io.tell();
+    io.seek(4, IO::SeekFrom::Start);
+    io.write32(file_size - 8);
+
+    return io.get_memory();
+}
+
 static void write_undo_msav(IO &savefile, SaveStackType type)
 {
     SaveStack &s = save_stacks[type];
@@ -647,8 +757,9 @@ static void write_undo_msav(IO &savefile, SaveStackType type)
             }
         }
 
-        savefile.write32(state->quetzal.size());
-        savefile.write_exact(state->quetzal.data(), state->quetzal.size());
+        std::vector<uint8_t> quetzal = state_quetzal(*state);
+        savefile.write32(quetzal.size());
+        savefile.write_exact(quetzal.data(), quetzal.size());
     }
 }
 
@@ -696,7 +807,10 @@ static void write_chunk(IO &io, IFF::TypeID (*writefunc)(IO &savefile, Types...
 // BFZS instead of IFZS to prevent the files from being used by a normal
 // @restore (as they are not compatible). See `Quetzal.md` for a
 // description of how BFZS differs from IFZS.
-static bool save_quetzal(IO &savefile, SaveType savetype, SaveOpcode saveopcode, bool on_save_stack)
+//
+// If “write_memory” is false, dynamic memory is not written; the caller
+// is expected to store it some other way (see SaveState).
+static bool save_quetzal(IO &savefile, SaveType savetype, SaveOpcode saveopcode, bool on_save_stack, bool write_memory = true)
 {
     try {
         long file_size;
@@ -708,7 +822,9 @@ static bool save_quetzal(IO &savefile, SaveType savetype, SaveOpcode saveopcode,
 
         write_chunk(savefile, write_ifhd);
         write_chunk(savefile, write_intd);
-        write_chunk(savefile, write_mem);
+        if (write_memory) {
+            write_chunk(savefile, write_mem);
+        }
         write_chunk(savefile, write_stks);
         write_chunk(savefile, write_anno);
         write_chunk(savefile, meta_write_bfnt);
@@ -752,11 +868,15 @@ static bool save_quetzal(IO &savefile, SaveType savetype, SaveOpcode saveopcode,
     }
 }
 
-static void read_mem(IFF &iff)
+static void read_mem(IFF &iff, const std::vector<SnapshotPage> *pages)
 {
     uint32_t size;
 
-    if (iff.find(IFF::TypeID(&"CMem"), size)) {
+    if (pages != nullptr && !pages->empty()) {
+        if (!unsnapshot_memory(*pages)) {
+            throw RestoreError("memory size mismatch");
+        }
+    } else if (iff.find(IFF::TypeID(&"CMem"), size)) {
         std::vector<uint8_t> buf;
 
         // Dynamic memory is 64KB, and a worst-case save should take up
@@ -1061,7 +1181,9 @@ static bool instruction_has_stack_argument(uint32_t addr)
     return false;
 }
 
-static bool restore_quetzal(std::shared_ptr<IO> savefile, SaveType savetype, SaveOpcode &saveopcode)
+// If “pages” is non-null and not empty, dynamic memory is restored from
+// it instead of from the save file (see SaveState).
+static bool restore_quetzal(std::shared_ptr<IO> savefile, SaveType savetype, SaveOpcode &saveopcode, const std::vector<SnapshotPage> *pages = nullptr)
 {
     std::unique_ptr<IFF> iff;
     uint32_t size;
@@ -1132,7 +1254,7 @@ static bool restore_quetzal(std::shared_ptr<IO> savefile, SaveType savetype, Sav
 
         stash.backup();
 
-        read_mem(*iff);
+        read_mem(*iff, pages);
         read_stks(*iff);
 
         if (iff->find(IFF::TypeID(&"Bfnt"), size)) {
@@ -1326,11 +1448,11 @@ SaveResult push_save(SaveStackType type, SaveType savetype, SaveOpcode saveopcod
     try {
         IO savefile(std::vector<uint8_t>(), IO::Mode::WriteOnly);
 
-        if (!save_quetzal(savefile, savetype, saveopcode, false)) {
+        if (!save_quetzal(savefile, savetype, saveopcode, false, false)) {
             return SaveResult::Failure;
         }
 
-        SaveState newstate(savetype, desc, savefile.get_memory());
+        SaveState newstate(savetype, desc, savefile.get_memory(), snapshot_memory(s.latest_pages()));
         s.push(std::move(newstate));
 
         return SaveResult::Success;
@@ -1368,7 +1490,7 @@ bool pop_save(SaveStackType type, size_t saveno, SaveOpcode &saveopcode)
         return false;
     }
 
-    if (!restore_quetzal(savefile, p.savetype, saveopcode)) {
+    if (!restore_quetzal(savefile, p.savetype, saveopcode, &p.pages)) {
         return false;
     }
 
@@ -63,12 +63,21 @@ static size_t blorb_len = 0;
  * This undo mechanism is based on the scheme used in Evin Robertson's
  * Nitfol interpreter.
  * Undo blocks are stored as differences between states.
+ *
+ * The blocks live contiguously in a single ring buffer of undo_ring_size
+ * bytes, allocated once in init_undo. New blocks are appended at
+ * undo_head; the oldest block sits at undo_tail and is dropped by
+ * advancing undo_tail past it. A block that does not fit in the space
+ * left at the end of the buffer is placed at offset 0 instead, and
+ * undo_wrap remembers where the valid data at the end stops.
+ * Blocks refer to each other by their offset in the buffer; -1 is used
+ * as the null offset.
  */
 
 typedef struct undo_struct undo_t;
 struct undo_struct {
-	undo_t *next;
-	undo_t *prev;
+	long prev;
+	long size;
 	long pc;
 	long diff_size;
 	zword frame_count;
@@ -77,8 +86,14 @@ struct undo_struct {
 	/* undo diff and stack data follow */
 };
 
-static undo_t *first_undo = NULL, *last_undo = NULL, *curr_undo = NULL;
+#define UNDO_ALIGN(n) (((n) + sizeof (long) - 1) / sizeof (long) * sizeof (long))
+#define UNDO_BLOCK(ofs) ((undo_t *) (undo_ring + (ofs)))
+
+static long first_undo = -1, last_undo = -1, curr_undo = -1;
 static zbyte *undo_mem = NULL, *prev_zmp, *undo_diff;
+static zbyte *undo_ring = NULL;
+static long undo_ring_size = 0;
+static long undo_head = 0, undo_tail = 0, undo_wrap = 0;
 
 static int undo_count = 0;
 
@@ -410,11 +425,16 @@ no_match: ; /* null statement */
  * all the memory available, since the IO interface may need memory
  * during the game, e.g. for loading sounds or pictures.
  *
+ * The undo blocks themselves get a ring buffer of option_undo_mem
+ * kilobytes, but never less than one worst-case block, so that at
+ * least one level of undo is always possible.
+ *
  */
 
 void init_undo (void)
 {
 	void *reserved;
+	long min_size;
 
 	reserved = NULL;	/* makes compilers shut up */
 
@@ -426,12 +446,27 @@ void init_undo (void)
 	/* Allocate h_dynamic_size bytes for previous dynamic zmp state
 	   + 1.5 h_dynamic_size for Quetzal diff + 2. */
 	undo_mem = malloc ((h_dynamic_size * 5) / 2 + 2);
-	if (undo_mem != NULL) {
+
+	min_size = UNDO_ALIGN (sizeof (undo_t) + (h_dynamic_size * 3) / 2 + 2
+			+ STACK_SIZE * sizeof (*sp));
+	undo_ring_size = UNDO_ALIGN (option_undo_mem * 1024L);
+	if (undo_ring_size < min_size)
+		undo_ring_size = min_size;
+	if (undo_mem != NULL)
+		undo_ring = malloc (undo_ring_size);
+
+	if (undo_mem != NULL && undo_ring != NULL) {
 		prev_zmp = undo_mem;
 		undo_diff = undo_mem + h_dynamic_size;
 		memcpy (prev_zmp, zmp, h_dynamic_size);
-	} else
+		undo_head = undo_tail = 0;
+		undo_wrap = undo_ring_size;
+	} else {
+		free (undo_mem);
+		undo_mem = NULL;
+		undo_ring_size = 0;
 		option_undo_slots = 0;
+	}
 
 	if (reserve_mem != 0)
 		free (reserved);
@@ -441,7 +476,8 @@ void init_undo (void)
 /*
  * free_undo
  *
- * Free count undo blocks from the beginning of the undo list.
+ * Free count undo blocks from the beginning of the undo list. This only
+ * advances the tail of the ring buffer.
  *
  */
 
@@ -452,19 +488,72 @@ static void free_undo (int count)
 	if (count > undo_count)
 		count = undo_count;
 	while (count--) {
-		p = first_undo;
+		p = UNDO_BLOCK (first_undo);
 		if (curr_undo == first_undo)
-			curr_undo = curr_undo->next;
-		first_undo = first_undo->next;
-		free (p);
+			curr_undo = -1;
+		undo_tail = first_undo + p->size;
 		undo_count--;
+		if (undo_count == 0)
+			break;
+		if (undo_tail == undo_wrap) {
+			undo_tail = 0;
+			undo_wrap = undo_ring_size;
+		}
+		first_undo = undo_tail;
+		UNDO_BLOCK (first_undo)->prev = -1;
+	}
+	if (undo_count == 0) {
+		first_undo = last_undo = curr_undo = -1;
+		undo_head = undo_tail = 0;
+		undo_wrap = undo_ring_size;
 	}
-	if (first_undo)
-		first_undo->prev = NULL;
-	else
-		last_undo = NULL;
 }/* free_undo */
 
+/*
+ * alloc_undo
+ *
+ * Find room for an undo block of the given size at the head of the
+ * ring buffer, dropping the oldest blocks until it fits. Returns the
+ * offset of the new block, or -1 if it is larger than the whole buffer.
+ *
+ */
+
+static long alloc_undo (long size)
+{
+	long ofs;
+
+	if (size > undo_ring_size)
+		return -1;
+
+	for (;;) {
+		if (undo_count == 0) {
+			ofs = 0;
+			break;
+		}
+		if (undo_head > undo_tail) {
+			/* Live blocks occupy [undo_tail, undo_head) */
+			if (undo_head + size <= undo_ring_size) {
+				ofs = undo_head;
+				break;
+			}
+			if (size <= undo_tail) {
+				undo_wrap = undo_head;
+				ofs = 0;
+				break;
+			}
+		} else if (undo_head + size <= undo_tail) {
+			/* Live blocks occupy [undo_tail, undo_wrap) and [0, undo_head) */
+			ofs = undo_head;
+			break;
+		}
+		free_undo (1);
+	}
+
+	undo_head = ofs + size;
+	return ofs;
+
+}/* alloc_undo */
+
 /*
  * reset_memory
  *
@@ -483,11 +572,16 @@ void reset_memory (void)
 	if (undo_mem) {
 		free_undo (undo_count);
 		free (undo_mem);
+		free (undo_ring);
 	}
 
 	undo_mem = NULL;
+	undo_ring = NULL;
+	undo_ring_size = 0;
 	undo_count = 0;
 
+	reset_dictionaries ();
+
 	if (zmp)
 		free (zmp);
 	zmp = NULL;
@@ -523,6 +617,9 @@ void storeb (zword addr, zbyte value)
 
 	}
 
+	if (addr < dict_dynamic_high && addr >= dict_dynamic_low)
+		invalidate_dictionaries ();
+
 	SET_BYTE (addr, value);
 
 }/* storeb */
@@ -568,6 +665,7 @@ void z_restart (void)
 
 	} else first_restart = FALSE;
 
+	invalidate_dictionaries ();
 	restart_header ();
 	restart_screen ();
 
@@ -720,6 +818,8 @@ void z_restore (void)
 
 finished:
 
+	invalidate_dictionaries ();
+
 	if (h_version <= V3)
 		branch (success);
 	else
@@ -817,28 +917,31 @@ static void mem_undiff (zbyte *diff, long diff_length, zbyte *dest)
 
 int restore_undo (void)
 {
+	undo_t *p;
 
 	if (option_undo_slots == 0)	/* undo feature unavailable */
 
 		return -1;
 
-	if (curr_undo == NULL)		/* no saved game state */
+	if (curr_undo == -1)		/* no saved game state */
 
 		return 0;
 
 	/* undo possible */
 
+	p = UNDO_BLOCK (curr_undo);
 	memcpy (zmp, prev_zmp, h_dynamic_size);
-	SET_PC (curr_undo->pc);
-	sp = stack + STACK_SIZE - curr_undo->stack_size;
-	fp = stack + curr_undo->frame_offset;
-	frame_count = curr_undo->frame_count;
-	mem_undiff ((zbyte *) (curr_undo + 1), curr_undo->diff_size, prev_zmp);
-	memcpy (sp, (zbyte *)(curr_undo + 1) + curr_undo->diff_size,
-			curr_undo->stack_size * sizeof (*sp));
+	SET_PC (p->pc);
+	sp = stack + STACK_SIZE - p->stack_size;
+	fp = stack + p->frame_offset;
+	frame_count = p->frame_count;
+	mem_undiff ((zbyte *) (p + 1), p->diff_size, prev_zmp);
+	memcpy (sp, (zbyte *)(p + 1) + p->diff_size,
+			p->stack_size * sizeof (*sp));
 
-	curr_undo = curr_undo->prev;
+	curr_undo = p->prev;
 
+	invalidate_dictionaries ();
 	restart_header ();
 
 	return 2;
@@ -956,6 +1059,8 @@ void z_save (void)
 
 finished:
 
+	invalidate_dictionaries ();
+
 	if (h_version <= V3)
 		branch (success);
 	else
@@ -974,6 +1079,7 @@ int save_undo (void)
 {
 	long diff_size;
 	zword stack_size;
+	long ofs;
 	undo_t *p;
 
 	if (option_undo_slots == 0)	/* undo feature unavailable */
@@ -981,29 +1087,28 @@ int save_undo (void)
 
 	/* save undo possible */
 
-	while (last_undo != curr_undo) {
-		p = last_undo;
-		last_undo = last_undo->prev;
-		free (p);
-		undo_count--;
+	/* Discard the blocks past curr_undo, they can no longer be redone */
+	if (curr_undo == -1)
+		free_undo (undo_count);
+	else if (last_undo != curr_undo) {
+		for (ofs = last_undo; ofs != curr_undo; ofs = UNDO_BLOCK (ofs)->prev)
+			undo_count--;
+		undo_head = curr_undo + UNDO_BLOCK (curr_undo)->size;
+		if (curr_undo >= undo_tail)
+			undo_wrap = undo_ring_size;
+		last_undo = curr_undo;
 	}
-	if (last_undo)
-		last_undo->next = NULL;
-	else
-		first_undo = NULL;
 
 	if (undo_count == option_undo_slots)
 		free_undo (1);
 
 	diff_size = mem_diff (zmp, prev_zmp, h_dynamic_size, undo_diff);
 	stack_size = stack + STACK_SIZE - sp;
-	do {
-		p = malloc (sizeof (undo_t) + diff_size + stack_size * sizeof (*sp));
-		if (p == NULL)
-			free_undo (1);
-	} while (!p && undo_count);
-	if (p == NULL)
+	ofs = alloc_undo (UNDO_ALIGN (sizeof (undo_t) + diff_size + stack_size * sizeof (*sp)));
+	if (ofs == -1)
 		return -1;
+	p = UNDO_BLOCK (ofs);
+	p->size = undo_head - ofs;
 	GET_PC (p->pc)
 		p->frame_count = frame_count;
 	p->diff_size = diff_size;
@@ -1012,15 +1117,12 @@ int save_undo (void)
 	memcpy (p + 1, undo_diff, diff_size);
 	memcpy ((zbyte *)(p + 1) + diff_size, sp, stack_size * sizeof (*sp));
 
-	if (!first_undo) {
-		p->prev = NULL;
-		first_undo = p;
-	} else {
-		last_undo->next = p;
+	if (undo_count == 0) {
+		p->prev = -1;
+		first_undo = ofs;
+	} else
 		p->prev = last_undo;
-	}
-	p->next = NULL;
-	curr_undo = last_undo = p;
+	curr_undo = last_undo = ofs;
 	undo_count++;
 	return 1;
 
@@ -50,6 +50,9 @@ enum story
 #ifndef MAX_UNDO_SLOTS
 #define MAX_UNDO_SLOTS 500
 #endif
+#ifndef UNDO_MEM_KB
+#define UNDO_MEM_KB 1024
+#endif
 #ifndef MAX_FILE_NAME
 #define MAX_FILE_NAME 256
 #endif
@@ -402,6 +405,7 @@ extern int option_right_margin;
 extern int option_ignore_errors;
 extern int option_piracy;
 extern int option_undo_slots;
+extern long option_undo_mem;
 extern int option_expand_abbreviations;
 extern int option_script_cols;
 extern int option_save_quetzal;
@@ -612,6 +616,9 @@ void 	branch (bool);
 void	storeb (zword, zbyte);
 void	storew (zword, zword);
 
+void	invalidate_dictionaries (void);
+void	reset_dictionaries (void);
+
 /*** Interface functions ***/
 
 void 	os_beep (int);
@@ -681,3 +688,6 @@ extern void (*var_opcodes[]) (void);
 
 extern zchar* decoded;
 extern zchar* encoded;
+
+extern zword dict_dynamic_low;
+extern zword dict_dynamic_high;
@@ -56,6 +56,7 @@ schanid_t gos_channel = NULL;
 "    -S # transscript width\n"\
 "    -t   set Tandy bit\n"\
 "    -u # slots for multiple undo\n"\
+"    -U # kilobytes of memory for multiple undo\n"\
 "    -x   expand abbreviations g/x/z\n"
 
 /* A unix-like getopt, but with the names changed to avoid any problems.  */
@@ -119,7 +120,7 @@ void os_process_arguments(int argc, char *argv[])
 
 	/* Parse the options */
 	do {
-		c = zgetopt(argc, argv, "aAioOPQs:S:tu:xZ:");
+		c = zgetopt(argc, argv, "aAioOPQs:S:tu:U:xZ:");
 		switch (c)
 		{
 			case 'a': option_attribute_assignment = 1; break;
@@ -133,6 +134,7 @@ void os_process_arguments(int argc, char *argv[])
 			case 'S': option_script_cols = atoi(zoptarg); break;
 			case 't': user_tandy_bit = 1; break;
 			case 'u': option_undo_slots = atoi(zoptarg); break;
+			case 'U': option_undo_mem = atol(zoptarg); break;
 			case 'x': option_expand_abbreviations = 1; break;
 			case 'Z': option_err_report_mode = atoi(zoptarg);
 					  if ((option_err_report_mode < ERR_REPORT_NEVER) ||
@@ -343,6 +345,7 @@ void os_init_setup(void)
 	option_ignore_errors = 0;
 	option_piracy = 0;
 	option_undo_slots = MAX_UNDO_SLOTS;
+	option_undo_mem = UNDO_MEM_KB;
 	option_expand_abbreviations = 0;
 	option_script_cols = 80;
 	option_save_quetzal = 1;
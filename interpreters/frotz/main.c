@@ -135,6 +135,7 @@ int option_right_margin = 0;
 int option_ignore_errors = 0;
 int option_piracy = 0;
 int option_undo_slots = MAX_UNDO_SLOTS;
+long option_undo_mem = UNDO_MEM_KB;
 int option_expand_abbreviations = 0;
 int option_script_cols = 80;
 int option_save_quetzal = 1;
@@ -61,6 +61,8 @@ void init_text (void)
     encoded = NULL;
 
     resolution = 0;
+
+    reset_dictionaries ();
 }
 
 /*
@@ -912,99 +914,358 @@ void z_print_unicode (void)
 }/* z_print_unicode */
 
 /*
- * lookup_text
+ * Dictionary index
  *
- * Scan a dictionary searching for the given word. The first argument
- * can be
+ * The entries of each dictionary the game uses are read into memory
+ * once, together with a hash table for exact lookups and an array of
+ * entry numbers sorted by encoded word for prefix searches. This saves
+ * re-reading the dictionary header and comparing encoded words through
+ * the memory macros for every word typed. Indexes of dictionaries in
+ * dynamic memory are thrown away whenever that memory is written.
  *
- * 0x00 - find the first word which is >= the given one
- * 0x05 - find the word which exactly matches the given one
- * 0x1f - find the last word which is <= the given one
+ */
+
+#define DICT_CACHE_SIZE 4
+
+typedef struct {
+    zword dct;			/* address of the dictionary, 0 if unused */
+    zword entries;		/* address of the first entry */
+    zword end;			/* address past the last entry */
+    zbyte entry_len;
+    int count;
+    zword *keys;		/* encoded words, resolution per entry */
+    zword *order;		/* entry numbers sorted by encoded word */
+    zword *hash;		/* entry number + 1, or 0 for an empty slot */
+    unsigned hash_mask;
+} dict_index_t;
+
+static dict_index_t dict_cache[DICT_CACHE_SIZE];
+static int dict_cache_next = 0;
+
+/* Range of dynamic memory covered by indexed dictionaries */
+zword dict_dynamic_low = 0;
+zword dict_dynamic_high = 0;
+
+static const zword *sort_keys;
+
+#define DICT_KEY(d, n) ((d)->keys + (n) * resolution)
+
+/*
+ * compare_key
  *
- * The return value is 0 if the search fails.
+ * Compare two encoded words, returning <0, 0 or >0.
  *
  */
 
-static zword lookup_text (int padding, zword dct)
+static int compare_key (const zword *a, const zword *b)
 {
-    zword entry_addr;
-    zword entry_count;
-    zword entry;
+    int i;
+
+    for (i = 0; i < resolution; i++)
+	if (a[i] != b[i])
+	    return (a[i] > b[i]) ? 1 : -1;
+
+    return 0;
+
+}/* compare_key */
+
+static int compare_entries (const void *a, const void *b)
+{
+    zword n1 = *(const zword *) a;
+    zword n2 = *(const zword *) b;
+    int result = compare_key (sort_keys + n1 * resolution, sort_keys + n2 * resolution);
+
+    /* Keep equal words in dictionary order */
+
+    return (result != 0) ? result : (int) n1 - (int) n2;
+
+}/* compare_entries */
+
+static unsigned hash_key (const zword *key)
+{
+    unsigned h = 0;
+    int i;
+
+    for (i = 0; i < resolution; i++)
+	h = h * 31 + key[i];
+
+    return h ^ (h >> 7);
+
+}/* hash_key */
+
+static void free_dictionary (dict_index_t *d)
+{
+    free (d->keys);
+    free (d->order);
+    free (d->hash);
+    memset (d, 0, sizeof (*d));
+
+}/* free_dictionary */
+
+static void update_dynamic_range (void)
+{
+    int i;
+
+    dict_dynamic_low = dict_dynamic_high = 0;
+
+    for (i = 0; i < DICT_CACHE_SIZE; i++) {
+
+	dict_index_t *d = &dict_cache[i];
+
+	if (d->dct == 0 || d->dct >= h_dynamic_size)
+	    continue;
+
+	if (dict_dynamic_high == 0 || d->dct < dict_dynamic_low)
+	    dict_dynamic_low = d->dct;
+	if (d->end > dict_dynamic_high)
+	    dict_dynamic_high = d->end;
+
+    }
+
+}/* update_dynamic_range */
+
+/*
+ * invalidate_dictionaries
+ *
+ * Forget the indexes of all dictionaries in dynamic memory. Called
+ * when the game writes to a dictionary, and after memory has been
+ * reloaded by restart, restore or undo.
+ *
+ */
+
+void invalidate_dictionaries (void)
+{
+    int i;
+
+    for (i = 0; i < DICT_CACHE_SIZE; i++)
+	if (dict_cache[i].dct != 0 && dict_cache[i].dct < h_dynamic_size)
+	    free_dictionary (&dict_cache[i]);
+
+    dict_dynamic_low = dict_dynamic_high = 0;
+
+}/* invalidate_dictionaries */
+
+/*
+ * reset_dictionaries
+ *
+ * Forget all dictionary indexes.
+ *
+ */
+
+void reset_dictionaries (void)
+{
+    int i;
+
+    for (i = 0; i < DICT_CACHE_SIZE; i++)
+	free_dictionary (&dict_cache[i]);
+
+    dict_cache_next = 0;
+    dict_dynamic_low = dict_dynamic_high = 0;
+
+}/* reset_dictionaries */
+
+/*
+ * get_dictionary
+ *
+ * Return the index for the dictionary at the given address, building
+ * it if necessary.
+ *
+ */
+
+static dict_index_t *get_dictionary (zword dct)
+{
+    dict_index_t *d;
     zword addr;
-    zbyte entry_len;
+    zword entry_count;
     zbyte sep_count;
-    int entry_number;
-    int lower, upper;
-    int i;
-    bool sorted;
+    unsigned hash_size;
+    int i, n;
 
-    if (resolution == 0) find_resolution();
+    for (i = 0; i < DICT_CACHE_SIZE; i++)
+	if (dict_cache[i].dct == dct)
+	    return &dict_cache[i];
 
-    encode_text (padding);
+    d = &dict_cache[dict_cache_next];
+    dict_cache_next = (dict_cache_next + 1) % DICT_CACHE_SIZE;
+    free_dictionary (d);
 
-    LOW_BYTE (dct, sep_count)		/* skip word separators */
-    dct += 1 + sep_count;
-    LOW_BYTE (dct, entry_len)		/* get length of entries */
-    dct += 1;
-    LOW_WORD (dct, entry_count)		/* get number of entries */
-    dct += 2;
+    addr = dct;
+    LOW_BYTE (addr, sep_count)		/* skip word separators */
+    addr += 1 + sep_count;
+    LOW_BYTE (addr, d->entry_len)	/* get length of entries */
+    addr += 1;
+    LOW_WORD (addr, entry_count)	/* get number of entries */
+    addr += 2;
 
-    if ((short) entry_count < 0) {	/* bad luck, entries aren't sorted */
+    /* A negative count means the entries aren't sorted, which makes
+       no difference here since the index is sorted anyway */
 
+    if ((short) entry_count < 0)
 	entry_count = - (short) entry_count;
-	sorted = FALSE;
 
-    } else sorted = TRUE;		/* entries are sorted */
+    d->entries = addr;
+    d->count = entry_count;
+    d->end = (zword) (addr + d->count * d->entry_len);
 
-    lower = 0;
-    upper = entry_count - 1;
+    for (hash_size = 1; hash_size < 2 * (unsigned) d->count; hash_size <<= 1)
+	;
+    d->hash_mask = hash_size - 1;
 
-    while (lower <= upper) {
+    d->keys = (zword *) malloc (sizeof (zword) * resolution * (d->count + 1));
+    d->order = (zword *) malloc (sizeof (zword) * (d->count + 1));
+    d->hash = (zword *) calloc (hash_size, sizeof (zword));
 
-	if (sorted)                             /* binary search */
-	    entry_number = (lower + upper) / 2;
-	else                                    /* linear search */
-	    entry_number = lower;
+    if (d->keys == NULL || d->order == NULL || d->hash == NULL)
+	os_fatal ("Out of memory");
 
-	entry_addr = dct + entry_number * entry_len;
+    for (n = 0; n < d->count; n++) {
 
-	/* Compare word to dictionary entry */
+	zword *key = DICT_KEY (d, n);
+	unsigned slot;
 
-	addr = entry_addr;
+	addr = d->entries + n * d->entry_len;
 
 	for (i = 0; i < resolution; i++) {
-	    LOW_WORD (addr, entry)
-	    if (encoded[i] != entry)
-		goto continuing;
+	    LOW_WORD (addr, key[i])
 	    addr += 2;
 	}
 
-	return entry_addr;		/* exact match found, return now */
+	d->order[n] = n;
+
+	/* If a word appears twice, the first entry wins */
+
+	for (slot = hash_key (key) & d->hash_mask; d->hash[slot] != 0; slot = (slot + 1) & d->hash_mask)
+	    if (compare_key (key, DICT_KEY (d, d->hash[slot] - 1)) == 0)
+		break;
+
+	if (d->hash[slot] == 0)
+	    d->hash[slot] = n + 1;
+
+    }
+
+    sort_keys = d->keys;
+    qsort (d->order, d->count, sizeof (zword), compare_entries);
+
+    d->dct = dct;
+
+    if (dct < h_dynamic_size)
+	update_dynamic_range ();
+
+    return d;
+
+}/* get_dictionary */
+
+/*
+ * search_dictionary
+ *
+ * Search a dictionary index for the encoded word in the global
+ * "encoded" array. The first argument can be
+ *
+ * 0x00 - find the first word which is >= the given one
+ * 0x05 - find the word which exactly matches the given one
+ * 0x1f - find the last word which is <= the given one
+ *
+ * The return value is a position in the sorted order of entries (or,
+ * for 0x05, an entry number), or -1 if the search fails.
+ *
+ */
+
+static int search_dictionary (dict_index_t *d, int padding)
+{
+    zword key[3];
+    zword *word = key;
+    int lower, upper;
+    int i;
+
+    if (resolution > 3)
+	word = (zword *) malloc (sizeof (zword) * resolution);
+
+    for (i = 0; i < resolution; i++)
+	word[i] = (zword) encoded[i];
+
+    if (padding == 0x05) {
+
+	unsigned slot;
+	int result = -1;
+
+	for (slot = hash_key (word) & d->hash_mask; d->hash[slot] != 0; slot = (slot + 1) & d->hash_mask)
+	    if (compare_key (word, DICT_KEY (d, d->hash[slot] - 1)) == 0) {
+		result = d->hash[slot] - 1;
+		break;
+	    }
+
+	if (word != key)
+	    free (word);
+
+	return result;
+
+    }
 
-    continuing:
+    lower = 0;
+    upper = d->count - 1;
 
-	if (sorted)				/* binary search */
+    while (lower <= upper) {
 
-	    if (encoded[i] > entry)
-		lower = entry_number + 1;
-	    else
-		upper = entry_number - 1;
+	int pos = (lower + upper) / 2;
+	int result = compare_key (word, DICT_KEY (d, d->order[pos]));
+
+	if (result == 0) {
+	    lower = upper = pos;
+	    break;
+	}
 
-	else lower++;                           /* linear search */
+	if (result > 0)
+	    lower = pos + 1;
+	else
+	    upper = pos - 1;
 
     }
 
-    /* No exact match has been found */
+    if (word != key)
+	free (word);
 
-    if (padding == 0x05)
-	return 0;
+    i = (padding == 0x00) ? lower : upper;
+
+    if (i == -1 || i == d->count)
+	return -1;
+
+    return i;
+
+}/* search_dictionary */
+
+/*
+ * lookup_text
+ *
+ * Scan a dictionary searching for the given word. The first argument
+ * can be
+ *
+ * 0x00 - find the first word which is >= the given one
+ * 0x05 - find the word which exactly matches the given one
+ * 0x1f - find the last word which is <= the given one
+ *
+ * The return value is 0 if the search fails.
+ *
+ */
 
-    entry_number = (padding == 0x00) ? lower : upper;
+static zword lookup_text (int padding, zword dct)
+{
+    dict_index_t *d;
+    int n;
+
+    if (resolution == 0) find_resolution();
+
+    encode_text (padding);
+
+    d = get_dictionary (dct);
+    n = search_dictionary (d, padding);
 
-    if (entry_number == -1 || entry_number == entry_count)
+    if (n == -1)
 	return 0;
 
-    return dct + entry_number * entry_len;
+    if (padding != 0x05)
+	n = d->order[n];
+
+    return d->entries + n * d->entry_len;
 
 }/* lookup_text */
 
@@ -1200,8 +1461,11 @@ void z_tokenise (void)
 
 int completion (const zchar *buffer, zchar *result)
 {
+    dict_index_t *d;
     zword minaddr;
     zword maxaddr;
+    int minpos;
+    int maxpos;
     zchar *ptr;
     zchar c;
     int len;
@@ -1228,12 +1492,19 @@ int completion (const zchar *buffer, zchar *result)
 
     /* Search the dictionary for first and last possible extensions */
 
-    minaddr = lookup_text (0x00, h_dictionary);
-    maxaddr = lookup_text (0x1f, h_dictionary);
+    d = get_dictionary (h_dictionary);
 
-    if (minaddr == 0 || maxaddr == 0 || minaddr > maxaddr)
+    encode_text (0x00);
+    minpos = search_dictionary (d, 0x00);
+    encode_text (0x1f);
+    maxpos = search_dictionary (d, 0x1f);
+
+    if (minpos == -1 || maxpos == -1 || minpos > maxpos)
 	return 2;
 
+    minaddr = d->entries + d->order[minpos] * d->entry_len;
+    maxaddr = d->entries + d->order[maxpos] * d->entry_len;
+
     /* Copy first extension to "result" string */
 
     decode_text (VOCABULARY, minaddr);
@@ -1254,7 +1525,7 @@ int completion (const zchar *buffer, zchar *result)
 
     /* Search was ambiguous or successful */
 
-    return (minaddr == maxaddr) ? 0 : 1;
+    return (minpos == maxpos) ? 0 : 1;
 
 }/* completion */
 
@@ -22,6 +22,7 @@ enum
 int gPeephole = 1;
 int gDebug = 0;
 int gCacheRAM = 0;
+int gNativeCode = 1;
 
 BlockHeader * gBlockHeader;
 
@@ -109,10 +110,19 @@ void initCompiler (size_t size)
 
     sCodeStart = sCodeTop = (Block) (gHashTable + gHashSize);
     sTempStart = sTempEnd = (PatchNode*) (sBuffer + sBufferSize);
+
+#ifdef USE_NATIVE_CODE
+    if (gNativeCode)
+        initNativeCode ();
+#endif
 }
 
 void shutdownCompiler ()
 {
+#ifdef USE_NATIVE_CODE
+    shutdownNativeCode ();
+#endif
+
     free (sBuffer);
 
     sBuffer = NULL;
@@ -209,8 +219,11 @@ Block compile (git_uint32 pc)
                 longjmp (sJumpBuf, LONGJMP_CACHE_FULL);
             }
 
-            // Parse the next instruction.
+            // Parse the next instruction. The peephole optimiser
+            // mustn't merge labels across instructions, because
+            // something might jump to the start of this one.
 
+            resetPeepholeOptimiser();
             parseInstruction (&pc, &done);
 
             if (pc < sLastAddr)
@@ -353,6 +366,7 @@ Block compile (git_uint32 pc)
     gBlockHeader->compiledSize = sCodeTop - (git_uint32*) gBlockHeader;
     gBlockHeader->glulxSize = endOfBlock - pc;
     gBlockHeader->runCounter = 0;
+    gBlockHeader->nativeCode = 0;
     
     assert(gBlockHeader->compiledSize > 0);
 
@@ -412,6 +426,10 @@ static void compressWithCutoff (git_uint32 cutoff)
             // stick around in the short term, but eventually fall out
             // of the cache if they're not used much in the future.
             h->runCounter /= 2;
+
+            // The block is moving, so its native code would be
+            // pointing to the wrong place.
+            h->nativeCode = 0;
  
             memmove (sCodeTop, h, size * sizeof(git_uint32));
             sCodeTop += size;
@@ -507,6 +525,7 @@ void pruneCodeCache (git_uint32 address, git_uint32 size)
             }
     
             h->glulxSize = 0;
+            h->nativeCode = 0;
         }
     }
 }
@@ -520,6 +539,10 @@ void compressCodeCache ()
     compressWithCutoff (n);
     rebuildHashTable ();
 
+#ifdef USE_NATIVE_CODE
+    resetNativeCode ();
+#endif
+
     spaceUsed = sCodeTop - sCodeStart;
     spaceFree = sBufferSize - spaceUsed - gHashSize;
 
@@ -544,7 +567,25 @@ void resetCodeCache ()
     memset (sBuffer, 0, sBufferSize * 4);
     sCodeStart = sCodeTop = (Block) (gHashTable + gHashSize);
     sTempStart = sTempEnd = (PatchNode*) (sBuffer + sBufferSize);
+
+#ifdef USE_NATIVE_CODE
+    resetNativeCode ();
+#endif
+}
+
+#ifdef USE_NATIVE_CODE
+void forgetNativeCode ()
+{
+    BlockHeader * start = (BlockHeader*) sCodeStart;
+    BlockHeader * top = (BlockHeader*) sCodeTop;
+    BlockHeader * h;
+
+    for (h = start ; h < top ; h = END_OF_BLOCK(h))
+        h->nativeCode = 0;
+
+    resetNativeCode ();
 }
+#endif
 
 Block peekAtEmittedStuff (int numOpcodes)
 {
@@ -29,6 +29,7 @@ typedef git_uint32* Block; // Generated code block: array of labels.
 extern int gPeephole; // Peephole optimisation of generated code?
 extern int gDebug;    // Insert debug statements into generated code?
 extern int gCacheRAM; // Keep RAM-based code in the JIT cache?
+extern int gNativeCode; // Translate frequently-run code into native code?
 
 // -------------------------------------------------------------
 // Compiling code
@@ -77,7 +78,9 @@ typedef struct BlockHeader
     git_uint16 compiledSize; // Total size of this block, in 4-byte words.
     git_uint32 glulxSize;    // Size of the glulx code this block represents, in bytes.
     git_uint32 runCounter;   // Total number of times this block was retrieved from the cache
-}                            // (used to determine which blocks stay in the cache)
+                             // (used to determine which blocks stay in the cache)
+    git_uint32 nativeCode;   // Offset of this block's native code, if any (see native.c)
+}
 BlockHeader;
 
 // This is the header for the block currently being executed --
@@ -106,4 +109,53 @@ GIT_INLINE Block getCode (git_uint32 pc)
     return compile (pc);
 }
 
+// -------------------------------------------------------------
+// Native code
+
+#ifdef USE_NATIVE_CODE
+
+// Blocks that have been retrieved from the cache this
+// many times are translated into native code.
+#define NATIVE_THRESHOLD 64
+
+// BlockHeader.nativeCode is 0 if the block hasn't been
+// translated yet, or this if it can't be translated.
+#define NATIVE_NONE 0xFFFFFFFF
+
+// The terp's state, as seen by the native code.
+typedef struct NativeState
+{
+    git_sint32 L [8];     // L1 to L7. (L[0] is unused.)
+    git_sint32 * sp;
+    git_sint32 * locals;
+    git_sint32 * values;
+    git_sint32 * top;
+    git_sint32 * args;
+    git_uint8 * mem;      // These three are filled in by runNativeCode().
+    git_uint32 endMem;
+    git_uint32 ramStart;
+}
+NativeState;
+
+typedef void * NativeCode;
+
+extern void initNativeCode ();
+extern void shutdownNativeCode ();
+extern void resetNativeCode ();
+
+// Throws away all the native code. This is in compiler.c,
+// because it has to visit every block in the cache.
+extern void forgetNativeCode ();
+
+// Returns the native code for the given threaded code, which must be
+// in the block most recently returned by getCode(), or NULL if there
+// isn't any. Translates the block if necessary.
+extern NativeCode getNativeCode (Block pc);
+
+// Runs native code until it reaches something it can't handle.
+// Returns the threaded code where the terp should carry on.
+extern Block runNativeCode (NativeCode code, NativeState * state);
+
+#endif // USE_NATIVE_CODE
+
 #endif // GIT_COMPILER_H
@@ -25,8 +25,31 @@
 // Define this to memory-map the game file to speed up loading. (Unix-specific)
 // #define USE_MMAP
 
+// Define this to translate frequently-run code into x86-64 machine code.
+// (See native.c. Ignored on other processors.)
+// #define USE_NATIVE_CODE
+
+// Define this to count which labels the terp runs one after the
+// other, for generating superinstructions. (See superops.py.)
+// #define USE_LABEL_PROFILE
+
 // -------------------------------------------------------------------
 
+// The native code generator only knows about x86-64, and the Unix
+// calling convention.
+
+#if defined(USE_NATIVE_CODE) && !(defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__)))
+#undef USE_NATIVE_CODE
+#endif
+
+// The label profiler has to see every label the terp dispatches,
+// so it only works with the plain switch() dispatch loop.
+
+#ifdef USE_LABEL_PROFILE
+#undef USE_DIRECT_THREADING
+#undef USE_NATIVE_CODE
+#endif
+
 // Make sure we're compiling for a sane platform. For now, this means
 // 8-bit bytes and 32-bit pointers. We'll support 64-bit machines at
 // some point in the future, but we will probably never support machines
@@ -20,7 +20,14 @@ static void gitMain (const git_uint8 * game, git_uint32 gameSize, git_uint32 cac
 
     // Set various globals.    
     gPeephole = 1;
+#ifdef USE_LABEL_PROFILE
+    // The profiler needs to see where each instruction starts.
+    gDebug = (gLabelProfile != NULL);
+    if (gLabelProfile != NULL)
+        initLabelProfile ();
+#else
     gDebug = 0;
+#endif
     
     // Load the gamefile into memory
     // and initialise undo records.
@@ -59,6 +66,10 @@ static void gitMain (const git_uint8 * game, git_uint32 gameSize, git_uint32 cac
     
     // Call the top-level function.
     startProgram (cacheSize);
+
+#ifdef USE_LABEL_PROFILE
+    writeLabelProfile ();
+#endif
     
     // Shut everything down cleanly.
     shutdownUndo();
@@ -104,6 +104,13 @@ extern void parseCatchStub (git_uint32 * pc, int * modes);
 extern void resetPeepholeOptimiser();
 extern void emitCode (Label);
 
+#ifdef USE_LABEL_PROFILE
+extern const char * gLabelProfile;
+extern void initLabelProfile ();
+extern void profileLabel (Label);
+extern void writeLabelProfile ();
+#endif
+
 // terp.c
 
 #if defined(USE_DIRECT_THREADING) && (UINTPTR_MAX > 0xffffffffULL)
@@ -7,6 +7,7 @@
 #include "git.h"
 #include <glk.h>
 #include <glkstart.h> // This comes with the Glk library.
+#include <string.h>
 
 #ifdef USE_MMAP
 #include <fcntl.h>
@@ -15,9 +16,14 @@
 #include <errno.h>
 #endif
 
-// The only command-line argument is the filename.
 glkunix_argumentlist_t glkunix_arguments[] =
 {
+#ifdef USE_NATIVE_CODE
+    { "--nonative", glkunix_arg_NoValue, "Don't translate code into machine code." },
+#endif
+#ifdef USE_LABEL_PROFILE
+    { "--profile", glkunix_arg_ValueFollows, "Write a label profile to this file." },
+#endif
     { "", glkunix_arg_ValueFollows, "filename: The game file to load." },
     { NULL, glkunix_arg_End, NULL }
 };
@@ -27,8 +33,6 @@ glkunix_argumentlist_t glkunix_arguments[] =
 
 #ifdef GARGLK
 
-#include <string.h>
-
 int gHasInited = 0;
 char * gStartupError = 0;
 
@@ -57,6 +61,34 @@ void fatalError (const char * s)
 
 #endif /* GARGLK */
 
+// Picks out the options from the command line, and
+// returns the game filename, or NULL if there isn't one.
+static char * parseArguments (glkunix_startup_t *data)
+{
+    char * filename = NULL;
+    int i;
+
+    for (i = 1 ; i < data->argc ; ++i)
+    {
+#ifdef USE_NATIVE_CODE
+        if (strcmp (data->argv[i], "--nonative") == 0)
+        {
+            gNativeCode = 0;
+            continue;
+        }
+#endif
+#ifdef USE_LABEL_PROFILE
+        if (strcmp (data->argv[i], "--profile") == 0 && i + 1 < data->argc)
+        {
+            gLabelProfile = data->argv[++i];
+            continue;
+        }
+#endif
+        filename = data->argv[i];
+    }
+    return filename;
+}
+
 #ifdef USE_MMAP
 // Fast loader that uses some fancy Unix features.
 
@@ -64,6 +96,8 @@ const char * gFilename = 0;
 
 int glkunix_startup_code(glkunix_startup_t *data)
 {
+    char * filename;
+
 #ifdef GARGLK
 	{
 		char buf[255];
@@ -75,7 +109,8 @@ int glkunix_startup_code(glkunix_startup_t *data)
 	}
 #endif /* GARGLK */
 
-    if (data->argc <= 1)
+    filename = parseArguments (data);
+    if (filename == NULL)
     {
 #ifdef GARGLK
         gStartupError = "No file given";
@@ -89,14 +124,14 @@ int glkunix_startup_code(glkunix_startup_t *data)
 #ifdef GARGLK
 	{
 		char *s;
-		s = strrchr(data->argv[1], '\\');
+		s = strrchr(filename, '\\');
 		if (s) garglk_set_story_name(s+1);
-		s = strrchr(data->argv[1], '/');
+		s = strrchr(filename, '/');
 		if (s) garglk_set_story_name(s+1);
 	}
 #endif /* GARGLK */
 
-    gFilename = data->argv[1];
+    gFilename = filename;
     return 1;
 }
 
@@ -157,6 +192,8 @@ strid_t gStream = 0;
 
 int glkunix_startup_code(glkunix_startup_t *data)
 {
+    char * filename;
+
 #ifdef GARGLK
 	{
 		char buf[255];
@@ -168,7 +205,8 @@ int glkunix_startup_code(glkunix_startup_t *data)
 	}
 #endif /* GARGLK */
 
-    if (data->argc <= 1)
+    filename = parseArguments (data);
+    if (filename == NULL)
     {
 #ifdef GARGLK
         gStartupError = "No file given";
@@ -182,14 +220,14 @@ int glkunix_startup_code(glkunix_startup_t *data)
 #ifdef GARGLK
 	{
 		char *s;
-		s = strrchr(data->argv[1], '\\');
+		s = strrchr(filename, '\\');
 		if (s) garglk_set_story_name(s+1);
-		s = strrchr(data->argv[1], '/');
+		s = strrchr(filename, '/');
 		if (s) garglk_set_story_name(s+1);
 	}
 #endif /* GARGLK */
 
-    gStream = glkunix_stream_open_pathname ((char*) data->argv[1], 0, 0);
+    gStream = glkunix_stream_open_pathname (filename, 0, 0);
     return 1;
 }
 
@@ -0,0 +1,1388 @@
+// Native code generator for git.
+
+#include "git.h"
+
+#ifdef USE_NATIVE_CODE
+
+#include <assert.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+// Blocks of threaded code that are retrieved from the cache more than
+// NATIVE_THRESHOLD times are translated into x86-64 machine code, one
+// label at a time. Loads and stores, integer arithmetic, array access,
+// integer branches and argument setup are translated. Any other label,
+// including the call stubs and returns, makes the native code hand the
+// terp a pointer to that label, and the terp carries on from there.
+//
+// Native code is only entered from do_jump_abs_L7, at an address that
+// getCode() can return. So calls go through the terp, but both the
+// function being called and the code it returns to can be native.
+//
+// Whenever the terp could fail part-way through a label (stack overflow,
+// a memory access out of range, division by zero) the native code checks
+// for the failure *before* doing anything, and hands that label back to
+// the terp so that it reports the error itself.
+
+// -------------------------------------------------------------
+// Constants
+
+#define REGION_SIZE (4 * 1024 * 1024) // Size of the executable memory region.
+#define MAX_OP_SIZE 256               // Most native code generated for one label.
+#define STUB_SIZE   16                // Size of the code for one exit to the terp.
+
+// Largest address or local variable whose offset fits in a 32-bit displacement.
+#define MAX_ADDR    0x7FFFFF00
+#define MAX_LOCAL   0x1FFFFFC0
+
+// x86-64 registers.
+
+enum
+{
+    RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+    R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+// While native code is running, the terp's state lives in these
+// registers. L1-L3 are in R8-R10; L4-L7 are left in the NativeState.
+// RAX, RCX and RDX are scratch registers.
+
+#define REG_STATE    RDI
+#define REG_SP       RSI
+#define REG_MEM      R11
+#define REG_LOCALS   RBX
+#define REG_VALUES   R12
+#define REG_TOP      R13
+#define REG_ENDMEM   R14
+#define REG_RAMSTART R15
+
+#define REG_L(n)     (R8 + (n) - 1)
+#define OFFSET_L(n)  ((git_sint32) (offsetof (NativeState, L) + 4 * (n)))
+
+// Instructions. Values above 0xFF have a 0x0F prefix byte.
+
+enum
+{
+    OP_ADD = 0x01, OP_OR = 0x09, OP_AND = 0x21, OP_SUB = 0x29,
+    OP_XOR = 0x31, OP_CMP = 0x39, OP_GROUP1 = 0x81, OP_TEST = 0x85,
+    OP_STORE8 = 0x88, OP_STORE = 0x89, OP_LOAD = 0x8B, OP_LEA = 0x8D,
+    OP_SHIFT_IMM = 0xC1, OP_MOV_IMM = 0xC7, OP_SHIFT_CL = 0xD3, OP_GROUP3 = 0xF7,
+    OP_CMOVA = 0x0F47, OP_IMUL = 0x0FAF, OP_MOVZX8 = 0x0FB6, OP_MOVZX16 = 0x0FB7,
+    OP_MOVSX8 = 0x0FBE, OP_MOVSX16 = 0x0FBF
+};
+
+// Values of the ModRM reg field for the group opcodes.
+
+enum
+{
+    EXT_ADD = 0, EXT_AND = 4, EXT_SUB = 5, EXT_CMP = 7,
+    EXT_NOT = 2, EXT_NEG = 3, EXT_IDIV = 7,
+    EXT_SHL = 4, EXT_SHR = 5, EXT_SAR = 7
+};
+
+// Condition codes.
+
+enum
+{
+    CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5,
+    CC_BE = 0x6, CC_A = 0x7, CC_L = 0xC, CC_GE = 0xD,
+    CC_LE = 0xE, CC_G = 0xF,
+    CC_ALWAYS = 0x10
+};
+
+// Addressing modes of loads and stores.
+
+enum
+{
+    MODE_NONE, MODE_DISCARD, MODE_CONST, MODE_STACK, MODE_LOCAL, MODE_ADDR
+};
+
+// Kinds of branch label.
+
+enum
+{
+    BRANCH_VAR, BRANCH_CONST, BRANCH_BY, BRANCH_RETURN0, BRANCH_RETURN1
+};
+
+// -------------------------------------------------------------
+// Types
+
+typedef Block (*NativeEnter) (NativeState * state, NativeCode code);
+
+typedef struct NativeEntry
+{
+    git_uint32 codeOffset;   // Offset in 4-byte words from the block header to the threaded code.
+    git_uint32 nativeOffset; // Offset in bytes from the start of the region to the native code.
+}
+NativeEntry;
+
+// This is stored in the region ahead of the native code for a block.
+// BlockHeader.nativeCode is its offset from the start of the region.
+typedef struct NativeBlock
+{
+    git_uint32 numEntries;
+    NativeEntry entries [];
+}
+NativeBlock;
+
+typedef struct Op
+{
+    git_uint32 * pc;  // Threaded code for this label.
+    Label label;
+    git_uint8 * code; // Native code for this label.
+    int isNative;     // Did we manage to translate it?
+    int isEntry;      // Can getCode() return a pointer to it?
+}
+Op;
+
+typedef struct Fixup
+{
+    git_uint8 * at;      // Where the 32-bit jump offset goes.
+    git_uint32 * target; // Threaded code to jump to.
+    int isExit;          // Always return to the terp, even if the target is native?
+}
+Fixup;
+
+// -------------------------------------------------------------
+// Static variables
+
+static git_uint8 * sRegion;    // Executable memory, holding all the native code.
+static git_uint8 * sRegionTop; // Next free byte in the region.
+static git_uint8 * sFirstFree; // First byte after the entry and exit code.
+static git_uint8 * sExitCode;  // Saves the registers and returns to the terp.
+static NativeEnter sEnter;     // Loads the registers and jumps to native code.
+
+static Op * sOps;        // Labels in the block being translated.
+static int sNumOps;
+static int sMaxOps;
+
+static Fixup * sFixups;  // Jumps that need to be patched.
+static int sNumFixups;
+static int sMaxFixups;
+
+static git_uint32 * sBailPc; // The label being translated.
+static int sStackLoads;      // Number of values it has popped off the stack so far.
+static int sStackStores;     // Number of values it has pushed onto the stack so far.
+
+static jmp_buf sJumpBuf; // setjmp buffer, used to abort translation when the region is full.
+
+#ifdef USE_DIRECT_THREADING
+typedef struct OpcodeLabel
+{
+    git_uint32 opcode;
+    Label label;
+}
+OpcodeLabel;
+
+static OpcodeLabel sOpcodeLabels [MAX_LABEL];
+#endif
+
+// -------------------------------------------------------------
+// Emitting x86-64 instructions
+
+static void reserve (size_t size)
+{
+    if (sRegionTop + size > sRegion + REGION_SIZE)
+        longjmp (sJumpBuf, 1);
+}
+
+static void emitByte (git_uint8 b)
+{
+    *sRegionTop++ = b;
+}
+
+static void emit32 (git_uint32 n)
+{
+    memcpy (sRegionTop, &n, 4);
+    sRegionTop += 4;
+}
+
+static void emit64 (uint64_t n)
+{
+    memcpy (sRegionTop, &n, 8);
+    sRegionTop += 8;
+}
+
+static void emitRex (int w, int reg, int index, int base)
+{
+    int rex = 0x40 | (w << 3) | ((reg & 8) >> 1) | ((index & 8) >> 2) | ((base & 8) >> 3);
+    if (rex != 0x40)
+        emitByte (rex);
+}
+
+static void emitOpcode (int opcode)
+{
+    if (opcode > 0xFF)
+        emitByte (opcode >> 8);
+    emitByte (opcode & 0xFF);
+}
+
+// opcode reg, rm
+static void emitRegReg (int w, int opcode, int reg, int rm)
+{
+    emitRex (w, reg, 0, rm);
+    emitOpcode (opcode);
+    emitByte (0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+// opcode reg, [base + disp]
+static void emitRegMem (int w, int opcode, int reg, int base, git_sint32 disp)
+{
+    emitRex (w, reg, 0, base);
+    emitOpcode (opcode);
+    emitByte (0x80 | ((reg & 7) << 3) | (base & 7));
+    if ((base & 7) == RSP)
+        emitByte (0x24);
+    emit32 (disp);
+}
+
+// opcode reg, [base + index]
+static void emitRegIndex (int w, int opcode, int reg, int base, int index)
+{
+    assert ((base & 7) != RBP);
+    emitRex (w, reg, index, base);
+    emitOpcode (opcode);
+    emitByte (0x04 | ((reg & 7) << 3));
+    emitByte (((index & 7) << 3) | (base & 7));
+}
+
+// Two-register arithmetic: dst = dst op src.
+static void emitAlu (int w, int opcode, int dst, int src)
+{
+    emitRegReg (w, opcode, src, dst);
+}
+
+static void emitMov (int dst, int src)
+{
+    emitAlu (0, OP_STORE, dst, src);
+}
+
+static void emitMovImm (int dst, git_uint32 imm)
+{
+    emitRex (0, 0, 0, dst);
+    emitByte (0xB8 + (dst & 7));
+    emit32 (imm);
+}
+
+// Group 1 arithmetic with a 32-bit immediate.
+static void emitAluImm (int w, int ext, int dst, git_uint32 imm)
+{
+    emitRegReg (w, OP_GROUP1, ext, dst);
+    emit32 (imm);
+}
+
+static void emitShiftImm (int w, int ext, int dst, int count)
+{
+    emitRegReg (w, OP_SHIFT_IMM, ext, dst);
+    emitByte (count);
+}
+
+static void emitBswap (int reg)
+{
+    emitRex (0, 0, 0, reg);
+    emitByte (0x0F);
+    emitByte (0xC8 + (reg & 7));
+}
+
+static void emitPush (int reg)
+{
+    emitRex (0, 0, 0, reg);
+    emitByte (0x50 + (reg & 7));
+}
+
+static void emitPop (int reg)
+{
+    emitRex (0, 0, 0, reg);
+    emitByte (0x58 + (reg & 7));
+}
+
+static void addFixup (git_uint8 * at, git_uint32 * target, int isExit)
+{
+    if (sNumFixups == sMaxFixups)
+    {
+        sMaxFixups = sMaxFixups ? sMaxFixups * 2 : 256;
+        sFixups = realloc (sFixups, sMaxFixups * sizeof(Fixup));
+        if (sFixups == NULL)
+            fatalError ("Couldn't allocate native code fixups");
+    }
+    sFixups [sNumFixups].at = at;
+    sFixups [sNumFixups].target = target;
+    sFixups [sNumFixups].isExit = isExit;
+    ++sNumFixups;
+}
+
+// Jump to the native code for some threaded code, or failing
+// that, return to the terp and let it run the threaded code.
+static void emitJump (int cc, git_uint32 * target, int isExit)
+{
+    if (cc == CC_ALWAYS)
+    {
+        emitByte (0xE9);
+    }
+    else
+    {
+        emitByte (0x0F);
+        emitByte (0x80 | cc);
+    }
+    addFixup (sRegionTop, target, isExit);
+    emit32 (0);
+}
+
+// Return to the terp, so that it runs the current label itself.
+static void emitBail (int cc)
+{
+    emitJump (cc, sBailPc, 1);
+}
+
+// Return to the terp, which carries on at the given threaded code.
+static void emitExit (git_uint32 * target)
+{
+    emitByte (0x48);
+    emitByte (0xB8 + RAX);
+    emit64 ((uintptr_t) target);
+    emitByte (0xE9);
+    emit32 (sExitCode - (sRegionTop + 4));
+}
+
+// -------------------------------------------------------------
+// The terp's registers
+
+static void emitGetL (int dst, int n)
+{
+    if (n <= 3)
+        emitMov (dst, REG_L(n));
+    else
+        emitRegMem (0, OP_LOAD, dst, REG_STATE, OFFSET_L(n));
+}
+
+static void emitSetL (int n, int src)
+{
+    if (n <= 3)
+        emitMov (REG_L(n), src);
+    else
+        emitRegMem (0, OP_STORE, src, REG_STATE, OFFSET_L(n));
+}
+
+static void emitLoadL (int n, int base, git_sint32 disp)
+{
+    if (n <= 3)
+    {
+        emitRegMem (0, OP_LOAD, REG_L(n), base, disp);
+    }
+    else
+    {
+        emitRegMem (0, OP_LOAD, RAX, base, disp);
+        emitSetL (n, RAX);
+    }
+}
+
+// -------------------------------------------------------------
+// Loads and stores
+
+static int canLoad (int mode, git_uint32 value)
+{
+    switch (mode)
+    {
+        case MODE_LOCAL: return value <= MAX_LOCAL;
+        case MODE_ADDR:  return value <= MAX_ADDR;
+        default:         return 1;
+    }
+}
+
+static int canStore (int mode, git_uint32 value)
+{
+    // Writes to ROM are always an error, so leave them to the terp.
+    if (mode == MODE_ADDR && value < gRamStart)
+        return 0;
+    return canLoad (mode, value);
+}
+
+// Bail out if sp - values < n.
+static void checkUsed (int n)
+{
+    emitRegMem (1, OP_LEA, RAX, REG_VALUES, 4 * n);
+    emitAlu (1, OP_CMP, REG_SP, RAX);
+    emitBail (CC_B);
+}
+
+// Bail out if top - sp < n.
+static void checkFree (int n)
+{
+    emitRegMem (1, OP_LEA, RAX, REG_SP, 4 * n);
+    emitAlu (1, OP_CMP, RAX, REG_TOP);
+    emitBail (CC_A);
+}
+
+// Bail out if a constant address is past the end of memory.
+// (Writes below RAM were ruled out by canStore.)
+static void checkAddr (int mode, git_uint32 value, int size)
+{
+    if (mode == MODE_ADDR)
+    {
+        emitAluImm (0, EXT_CMP, REG_ENDMEM, value + size);
+        emitBail (CC_B);
+    }
+}
+
+// Bail out if the address in RDX is out of range.
+static void checkIndex (int size, int isWrite)
+{
+    emitRegMem (1, OP_LEA, RCX, RDX, size);
+    emitAlu (1, OP_CMP, RCX, REG_ENDMEM);
+    emitBail (CC_A);
+
+    if (isWrite)
+    {
+        emitAlu (0, OP_CMP, RDX, REG_RAMSTART);
+        emitBail (CC_B);
+    }
+}
+
+static void emitLoad (int n, int mode, git_uint32 value)
+{
+    switch (mode)
+    {
+        case MODE_CONST:
+            if (n <= 3)
+                emitMovImm (REG_L(n), value);
+            else
+            {
+                emitRegMem (0, OP_MOV_IMM, 0, REG_STATE, OFFSET_L(n));
+                emit32 (value);
+            }
+            break;
+
+        case MODE_STACK:
+            emitAluImm (1, EXT_SUB, REG_SP, 4);
+            emitLoadL (n, REG_SP, 0);
+            ++sStackLoads;
+            break;
+
+        case MODE_LOCAL:
+            emitLoadL (n, REG_LOCALS, 4 * value);
+            break;
+
+        case MODE_ADDR:
+            emitRegMem (0, OP_LOAD, RAX, REG_MEM, value);
+            emitBswap (RAX);
+            emitSetL (n, RAX);
+            break;
+    }
+}
+
+static void emitStore (int n, int mode, git_uint32 value)
+{
+    switch (mode)
+    {
+        case MODE_STACK:
+            emitRegMem (0, OP_STORE, REG_L(n), REG_SP, 0);
+            emitAluImm (1, EXT_ADD, REG_SP, 4);
+            ++sStackStores;
+            break;
+
+        case MODE_LOCAL:
+            emitRegMem (0, OP_STORE, REG_L(n), REG_LOCALS, 4 * value);
+            break;
+
+        case MODE_ADDR:
+            emitMov (RAX, REG_L(n));
+            emitBswap (RAX);
+            emitRegMem (0, OP_STORE, RAX, REG_MEM, value);
+            break;
+    }
+}
+
+// -------------------------------------------------------------
+// Translating labels
+
+static int translateLoad (int n, int mode, git_uint32 value)
+{
+    if (!canLoad (mode, value))
+        return 0;
+
+    if (mode == MODE_STACK)
+        checkUsed (1);
+    checkAddr (mode, value, 4);
+
+    emitLoad (n, mode, value);
+    return 1;
+}
+
+static int translateDoubleLoad (int mode1, git_uint32 value1, int mode2, git_uint32 value2)
+{
+    if (!canLoad (mode1, value1) || !canLoad (mode2, value2))
+        return 0;
+
+    if (mode1 == MODE_STACK || mode2 == MODE_STACK)
+        checkUsed ((mode1 == MODE_STACK) + (mode2 == MODE_STACK));
+    checkAddr (mode1, value1, 4);
+    checkAddr (mode2, value2, 4);
+
+    emitLoad (1, mode1, value1);
+    emitLoad (2, mode2, value2);
+    return 1;
+}
+
+static int translateStore (int n, int mode, git_uint32 value)
+{
+    if (!canStore (mode, value))
+        return 0;
+
+    if (mode == MODE_STACK)
+        checkFree (1);
+    checkAddr (mode, value, 4);
+
+    emitStore (n, mode, value);
+    return 1;
+}
+
+static int translateSmallLoad (int size, git_uint32 addr)
+{
+    if (!canLoad (MODE_ADDR, addr))
+        return 0;
+
+    checkAddr (MODE_ADDR, addr, size);
+
+    if (size == 2)
+    {
+        emitRegMem (0, OP_MOVZX16, RAX, REG_MEM, addr);
+        emitBswap (RAX);
+        emitShiftImm (0, EXT_SHR, RAX, 16);
+    }
+    else
+    {
+        emitRegMem (0, OP_MOVZX8, RAX, REG_MEM, addr);
+    }
+    emitSetL (1, RAX);
+    return 1;
+}
+
+static int translateSmallStore (int size, git_uint32 addr)
+{
+    if (!canStore (MODE_ADDR, addr))
+        return 0;
+
+    checkAddr (MODE_ADDR, addr, size);
+
+    if (size == 2)
+    {
+        emitMov (RAX, REG_L(1));
+        emitBswap (RAX);
+        emitShiftImm (0, EXT_SHR, RAX, 16);
+        emitByte (0x66);
+        emitRegMem (0, OP_STORE, RAX, REG_MEM, addr);
+    }
+    else
+    {
+        emitRegMem (0, OP_STORE8, REG_L(1), REG_MEM, addr);
+    }
+    return 1;
+}
+
+// The arithmetic labels all compute S1 from L1 and L2, then store it.
+// 'op' is the _discard version of the label.
+static int translateArith (Label op, int storeMode, git_uint32 storeValue)
+{
+    if (!canStore (storeMode, storeValue))
+        return 0;
+
+    if (storeMode == MODE_STACK)
+        checkFree (1);
+    checkAddr (storeMode, storeValue, 4);
+
+    switch (op)
+    {
+        case label_add_discard:
+            emitMov (RAX, R8);
+            emitAlu (0, OP_ADD, RAX, R9);
+            break;
+
+        case label_sub_discard:
+            emitMov (RAX, R8);
+            emitAlu (0, OP_SUB, RAX, R9);
+            break;
+
+        case label_mul_discard:
+            emitMov (RAX, R8);
+            emitRegReg (0, OP_IMUL, RAX, R9);
+            break;
+
+        case label_div_discard:
+        case label_mod_discard:
+            emitAlu (0, OP_TEST, R9, R9);
+            emitBail (CC_E);
+            emitMov (RAX, R8);
+            emitByte (0x99); // cdq
+            emitRegReg (0, OP_GROUP3, EXT_IDIV, R9);
+            if (op == label_mod_discard)
+                emitMov (RAX, RDX);
+            break;
+
+        case label_neg_discard:
+            emitMov (RAX, R8);
+            emitRegReg (0, OP_GROUP3, EXT_NEG, RAX);
+            break;
+
+        case label_bitnot_discard:
+            emitMov (RAX, R8);
+            emitRegReg (0, OP_GROUP3, EXT_NOT, RAX);
+            break;
+
+        case label_bitand_discard:
+            emitMov (RAX, R8);
+            emitAlu (0, OP_AND, RAX, R9);
+            break;
+
+        case label_bitor_discard:
+            emitMov (RAX, R8);
+            emitAlu (0, OP_OR, RAX, R9);
+            break;
+
+        case label_bitxor_discard:
+            emitMov (RAX, R8);
+            emitAlu (0, OP_XOR, RAX, R9);
+            break;
+
+        case label_shiftl_discard:
+        case label_ushiftr_discard:
+            // Shifting by more than 31 places gives zero.
+            emitMov (RCX, R9);
+            emitMov (RAX, R8);
+            emitRegReg (0, OP_SHIFT_CL, op == label_shiftl_discard ? EXT_SHL : EXT_SHR, RAX);
+            emitAlu (0, OP_XOR, RDX, RDX);
+            emitAluImm (0, EXT_CMP, R9, 31);
+            emitRegReg (0, OP_CMOVA, RAX, RDX);
+            break;
+
+        case label_sshiftr_discard:
+            // The terp clamps L2 itself to 31, so we do too.
+            emitMovImm (RCX, 31);
+            emitAluImm (0, EXT_CMP, R9, 31);
+            emitRegReg (0, OP_CMOVA, R9, RCX);
+            emitMov (RCX, R9);
+            emitMov (RAX, R8);
+            emitRegReg (0, OP_SHIFT_CL, EXT_SAR, RAX);
+            break;
+
+        case label_copys_discard: emitRegReg (0, OP_MOVZX16, RAX, R8); break;
+        case label_copyb_discard: emitRegReg (0, OP_MOVZX8, RAX, R8);  break;
+        case label_sexs_discard:  emitRegReg (0, OP_MOVSX16, RAX, R8); break;
+        case label_sexb_discard:  emitRegReg (0, OP_MOVSX8, RAX, R8);  break;
+
+        case label_aload_discard:
+            emitMov (RDX, R9);
+            emitShiftImm (0, EXT_SHL, RDX, 2);
+            emitAlu (0, OP_ADD, RDX, R8);
+            checkIndex (4, 0);
+            emitRegIndex (0, OP_LOAD, RAX, REG_MEM, RDX);
+            emitBswap (RAX);
+            break;
+
+        case label_aloads_discard:
+            emitMov (RDX, R9);
+            emitShiftImm (0, EXT_SHL, RDX, 1);
+            emitAlu (0, OP_ADD, RDX, R8);
+            checkIndex (2, 0);
+            emitRegIndex (0, OP_MOVZX16, RAX, REG_MEM, RDX);
+            emitBswap (RAX);
+            emitShiftImm (0, EXT_SHR, RAX, 16);
+            break;
+
+        case label_aloadb_discard:
+            emitMov (RDX, R9);
+            emitAlu (0, OP_ADD, RDX, R8);
+            checkIndex (1, 0);
+            emitRegIndex (0, OP_MOVZX8, RAX, REG_MEM, RDX);
+            break;
+
+        case label_aloadbit_discard:
+            emitMov (RDX, R9);
+            emitShiftImm (0, EXT_SAR, RDX, 3);
+            emitAlu (0, OP_ADD, RDX, R8);
+            checkIndex (1, 0);
+            emitRegIndex (0, OP_MOVZX8, RAX, REG_MEM, RDX);
+            emitMov (RCX, R9);
+            emitAluImm (0, EXT_AND, RCX, 7);
+            emitRegReg (0, OP_SHIFT_CL, EXT_SHR, RAX);
+            emitAluImm (0, EXT_AND, RAX, 1);
+            break;
+
+        default:
+            assert (0);
+            return 0;
+    }
+
+    emitMov (R8, RAX);
+    emitStore (1, storeMode, storeValue);
+    return 1;
+}
+
+// The array store labels write L3 to L1 + L2 (scaled). If 'mode' isn't
+// MODE_NONE, L3 has to be loaded first.
+static int translateArrayStore (Label op, int mode, git_uint32 value)
+{
+    int size;
+
+    if (!canLoad (mode, value))
+        return 0;
+
+    if (mode == MODE_STACK)
+        checkUsed (1);
+    checkAddr (mode, value, 4);
+
+    switch (op)
+    {
+        case label_astore:  size = 4; break;
+        case label_astores: size = 2; break;
+        case label_astoreb: size = 1; break;
+        default: assert (0); return 0;
+    }
+
+    emitMov (RDX, R9);
+    if (size > 1)
+        emitShiftImm (0, EXT_SHL, RDX, size / 2);
+    emitAlu (0, OP_ADD, RDX, R8);
+    checkIndex (size, 1);
+
+    emitLoad (3, mode, value);
+
+    if (size == 1)
+    {
+        emitRegIndex (0, OP_STORE8, R10, REG_MEM, RDX);
+    }
+    else
+    {
+        emitMov (RAX, R10);
+        emitBswap (RAX);
+        if (size == 2)
+        {
+            emitShiftImm (0, EXT_SHR, RAX, 16);
+            emitByte (0x66);
+        }
+        emitRegIndex (0, OP_STORE, RAX, REG_MEM, RDX);
+    }
+    return 1;
+}
+
+// 'op' is the _by version of the label.
+static int translateBranch (Label op, int kind, git_uint32 * operands)
+{
+    int cc, compare = 1;
+
+    switch (op)
+    {
+        case label_jump_by: cc = CC_ALWAYS; compare = 0; break;
+        case label_jz_by:   cc = CC_E;  break;
+        case label_jnz_by:  cc = CC_NE; break;
+        case label_jeq_by:  cc = CC_E;  break;
+        case label_jne_by:  cc = CC_NE; break;
+        case label_jlt_by:  cc = CC_L;  break;
+        case label_jge_by:  cc = CC_GE; break;
+        case label_jgt_by:  cc = CC_G;  break;
+        case label_jle_by:  cc = CC_LE; break;
+        case label_jltu_by: cc = CC_B;  break;
+        case label_jgeu_by: cc = CC_AE; break;
+        case label_jgtu_by: cc = CC_A;  break;
+        case label_jleu_by: cc = CC_BE; break;
+        default: assert (0); return 0;
+    }
+
+    // An unconditional jump out of the block is best left to the terp.
+    if (cc == CC_ALWAYS && kind != BRANCH_BY)
+        return 0;
+
+    if (kind == BRANCH_VAR || kind == BRANCH_CONST || kind == BRANCH_BY)
+    {
+        emitRegMem (0, OP_MOV_IMM, 0, REG_STATE, OFFSET_L(7));
+        emit32 (operands [0]);
+    }
+
+    if (compare)
+    {
+        if (op == label_jz_by || op == label_jnz_by)
+            emitAlu (0, OP_TEST, R8, R8);
+        else
+            emitAlu (0, OP_CMP, R8, R9);
+    }
+
+    if (kind == BRANCH_BY)
+        emitJump (cc, operands + 1 + (git_sint32) operands [0], 0);
+    else
+        emitBail (cc);
+    return 1;
+}
+
+static int translateArgs (int n)
+{
+    emitRegMem (1, OP_LOAD, RCX, REG_STATE, offsetof (NativeState, args));
+    if (n == 3)
+    {
+        emitGetL (RAX, 4);
+        emitRegMem (0, OP_STORE, RAX, RCX, 0);
+    }
+    if (n >= 2)
+        emitRegMem (0, OP_STORE, R10, RCX, 4 * (n - 2));
+    if (n >= 1)
+        emitRegMem (0, OP_STORE, R9, RCX, 4 * (n - 1));
+    emitMovImm (R9, n);
+    return 1;
+}
+
+static int translateOp (Label label, git_uint32 * operands);
+
+// A superinstruction does the work of 'prev' and then 'next'. If the
+// native code for 'next' bails out, the terp runs the whole
+// superinstruction again, including 'prev'. That's harmless for loads
+// from constants, locals and memory and for stores to locals and
+// memory, but a value popped off or pushed onto the stack would be
+// popped or pushed twice. So if 'prev' touches the stack, 'next' has
+// to be translated without any bail-outs.
+static int translateSuperop (Label prev, Label next, int prevOperands, git_uint32 * operands)
+{
+    int numFixups, usedStack, i;
+
+    sStackLoads = sStackStores = 0;
+    if (!translateOp (prev, operands))
+        return 0;
+    usedStack = sStackLoads + sStackStores;
+
+    numFixups = sNumFixups;
+    if (!translateOp (next, operands + prevOperands))
+        return 0;
+
+    if (usedStack)
+    {
+        for (i = numFixups ; i < sNumFixups ; ++i)
+            if (sFixups [i].target == sBailPc)
+                return 0;
+    }
+    return 1;
+}
+
+// These lists must match the ones in labels.inc.
+
+#define ARITH_OPS(X) \
+    X(add) X(sub) X(mul) X(div) X(mod) X(neg) X(bitand) X(bitor) X(bitxor) \
+    X(bitnot) X(shiftl) X(sshiftr) X(ushiftr) X(copys) X(copyb) X(sexs) X(sexb) \
+    X(aload) X(aloads) X(aloadb) X(aloadbit)
+
+#define INT_BRANCH_OPS(X) \
+    X(jump) X(jz) X(jnz) X(jeq) X(jne) X(jlt) X(jge) X(jgt) X(jle) \
+    X(jltu) X(jgeu) X(jgtu) X(jleu)
+
+#define STORE_OPS(X) ARITH_OPS(X) X(fadd) X(fsub) X(fmul) X(fdiv)
+
+#define BRANCH_OPS(X) INT_BRANCH_OPS(X) \
+    X(jflt) X(jfge) X(jfgt) X(jfle) X(jisnan) X(jisinf) X(jfeq) X(jfne) \
+    X(jdlt) X(jdge) X(jdgt) X(jdle) X(jdisnan) X(jdisinf) X(jdeq) X(jdne)
+
+// Translate one label. Returns 0 if it can't be translated.
+static int translateOp (Label label, git_uint32 * operands)
+{
+    switch (label)
+    {
+        case label_nop:
+            return 1;
+
+#define LOAD_CASES(n) \
+        case label_L ## n ## _const: return translateLoad (n, MODE_CONST, operands[0]); \
+        case label_L ## n ## _stack: return translateLoad (n, MODE_STACK, 0);           \
+        case label_L ## n ## _local: return translateLoad (n, MODE_LOCAL, operands[0]); \
+        case label_L ## n ## _addr:  return translateLoad (n, MODE_ADDR, operands[0]);
+
+        LOAD_CASES(1) LOAD_CASES(2) LOAD_CASES(3) LOAD_CASES(4)
+        LOAD_CASES(5) LOAD_CASES(6) LOAD_CASES(7)
+
+#define DOUBLE_LOAD_CASES(tag2, mode2, n2) \
+        case label_L1_const_L2_ ## tag2: return translateDoubleLoad (MODE_CONST, operands[0], mode2, operands[n2]); \
+        case label_L1_stack_L2_ ## tag2: return translateDoubleLoad (MODE_STACK, 0, mode2, operands[0]);            \
+        case label_L1_local_L2_ ## tag2: return translateDoubleLoad (MODE_LOCAL, operands[0], mode2, operands[n2]); \
+        case label_L1_addr_L2_ ## tag2:  return translateDoubleLoad (MODE_ADDR, operands[0], mode2, operands[n2]);
+
+        DOUBLE_LOAD_CASES(const, MODE_CONST, 1)
+        DOUBLE_LOAD_CASES(stack, MODE_STACK, 0)
+        DOUBLE_LOAD_CASES(local, MODE_LOCAL, 1)
+        DOUBLE_LOAD_CASES(addr,  MODE_ADDR,  1)
+
+#define STORE_CASES(n) \
+        case label_S ## n ## _stack: return translateStore (n, MODE_STACK, 0);           \
+        case label_S ## n ## _local: return translateStore (n, MODE_LOCAL, operands[0]); \
+        case label_S ## n ## _addr:  return translateStore (n, MODE_ADDR, operands[0]);
+
+        STORE_CASES(1) STORE_CASES(2)
+
+        case label_L1_addr16: return translateSmallLoad (2, operands[0]);
+        case label_L1_addr8:  return translateSmallLoad (1, operands[0]);
+        case label_S1_addr16: return translateSmallStore (2, operands[0]);
+        case label_S1_addr8:  return translateSmallStore (1, operands[0]);
+
+#define ARITH_CASES(op) \
+        case label_ ## op ## _discard:  return translateArith (label_ ## op ## _discard, MODE_DISCARD, 0);          \
+        case label_ ## op ## _S1_stack: return translateArith (label_ ## op ## _discard, MODE_STACK, 0);            \
+        case label_ ## op ## _S1_local: return translateArith (label_ ## op ## _discard, MODE_LOCAL, operands[0]);  \
+        case label_ ## op ## _S1_addr:  return translateArith (label_ ## op ## _discard, MODE_ADDR, operands[0]);
+
+        ARITH_OPS(ARITH_CASES)
+
+#define ARRAY_STORE_CASES(op) \
+        case label_ ## op:              return translateArrayStore (label_ ## op, MODE_NONE, 0);           \
+        case label_ ## op ## _L3_const: return translateArrayStore (label_ ## op, MODE_CONST, operands[0]); \
+        case label_ ## op ## _L3_stack: return translateArrayStore (label_ ## op, MODE_STACK, 0);           \
+        case label_ ## op ## _L3_local: return translateArrayStore (label_ ## op, MODE_LOCAL, operands[0]); \
+        case label_ ## op ## _L3_addr:  return translateArrayStore (label_ ## op, MODE_ADDR, operands[0]);
+
+        ARRAY_STORE_CASES(astore) ARRAY_STORE_CASES(astores) ARRAY_STORE_CASES(astoreb)
+
+#define BRANCH_CASES(op) \
+        case label_ ## op ## _var:     return translateBranch (label_ ## op ## _by, BRANCH_VAR, operands);     \
+        case label_ ## op ## _const:   return translateBranch (label_ ## op ## _by, BRANCH_CONST, operands);   \
+        case label_ ## op ## _by:      return translateBranch (label_ ## op ## _by, BRANCH_BY, operands);      \
+        case label_ ## op ## _return0: return translateBranch (label_ ## op ## _by, BRANCH_RETURN0, operands); \
+        case label_ ## op ## _return1: return translateBranch (label_ ## op ## _by, BRANCH_RETURN1, operands);
+
+        INT_BRANCH_OPS(BRANCH_CASES)
+
+        case label_args_0: return translateArgs (0);
+        case label_args_1: return translateArgs (1);
+        case label_args_2: return translateArgs (2);
+        case label_args_3: return translateArgs (3);
+
+        case label_stkcount:
+            emitRegReg (1, OP_STORE, REG_SP, RAX);
+            emitAlu (1, OP_SUB, RAX, REG_VALUES);
+            emitShiftImm (1, EXT_SAR, RAX, 2);
+            emitMov (R8, RAX);
+            return 1;
+
+#define SUPEROP(name, prev, next, prevOperands, body) \
+        case label_ ## name: return translateSuperop (label_ ## prev, label_ ## next, prevOperands, operands);
+#include "superops.inc"
+#undef SUPEROP
+
+        default:
+            return 0;
+    }
+}
+
+// Number of operand words following a label in the threaded code.
+// This has to agree with the number of READ_PCs in terp.c.
+static int operandCount (Label label)
+{
+    switch (label)
+    {
+        case label_debug_step:
+            return 2;
+
+#define STUB_COUNTS(stub) \
+        case label_ ## stub ## _discard: case label_ ## stub ## _stack: return 1; \
+        case label_ ## stub ## _addr:    case label_ ## stub ## _local: return 2;
+
+        STUB_COUNTS(args_stack_call_stub)
+        STUB_COUNTS(call_stub)
+        STUB_COUNTS(catch_stub)
+        STUB_COUNTS(save_stub)
+        STUB_COUNTS(undo_stub)
+
+#define LOAD_COUNTS(reg) \
+        case label_ ## reg ## _const: case label_ ## reg ## _local: case label_ ## reg ## _addr: return 1;
+
+        LOAD_COUNTS(L1) LOAD_COUNTS(L2) LOAD_COUNTS(L3) LOAD_COUNTS(L4)
+        LOAD_COUNTS(L5) LOAD_COUNTS(L6) LOAD_COUNTS(L7)
+
+        case label_S1_local: case label_S1_addr:
+        case label_S2_local: case label_S2_addr:
+            return 1;
+
+#define DOUBLE_LOAD_COUNTS(tag2, n2) \
+        case label_L1_const_L2_ ## tag2: case label_L1_local_L2_ ## tag2: \
+        case label_L1_addr_L2_ ## tag2: return 1 + n2;                    \
+        case label_L1_stack_L2_ ## tag2: return n2;
+
+        DOUBLE_LOAD_COUNTS(const, 1)
+        DOUBLE_LOAD_COUNTS(stack, 0)
+        DOUBLE_LOAD_COUNTS(local, 1)
+        DOUBLE_LOAD_COUNTS(addr,  1)
+
+        case label_L1_addr16: case label_L1_addr8:
+        case label_S1_addr16: case label_S1_addr8:
+            return 1;
+
+#define PEEPHOLE_STORE_COUNTS(op) \
+        case label_ ## op ## _S1_local: case label_ ## op ## _S1_addr: return 1;
+
+        STORE_OPS(PEEPHOLE_STORE_COUNTS)
+
+#define PEEPHOLE_LOAD_COUNTS(op, reg) \
+        case label_ ## op ## _ ## reg ## _const: case label_ ## op ## _ ## reg ## _local: \
+        case label_ ## op ## _ ## reg ## _addr: return 1;
+
+        PEEPHOLE_LOAD_COUNTS(return, L1)
+        PEEPHOLE_LOAD_COUNTS(astore, L3)
+        PEEPHOLE_LOAD_COUNTS(astores, L3)
+        PEEPHOLE_LOAD_COUNTS(astoreb, L3)
+        PEEPHOLE_LOAD_COUNTS(astorebit, L3)
+
+#define BRANCH_COUNTS(op) \
+        case label_ ## op ## _var: case label_ ## op ## _const: case label_ ## op ## _by: return 1;
+
+        BRANCH_OPS(BRANCH_COUNTS)
+
+        case label_streamchar: case label_streamunichar:
+        case label_streamstr: case label_streamnum:
+        case label_recompile: case label_error_bad_opcode:
+            return 1;
+
+#define SUPEROP(name, prev, next, prevOperands, body) \
+        case label_ ## name: return prevOperands + operandCount (label_ ## next);
+#include "superops.inc"
+#undef SUPEROP
+
+        default:
+            return 0;
+    }
+}
+
+// -------------------------------------------------------------
+// Translating blocks
+
+#ifdef USE_DIRECT_THREADING
+static int compareOpcodes (const void * a, const void * b)
+{
+    git_uint32 x = ((const OpcodeLabel*) a)->opcode;
+    git_uint32 y = ((const OpcodeLabel*) b)->opcode;
+    return (x > y) - (x < y);
+}
+#endif
+
+// Returns MAX_LABEL if the opcode isn't recognised.
+static Label opcodeToLabel (git_uint32 opcode)
+{
+#ifdef USE_DIRECT_THREADING
+    OpcodeLabel key, * found;
+    key.opcode = opcode;
+    found = bsearch (&key, sOpcodeLabels, MAX_LABEL, sizeof(OpcodeLabel), compareOpcodes);
+    return found ? found->label : MAX_LABEL;
+#else
+    return opcode < MAX_LABEL ? (Label) opcode : MAX_LABEL;
+#endif
+}
+
+static Op * findOp (git_uint32 * pc)
+{
+    int lower = 0;
+    int upper = sNumOps;
+    while (upper > lower)
+    {
+        int guess = (lower + upper) / 2;
+        if (sOps [guess].pc == pc)
+            return sOps + guess;
+        else if (sOps [guess].pc < pc)
+            lower = guess + 1;
+        else
+            upper = guess;
+    }
+    return NULL;
+}
+
+// Split the block's threaded code into labels. Returns 0 if it
+// couldn't be parsed, which shouldn't happen.
+static int decodeBlock (BlockHeader * header)
+{
+    git_uint32 * pc = (git_uint32*) (header + 1);
+    git_uint32 * end = (git_uint32*) header + header->compiledSize
+        - header->numHashNodes * (sizeof(HashNode) / 4);
+    HashNode * node = (HashNode*) end;
+    git_uint32 i;
+
+    sNumOps = 0;
+    while (pc < end)
+    {
+        Label label = opcodeToLabel (*pc);
+        if (label == MAX_LABEL)
+            return 0;
+
+        if (sNumOps == sMaxOps)
+        {
+            sMaxOps = sMaxOps ? sMaxOps * 2 : 1024;
+            sOps = realloc (sOps, sMaxOps * sizeof(Op));
+            if (sOps == NULL)
+                fatalError ("Couldn't allocate native code buffer");
+        }
+
+        sOps [sNumOps].pc = pc;
+        sOps [sNumOps].label = label;
+        sOps [sNumOps].code = NULL;
+        sOps [sNumOps].isNative = 0;
+        sOps [sNumOps].isEntry = 0;
+        ++sNumOps;
+
+        pc += 1 + operandCount (label);
+    }
+
+    if (pc != end)
+        return 0;
+
+    // The hash nodes tell us where the terp can enter the block.
+
+    for (i = 0 ; i < header->numHashNodes ; ++i)
+    {
+        Op * op = findOp ((git_uint32*)(node + i) + node[i].codeOffset);
+        if (op == NULL)
+            return 0;
+        op->isEntry = 1;
+    }
+
+    return 1;
+}
+
+// Returns 0 if the region is full.
+static int translateBlock (BlockHeader * header)
+{
+    git_uint8 * start = sRegionTop;
+    NativeBlock * block;
+    git_uint32 * volatile lastExitTarget = NULL;
+    git_uint8 * volatile lastExitCode = NULL;
+    int i;
+
+    if (setjmp (sJumpBuf))
+    {
+        sRegionTop = start;
+        return 0;
+    }
+
+    if (!decodeBlock (header))
+    {
+        header->nativeCode = NATIVE_NONE;
+        return 1;
+    }
+
+    // Leave room for the entry points ahead of the code.
+
+    sRegionTop = (git_uint8*) (((uintptr_t) sRegionTop + 7) & ~(uintptr_t) 7);
+    reserve (sizeof(NativeBlock) + header->numHashNodes * sizeof(NativeEntry));
+    block = (NativeBlock*) sRegionTop;
+    sRegionTop += sizeof(NativeBlock) + header->numHashNodes * sizeof(NativeEntry);
+
+    // Translate each label in turn. Anything we can't translate
+    // just returns to the terp.
+
+    sNumFixups = 0;
+    for (i = 0 ; i < sNumOps ; ++i)
+    {
+        Op * op = sOps + i;
+        int numFixups = sNumFixups;
+
+        reserve (MAX_OP_SIZE);
+        op->code = sRegionTop;
+        sBailPc = op->pc;
+        op->isNative = translateOp (op->label, op->pc + 1);
+
+        if (!op->isNative)
+        {
+            sRegionTop = op->code;
+            sNumFixups = numFixups;
+            emitExit (op->pc);
+        }
+    }
+
+    // If we fall off the end of the block, return to the terp there.
+
+    reserve (STUB_SIZE);
+    emitExit (sOps [sNumOps - 1].pc + 1 + operandCount (sOps [sNumOps - 1].label));
+
+    // Patch the jumps, adding exits where necessary. Bail-outs from
+    // the same label are adjacent, so they can share an exit.
+
+    for (i = 0 ; i < sNumFixups ; ++i)
+    {
+        Fixup * f = sFixups + i;
+        git_uint8 * dest = NULL;
+        git_sint32 offset;
+
+        if (!f->isExit)
+        {
+            Op * op = findOp (f->target);
+            if (op != NULL)
+                dest = op->code;
+        }
+
+        if (dest == NULL)
+        {
+            if (f->target != lastExitTarget)
+            {
+                reserve (STUB_SIZE);
+                lastExitTarget = f->target;
+                lastExitCode = sRegionTop;
+                emitExit (f->target);
+            }
+            dest = lastExitCode;
+        }
+
+        offset = dest - (f->at + 4);
+        memcpy (f->at, &offset, 4);
+    }
+
+    // Record the entry points.
+
+    block->numEntries = 0;
+    for (i = 0 ; i < sNumOps ; ++i)
+    {
+        if (sOps[i].isEntry && sOps[i].isNative)
+        {
+            NativeEntry * entry = block->entries + block->numEntries++;
+            entry->codeOffset = sOps[i].pc - (git_uint32*) header;
+            entry->nativeOffset = sOps[i].code - sRegion;
+        }
+    }
+
+    if (block->numEntries == 0)
+    {
+        // The terp can never get into this code, so don't keep it.
+        sRegionTop = start;
+        header->nativeCode = NATIVE_NONE;
+    }
+    else
+    {
+        header->nativeCode = (git_uint8*) block - sRegion;
+    }
+    return 1;
+}
+
+// -------------------------------------------------------------
+// Public functions
+
+void initNativeCode ()
+{
+    int n;
+
+    if (sRegion == NULL)
+    {
+        sRegion = mmap (NULL, REGION_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (sRegion == MAP_FAILED)
+        {
+            // We can't generate code on this system. That's OK, the terp
+            // will do everything.
+            sRegion = NULL;
+            gNativeCode = 0;
+            return;
+        }
+    }
+    sRegionTop = sRegion;
+
+#ifdef USE_DIRECT_THREADING
+    for (n = 0 ; n < MAX_LABEL ; ++n)
+    {
+        sOpcodeLabels [n].opcode = (git_uint32) labelToOpcode (n);
+        sOpcodeLabels [n].label = n;
+    }
+    qsort (sOpcodeLabels, MAX_LABEL, sizeof(OpcodeLabel), compareOpcodes);
+#endif
+
+    // Entry code: sEnter (state, code) loads the registers and jumps to code.
+
+    sEnter = (NativeEnter) (void*) sRegionTop;
+    emitPush (RBX);
+    emitPush (R12);
+    emitPush (R13);
+    emitPush (R14);
+    emitPush (R15);
+    emitRegReg (1, OP_STORE, RSI, RAX);
+    for (n = 1 ; n <= 3 ; ++n)
+        emitRegMem (0, OP_LOAD, REG_L(n), REG_STATE, OFFSET_L(n));
+    emitRegMem (1, OP_LOAD, REG_SP, REG_STATE, offsetof (NativeState, sp));
+    emitRegMem (1, OP_LOAD, REG_LOCALS, REG_STATE, offsetof (NativeState, locals));
+    emitRegMem (1, OP_LOAD, REG_VALUES, REG_STATE, offsetof (NativeState, values));
+    emitRegMem (1, OP_LOAD, REG_TOP, REG_STATE, offsetof (NativeState, top));
+    emitRegMem (1, OP_LOAD, REG_MEM, REG_STATE, offsetof (NativeState, mem));
+    emitRegMem (0, OP_LOAD, REG_ENDMEM, REG_STATE, offsetof (NativeState, endMem));
+    emitRegMem (0, OP_LOAD, REG_RAMSTART, REG_STATE, offsetof (NativeState, ramStart));
+    emitByte (0xFF); // jmp rax
+    emitByte (0xE0);
+
+    // Exit code: saves the registers and returns the threaded code in RAX.
+
+    sExitCode = sRegionTop;
+    for (n = 1 ; n <= 3 ; ++n)
+        emitRegMem (0, OP_STORE, REG_L(n), REG_STATE, OFFSET_L(n));
+    emitRegMem (1, OP_STORE, REG_SP, REG_STATE, offsetof (NativeState, sp));
+    emitPop (R15);
+    emitPop (R14);
+    emitPop (R13);
+    emitPop (R12);
+    emitPop (RBX);
+    emitByte (0xC3); // ret
+
+    sFirstFree = sRegionTop;
+}
+
+void shutdownNativeCode ()
+{
+    if (sRegion != NULL)
+        munmap (sRegion, REGION_SIZE);
+    sRegion = sRegionTop = sFirstFree = sExitCode = NULL;
+
+    free (sOps);
+    sOps = NULL;
+    sNumOps = sMaxOps = 0;
+
+    free (sFixups);
+    sFixups = NULL;
+    sNumFixups = sMaxFixups = 0;
+}
+
+void resetNativeCode ()
+{
+    sRegionTop = sFirstFree;
+}
+
+NativeCode getNativeCode (Block pc)
+{
+    BlockHeader * header = gBlockHeader;
+    NativeBlock * block;
+    git_uint32 offset, lower, upper;
+
+    if (sRegion == NULL)
+        return NULL;
+
+    if (header->nativeCode == 0 && !translateBlock (header))
+    {
+        // The region is full. Throw everything away and start again.
+        forgetNativeCode ();
+        if (!translateBlock (header))
+            header->nativeCode = NATIVE_NONE;
+    }
+
+    if (header->nativeCode == NATIVE_NONE)
+        return NULL;
+
+    block = (NativeBlock*) (sRegion + header->nativeCode);
+    offset = pc - (git_uint32*) header;
+
+    lower = 0;
+    upper = block->numEntries;
+    while (upper > lower)
+    {
+        git_uint32 guess = (lower + upper) / 2;
+        NativeEntry * entry = block->entries + guess;
+        if (entry->codeOffset == offset)
+            return sRegion + entry->nativeOffset;
+        else if (entry->codeOffset < offset)
+            lower = guess + 1;
+        else
+            upper = guess;
+    }
+    return NULL;
+}
+
+Block runNativeCode (NativeCode code, NativeState * state)
+{
+    state->mem = gMem;
+    state->endMem = gEndMem;
+    state->ramStart = gRamStart;
+    return sEnter (state, code);
+}
+
+#endif // USE_NATIVE_CODE
@@ -2,14 +2,99 @@
 // Peephole optimiser for git
 
 #include "git.h"
+#include <assert.h>
 
-static Label sLastOp;
+static Label sLastOp;   // The last label emitted.
+static Block sLastCode; // Where it was emitted.
+static Label sPrevOp;   // The label emitted before that.
+static Block sPrevCode; // Where it was emitted.
 
 extern void resetPeepholeOptimiser ()
 {
-    sLastOp = label_nop;
+    sLastOp = sPrevOp = label_nop;
+    sLastCode = sPrevCode = NULL;
 }
 
+// Superinstructions generated by superops.py. Each one replaces
+// a pair of labels, so that 'prev' is immediately followed by
+// 'next' without going back to the dispatch loop. The operands
+// stay where they were, so we just have to rewrite 'prev'.
+
+typedef struct
+{
+    Label prev;
+    Label next;
+    Label op;
+} Superop;
+
+#ifndef USE_LABEL_PROFILE
+
+static const Superop sSuperops [] = {
+#define SUPEROP(name, prev, next, prevOperands, body) \
+    { label_ ## prev, label_ ## next, label_ ## name },
+#include "superops.inc"
+#undef SUPEROP
+    { label_nop, label_nop, label_nop }
+};
+
+// The compiler calls emitCode() a lot, so we look the pairs
+// up in a hash table. Empty slots have label_nop in them.
+
+#define SUPEROP_HASH_SIZE 256 // Must be a power of two.
+#define SUPEROP_HASH(prev, next) (((prev) * 31 + (next)) & (SUPEROP_HASH_SIZE - 1))
+
+static Superop sSuperopHash [SUPEROP_HASH_SIZE];
+static int sSuperopHashReady = 0;
+
+static void buildSuperopHash ()
+{
+    const Superop * s;
+    int i;
+
+    assert (sizeof(sSuperops) / sizeof(sSuperops[0]) <= SUPEROP_HASH_SIZE / 2);
+
+    for (i = 0 ; i < SUPEROP_HASH_SIZE ; ++i)
+        sSuperopHash[i].op = label_nop;
+
+    for (s = sSuperops ; s->op != label_nop ; ++s)
+    {
+        i = SUPEROP_HASH (s->prev, s->next);
+        while (sSuperopHash[i].op != label_nop)
+            i = (i + 1) & (SUPEROP_HASH_SIZE - 1);
+        sSuperopHash[i] = *s;
+    }
+
+    sSuperopHashReady = 1;
+}
+
+static Label findSuperop (Label prev, Label next)
+{
+    int i;
+
+    if (!sSuperopHashReady)
+        buildSuperopHash ();
+
+    i = SUPEROP_HASH (prev, next);
+    while (sSuperopHash[i].op != label_nop)
+    {
+        if (sSuperopHash[i].prev == prev && sSuperopHash[i].next == next)
+            return sSuperopHash[i].op;
+        i = (i + 1) & (SUPEROP_HASH_SIZE - 1);
+    }
+    return label_nop;
+}
+
+#else
+
+// When we're profiling, we want to see the pairs of labels
+// that the superinstructions would replace.
+static Label findSuperop (Label prev, Label next)
+{
+    return label_nop;
+}
+
+#endif // USE_LABEL_PROFILE
+
 #define REPLACE_SINGLE(lastOp,thisOp,newOp) \
     case label_ ## thisOp:                  \
         if (sLastOp == label_ ## lastOp)    \
@@ -85,6 +170,7 @@ extern void resetPeepholeOptimiser ()
 extern void emitCode (Label op)
 {
     git_uint32 temp;
+    Label superop;
 
     if (gPeephole)
     {
@@ -112,6 +198,16 @@ extern void emitCode (Label op)
             
             default: break;
         }
+
+        // The previous label's operands are already in place,
+        // so the new label's operands will follow them directly.
+        superop = findSuperop (sLastOp, op);
+        if (superop != label_nop)
+        {
+            *sLastCode = (git_uint32) labelToOpcode (superop);
+            sLastOp = superop;
+            return;
+        }
     }
     goto noPeephole;
 
@@ -120,16 +216,175 @@ replaceOneOperand:
     // we have to go back two steps to update it.
     temp = undoEmit();  // Save the operand.
     undoEmit();         // Remove the old opcode.
+    superop = findSuperop (sPrevOp, op);
+    if (superop != label_nop)
+    {
+        // Merge the new opcode into the one before.
+        *sPrevCode = (git_uint32) labelToOpcode (superop);
+        emitData (temp);
+        goto merged;
+    }
     emitFinalCode (op); // Emit the new opcode.
     emitData (temp);    // Emit the operand again.
     goto done;
 
 replaceNoOperands:
     undoEmit();
-    // ... fall through
+    superop = findSuperop (sPrevOp, op);
+    if (superop != label_nop)
+    {
+        *sPrevCode = (git_uint32) labelToOpcode (superop);
+        goto merged;
+    }
+    emitFinalCode (op);
+    goto done;
+
 noPeephole:
+    sPrevOp = sLastOp;
+    sPrevCode = sLastCode;
+    sLastCode = peekAtEmittedStuff (0);
     emitFinalCode (op);
     // ... fall through
 done:
     sLastOp = op;
+    return;
+
+merged:
+    sLastOp = superop;
+    sLastCode = sPrevCode;
+    sPrevOp = label_nop;
+    sPrevCode = NULL;
+}
+
+// -------------------------------------------------------------
+// Label profiling
+
+#ifdef USE_LABEL_PROFILE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+const char * gLabelProfile = NULL; // File to write the profile to.
+
+#define TRIPLE_TABLE_SIZE 0x10000 // Must be a power of two.
+#define MAX_TRIPLES (TRIPLE_TABLE_SIZE / 4 * 3)
+
+typedef struct
+{
+    Label a, b, c;
+    unsigned long count;
+} Triple;
+
+static unsigned long * sPairs;  // MAX_LABEL x MAX_LABEL counts.
+static Triple * sTriples;       // Hash table of triples.
+static git_uint32 sNumTriples;
+static unsigned long sLostTriples;
+static Label sLabel1, sLabel2;  // The last two labels run.
+
+void initLabelProfile ()
+{
+    sPairs = calloc ((size_t) MAX_LABEL * MAX_LABEL, sizeof(unsigned long));
+    sTriples = calloc (TRIPLE_TABLE_SIZE, sizeof(Triple));
+    if (sPairs == NULL || sTriples == NULL)
+        fatalError ("Couldn't allocate label profile");
+
+    sNumTriples = 0;
+    sLostTriples = 0;
+    sLabel1 = sLabel2 = MAX_LABEL;
 }
+
+void profileLabel (Label label)
+{
+    git_uint32 hash;
+    Triple * t;
+
+    if (sPairs == NULL)
+        return;
+
+    // Superinstructions can't cross from one glulx instruction
+    // to the next, so start again at each debug_step.
+
+    if (label == label_debug_step)
+    {
+        sLabel1 = sLabel2 = MAX_LABEL;
+        return;
+    }
+
+    if (sLabel2 != MAX_LABEL)
+        ++sPairs [sLabel2 * MAX_LABEL + label];
+
+    if (sLabel1 != MAX_LABEL)
+    {
+        hash = ((sLabel1 * MAX_LABEL + sLabel2) * MAX_LABEL + label) * 2654435761u;
+        hash = (hash >> 16) & (TRIPLE_TABLE_SIZE - 1);
+
+        for (t = sTriples + hash ; t->count != 0 ; t = sTriples + hash)
+        {
+            if (t->a == sLabel1 && t->b == sLabel2 && t->c == label)
+                break;
+            hash = (hash + 1) & (TRIPLE_TABLE_SIZE - 1);
+        }
+
+        if (t->count != 0)
+            ++t->count;
+        else if (sNumTriples < MAX_TRIPLES)
+        {
+            t->a = sLabel1;
+            t->b = sLabel2;
+            t->c = label;
+            t->count = 1;
+            ++sNumTriples;
+        }
+        else
+            ++sLostTriples;
+    }
+
+    sLabel1 = sLabel2;
+    sLabel2 = label;
+}
+
+void writeLabelProfile ()
+{
+    FILE * file;
+    int a, b;
+    git_uint32 i;
+
+    if (sPairs == NULL || gLabelProfile == NULL)
+        return;
+
+    file = fopen (gLabelProfile, "w");
+    if (file == NULL)
+        fatalError ("Couldn't write label profile");
+
+    // One line per sequence: the count, then the labels.
+
+    for (a = 0 ; a < MAX_LABEL ; ++a)
+    {
+        for (b = 0 ; b < MAX_LABEL ; ++b)
+        {
+            if (sPairs [a * MAX_LABEL + b] != 0)
+                fprintf (file, "%lu %s %s\n", sPairs [a * MAX_LABEL + b],
+                    gLabelNames [a], gLabelNames [b]);
+        }
+    }
+
+    for (i = 0 ; i < TRIPLE_TABLE_SIZE ; ++i)
+    {
+        Triple * t = sTriples + i;
+        if (t->count != 0)
+            fprintf (file, "%lu %s %s %s\n", t->count,
+                gLabelNames [t->a], gLabelNames [t->b], gLabelNames [t->c]);
+    }
+
+    if (sLostTriples != 0)
+        fprintf (file, "# %lu triples didn't fit in the table\n", sLostTriples);
+
+    fclose (file);
+
+    free (sPairs);
+    free (sTriples);
+    sPairs = NULL;
+    sTriples = NULL;
+}
+
+#endif // USE_LABEL_PROFILE
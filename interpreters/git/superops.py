@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+
+# Generates superops.inc, the list of superinstructions that Git's peephole
+# optimiser uses. Each superinstruction is a label that does the work of two
+# or three labels that often run one after the other in the same glulx
+# instruction, saving a trip through the dispatch loop.
+#
+# To regenerate the list, build Git with USE_LABEL_PROFILE defined, run some
+# games to the end with the --profile option, then pass the profiles to this
+# script. Run it from this directory:
+#
+#   git --profile game1.prof game1.gblorb
+#   git --profile game2.prof game2.ulx
+#   python3 superops.py game1.prof game2.prof > superops.inc
+
+import argparse
+import re
+import sys
+
+LOAD_MODES = '(const|stack|local|addr)'
+STORE_MODES = '(stack|local|addr)'
+
+# Labels that the hand-written rules in peephole.c merge with the label that
+# follows them. They can't be the second half of a superinstruction, or the
+# hand-written rule would never see them.
+HAND_PREFIXES = [
+    r'args_stack',
+    r'L[13]_' + LOAD_MODES,
+    r'\w+_discard',
+]
+
+# Labels that aren't emitted through emitCode(), or that never run in the
+# middle of an instruction.
+UNMERGEABLE = [
+    r'\w+_by',
+    r'\w+_const',
+    r'debug_step',
+    r'recompile',
+    r'error_bad_opcode',
+    r'jump_abs_L7',
+    r'enter_function_L1',
+]
+
+
+def matches(patterns, label):
+    return any(re.fullmatch(p, label) for p in patterns)
+
+
+def parts(label):
+    """Split a label into the operand loads and stores that make it up.
+    Returns a list of (macro, register, operands) tuples, or None if the
+    label does anything else."""
+    m = re.fullmatch(r'(L[1-7])_' + LOAD_MODES, label)
+    if m:
+        return [('LOAD_' + m[2], m[1], 0 if m[2] == 'stack' else 1)]
+    m = re.fullmatch(r'L1_(addr16|addr8)', label)
+    if m:
+        return [('LOAD_' + m[1], 'L1', 1)]
+    m = re.fullmatch(r'L1_{0}_L2_{0}'.format(LOAD_MODES), label)
+    if m:
+        return parts('L1_' + m[1]) + parts('L2_' + m[2])
+    m = re.fullmatch(r'(S[12])_' + STORE_MODES, label)
+    if m:
+        return [('STORE_' + m[2], m[1], 0 if m[2] == 'stack' else 1)]
+    m = re.fullmatch(r'S1_(addr16|addr8)', label)
+    if m:
+        return [('STORE_' + m[1], 'S1', 1)]
+    return None
+
+
+def can_follow(label):
+    if matches(HAND_PREFIXES, label):
+        return False
+    if matches(UNMERGEABLE, label):
+        return parts(label) is not None
+    return True
+
+
+def read_profiles(filenames):
+    pairs = {}
+    triples = {}
+    for filename in filenames:
+        with open(filename) as f:
+            for line in f:
+                if line.startswith('#'):
+                    continue
+                count, *labels = line.split()
+                table = pairs if len(labels) == 2 else triples
+                key = tuple(labels)
+                table[key] = table.get(key, 0) + int(count)
+    return pairs, triples
+
+
+def choose(pairs, triples, limit):
+    """Pick the sequences that would save the most dispatches. A triple is
+    built on top of the superinstruction for its first two labels, so it
+    can only be used if that pair has already been picked."""
+    candidates = []
+    for (a, b), count in pairs.items():
+        if parts(a) is not None and can_follow(b):
+            candidates.append((count, (a, b)))
+    for (a, b, c), count in triples.items():
+        if parts(a) is not None and parts(b) is not None and \
+                can_follow(b) and can_follow(c):
+            candidates.append((count, (a, b, c)))
+
+    candidates.sort(key=lambda c: (-c[0], c[1]))
+    chosen = []
+    picked = set()
+    for count, labels in candidates:
+        if len(chosen) == limit:
+            break
+        if len(labels) == 3 and labels[:2] not in picked:
+            continue
+        picked.add(labels)
+        chosen.append((count, labels))
+    return chosen
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('profiles', nargs='+',
+                        help='label profiles written by git --profile')
+    parser.add_argument('--count', type=int, default=48,
+                        help='number of superinstructions (default 48)')
+    args = parser.parse_args()
+
+    pairs, triples = read_profiles(args.profiles)
+    chosen = choose(pairs, triples, args.count)
+    total = sum(pairs.values())
+
+    print('// Superinstructions for the peephole optimiser.')
+    print('// Generated by superops.py from {} label profile(s). Do not edit.'
+          .format(len(args.profiles)))
+    print('//')
+    print('// SUPEROP (name, prev, next, prevOperands, body) replaces label')
+    print('// "prev" followed by label "next" with "name", which runs "body"')
+    print('// (the code for "prev") and then carries on at "next".')
+    print()
+    for count, labels in chosen:
+        prev = '_'.join(labels[:-1])
+        steps = [p for label in labels[:-1] for p in parts(label)]
+        body = '; '.join('{} ({})'.format(macro, reg)
+                         for macro, reg, _ in steps)
+        operands = sum(n for _, _, n in steps)
+        share = 100.0 * count / total if total else 0
+        print('SUPEROP ({}_{}, {}, {}, {}, {}) // {:.2f}%'.format(
+            prev, labels[-1], prev, labels[-1], operands, body, share))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
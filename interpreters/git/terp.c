@@ -230,6 +230,11 @@ void startProgram (size_t cacheSize)
 
     acceleration_func accelfunc;
 
+#ifdef USE_NATIVE_CODE
+    NativeState native;
+    NativeCode nativeCode;
+#endif
+
     // Initialise the code cache.
 
 #ifdef USE_DIRECT_THREADING
@@ -274,6 +279,9 @@ void startProgram (size_t cacheSize)
 #define NEXT goto next
 //#define NEXT do { CHECK_USED(0); CHECK_FREE(0); goto next; } while (0)
 next:
+#ifdef USE_LABEL_PROFILE
+    profileLabel (*pc);
+#endif
     switch (*pc++)
     {
 #define LABEL(foo) case label_ ## foo: goto do_ ## foo;
@@ -294,11 +302,27 @@ do_debug_step:
 //    fprintf (stdout, "\n");
     NEXT;
 
-#define LOAD_INSTRUCTIONS(reg)                                  \
-    do_ ## reg ## _const:   reg = READ_PC; NEXT;                \
-    do_ ## reg ## _stack:   CHECK_USED(1); reg = POP; NEXT;     \
-    do_ ## reg ## _addr:    reg = memRead32 (READ_PC); NEXT;    \
-    do_ ## reg ## _local:   reg = LOCAL (READ_PC); NEXT
+// The code for each operand mode. The superinstructions
+// in superops.inc are built out of these.
+
+#define LOAD_const(reg)     reg = READ_PC
+#define LOAD_stack(reg)     CHECK_USED(1); reg = POP
+#define LOAD_addr(reg)      reg = memRead32 (READ_PC)
+#define LOAD_addr16(reg)    reg = memRead16 (READ_PC)
+#define LOAD_addr8(reg)     reg = memRead8 (READ_PC)
+#define LOAD_local(reg)     reg = LOCAL (READ_PC)
+
+#define STORE_stack(reg)    CHECK_FREE(1); PUSH(reg)
+#define STORE_addr(reg)     memWrite32 (READ_PC, reg)
+#define STORE_addr16(reg)   memWrite16 (READ_PC, reg)
+#define STORE_addr8(reg)    memWrite8 (READ_PC, reg)
+#define STORE_local(reg)    LOCAL (READ_PC) = reg
+
+#define LOAD_INSTRUCTIONS(reg)                          \
+    do_ ## reg ## _const:   LOAD_const (reg); NEXT;     \
+    do_ ## reg ## _stack:   LOAD_stack (reg); NEXT;     \
+    do_ ## reg ## _addr:    LOAD_addr (reg); NEXT;      \
+    do_ ## reg ## _local:   LOAD_local (reg); NEXT
 
     LOAD_INSTRUCTIONS(L1);
     LOAD_INSTRUCTIONS(L2);
@@ -308,19 +332,19 @@ do_debug_step:
     LOAD_INSTRUCTIONS(L6);
     LOAD_INSTRUCTIONS(L7);
 
-#define STORE_INSTRUCTIONS(reg)                                 \
-    do_ ## reg ## _stack:   CHECK_FREE(1); PUSH(reg); NEXT;     \
-    do_ ## reg ## _addr:    memWrite32 (READ_PC, reg); NEXT;    \
-    do_ ## reg ## _local:   LOCAL (READ_PC) = reg; NEXT
+#define STORE_INSTRUCTIONS(reg)                         \
+    do_ ## reg ## _stack:   STORE_stack (reg); NEXT;    \
+    do_ ## reg ## _addr:    STORE_addr (reg); NEXT;     \
+    do_ ## reg ## _local:   STORE_local (reg); NEXT
 
     STORE_INSTRUCTIONS(S1);
     STORE_INSTRUCTIONS(S2);
 
 #define DOUBLE_LOAD(mode2) \
-    do_L1_const_L2_ ## mode2: L1 = READ_PC;             goto do_L2_ ## mode2; \
-    do_L1_stack_L2_ ## mode2: CHECK_USED(1); L1 = POP;  goto do_L2_ ## mode2; \
-    do_L1_local_L2_ ## mode2: L1 = LOCAL (READ_PC);     goto do_L2_ ## mode2; \
-    do_L1_addr_L2_ ## mode2:  L1 = memRead32 (READ_PC); goto do_L2_ ## mode2
+    do_L1_const_L2_ ## mode2: LOAD_const (L1); goto do_L2_ ## mode2; \
+    do_L1_stack_L2_ ## mode2: LOAD_stack (L1); goto do_L2_ ## mode2; \
+    do_L1_local_L2_ ## mode2: LOAD_local (L1); goto do_L2_ ## mode2; \
+    do_L1_addr_L2_ ## mode2:  LOAD_addr (L1);  goto do_L2_ ## mode2
 
     DOUBLE_LOAD(const);
     DOUBLE_LOAD(stack);
@@ -331,10 +355,18 @@ do_debug_step:
 #undef STORE_INSTRUCTIONS
 #undef DOUBLE_LOAD
 
-do_L1_addr16: L1 = memRead16 (READ_PC); NEXT; 
-do_L1_addr8:  L1 = memRead8 (READ_PC); NEXT;
-do_S1_addr16: memWrite16 (READ_PC, S1); NEXT;
-do_S1_addr8:  memWrite8 (READ_PC, S1); NEXT;
+do_L1_addr16: LOAD_addr16 (L1); NEXT;
+do_L1_addr8:  LOAD_addr8 (L1); NEXT;
+do_S1_addr16: STORE_addr16 (S1); NEXT;
+do_S1_addr8:  STORE_addr8 (S1); NEXT;
+
+    // Superinstructions: run the code for the first label,
+    // then carry on with the second without dispatching.
+
+#define SUPEROP(name, prev, next, prevOperands, body) \
+    do_ ## name: body; goto do_ ## next;
+#include "superops.inc"
+#undef SUPEROP
 
 #define UL7 ((git_uint32)L7)
 
@@ -344,6 +376,28 @@ do_recompile:
 	
 do_jump_abs_L7:
     pc = getCode (UL7);
+#ifdef USE_NATIVE_CODE
+    if (gBlockHeader->runCounter >= NATIVE_THRESHOLD && gNativeCode)
+    {
+        nativeCode = getNativeCode (pc);
+        if (nativeCode != NULL)
+        {
+            native.L[1] = L1; native.L[2] = L2; native.L[3] = L3; native.L[4] = L4;
+            native.L[5] = L5; native.L[6] = L6; native.L[7] = L7;
+            native.sp = sp;
+            native.locals = locals;
+            native.values = values;
+            native.top = top;
+            native.args = args;
+
+            pc = runNativeCode (nativeCode, &native);
+
+            L1 = native.L[1]; L2 = native.L[2]; L3 = native.L[3]; L4 = native.L[4];
+            L5 = native.L[5]; L6 = native.L[6]; L7 = native.L[7];
+            sp = native.sp;
+        }
+    }
+#endif
     NEXT;
 
 do_enter_function_L1: // Arg count is in L2.
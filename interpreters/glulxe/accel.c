@@ -61,7 +61,30 @@ static accelentry_t **accelentries = NULL;
 
 void init_accel()
 {
+    int bucknum;
+    accelentry_t *ptr, *next;
+
+    /* Drop anything left over from a previous game. */
+    if (accelentries) {
+        for (bucknum=0; bucknum<ACCEL_HASH_SIZE; bucknum++) {
+            for (ptr = accelentries[bucknum]; ptr; ptr = next) {
+                next = ptr->next;
+                glulx_free(ptr);
+            }
+        }
+        glulx_free(accelentries);
+    }
     accelentries = NULL;
+
+    classes_table = 0;
+    indiv_prop_start = 0;
+    class_metaclass = 0;
+    object_metaclass = 0;
+    routine_metaclass = 0;
+    string_metaclass = 0;
+    self = 0;
+    num_attr_bytes = 0;
+    cpv__start = 0;
 }
 
 acceleration_func accel_find_func(glui32 index)
@@ -166,6 +189,7 @@ void accel_set_func(glui32 index, glui32 addr)
 
     ptr->index = index;
     ptr->func = new_func;
+    forget_function(addr);
 }
 
 void accel_set_param(glui32 index, glui32 val)
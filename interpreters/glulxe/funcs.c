@@ -3,54 +3,92 @@
     http://eblong.com/zarf/glulx/index.html
 */
 
+#include <string.h>
+
 #include "glk.h"
 #include "glulxe.h"
 
-/* enter_function():
-   This writes a new call frame onto the stack, at stackptr. It leaves
-   frameptr pointing to the frame (ie, the original stackptr value.) 
-   argc and argv are an array of arguments. Note that if argc is zero,
-   argv may be NULL.
-*/
-void enter_function(glui32 funcaddr, glui32 argc, glui32 *argv)
-{
-  int ix, jx;
+/* The function cache remembers what enter_function() has worked out
+   from the header of each function it calls: the acceleration function
+   (if any), the function type, and the layout of the call frame. It is
+   direct-mapped, keyed on the function address. Only functions whose
+   header lies entirely in ROM are cached, since only those can never
+   change. */
+#define FUNC_CACHE_SIZE (4096)
+
+typedef struct funcheader_struct {
+  glui32 addr; /* zero if the cache entry is empty */
   acceleration_func accelfunc;
-  int locallen;
   int functype;
-  glui32 modeaddr, opaddr, val;
+  glui32 formatlen; /* length of the locals-format list, with terminator */
+  glui32 framelen; /* the same, padded to 4-byte alignment */
+  glui32 locallen; /* length of the locals, including padding */
+  glui32 codeaddr; /* address of the first opcode */
+} funcheader_t;
+
+static funcheader_t *funccache = NULL;
+
+#define FUNC_CACHE_SLOT(addr)  \
+  (((addr) ^ ((addr) >> 12)) & (FUNC_CACHE_SIZE-1))
+
+/* init_funcs():
+   Empty the function cache. This must be called whenever a new game
+   file is loaded.
+*/
+void init_funcs()
+{
+  if (!funccache) {
+    funccache = (funcheader_t *)glulx_malloc(FUNC_CACHE_SIZE
+      * sizeof(funcheader_t));
+    if (!funccache)
+      fatal_error("Cannot malloc function cache.");
+  }
+  memset(funccache, 0, FUNC_CACHE_SIZE * sizeof(funcheader_t));
+}
+
+/* forget_function():
+   Drop the function at addr from the function cache, if it is there.
+   This must be called when the acceleration of a function changes.
+*/
+void forget_function(glui32 addr)
+{
+  funcheader_t *entry;
+
+  if (!funccache)
+    return;
+  entry = &funccache[FUNC_CACHE_SLOT(addr)];
+  if (entry->addr == addr)
+    entry->addr = 0;
+}
+
+/* parse_function_header():
+   Read the type byte and locals-format list of the function at addr,
+   and work out how much space its locals take up. (Including padding.)
+   An accelerated function's locals are never set up, so they are not
+   looked at.
+*/
+static void parse_function_header(glui32 addr, funcheader_t *hdr)
+{
+  int ix;
   int loctype, locnum;
-  glui32 addr = funcaddr;
 
-  accelfunc = accel_get_func(addr);
-  if (accelfunc) {
-    profile_in(addr, stackptr, TRUE);
-    val = accelfunc(argc, argv);
-    profile_out(stackptr);
-    pop_callstub(val);
+  hdr->addr = addr;
+  hdr->accelfunc = accel_get_func(addr);
+  if (hdr->accelfunc)
     return;
-  }
-    
-  profile_in(addr, stackptr, FALSE);
 
   /* Check the Glulx type identifier byte. */
-  functype = Mem1(addr);
-  if (functype != 0xC0 && functype != 0xC1) {
-    if (functype >= 0xC0 && functype <= 0xDF)
+  hdr->functype = Mem1(addr);
+  if (hdr->functype != 0xC0 && hdr->functype != 0xC1) {
+    if (hdr->functype >= 0xC0 && hdr->functype <= 0xDF)
       fatal_error_i("Call to unknown type of function.", addr);
     else
       fatal_error_i("Call to non-function.", addr);
   }
   addr++;
 
-  /* Bump the frameptr to the top. */
-  frameptr = stackptr;
-
-  /* Go through the function's locals-format list, copying it to the
-     call frame. At the same time, we work out how much space the locals
-     will actually take up. (Including padding.) */
   ix = 0;
-  locallen = 0;
+  hdr->locallen = 0;
   while (1) {
     /* Grab two bytes from the locals-format list. These are 
        unsigned (0..255 range). */
@@ -58,33 +96,21 @@ void enter_function(glui32 funcaddr, glui32 argc, glui32 *argv)
     addr++;
     locnum = Mem1(addr);
     addr++;
-
-    /* Copy them into the call frame. */
-    StkW1(frameptr+8+2*ix, loctype);
-    StkW1(frameptr+8+2*ix+1, locnum);
     ix++;
 
-    /* If the type is zero, we're done, except possibly for two more
-       zero bytes in the call frame (to ensure 4-byte alignment.) */
-    if (loctype == 0) {
-      /* Make sure ix is even. */
-      if (ix & 1) {
-        StkW1(frameptr+8+2*ix, 0);
-        StkW1(frameptr+8+2*ix+1, 0);
-        ix++;
-      }
+    /* If the type is zero, we're done. */
+    if (loctype == 0)
       break;
-    }
 
     /* Pad to 4-byte or 2-byte alignment if these locals are 4 or 2
        bytes long. */
     if (loctype == 4) {
-      while (locallen & 3)
-        locallen++;
+      while (hdr->locallen & 3)
+        hdr->locallen++;
     }
     else if (loctype == 2) {
-      while (locallen & 1)
-        locallen++;
+      while (hdr->locallen & 1)
+        hdr->locallen++;
     }
     else if (loctype == 1) {
       /* no padding */
@@ -94,36 +120,85 @@ void enter_function(glui32 funcaddr, glui32 argc, glui32 *argv)
     }
 
     /* Add the length of the locals themselves. */
-    locallen += (loctype * locnum);
+    hdr->locallen += (loctype * locnum);
   }
 
   /* Pad the locals to 4-byte alignment. */
-  while (locallen & 3)
-    locallen++;
+  while (hdr->locallen & 3)
+    hdr->locallen++;
+
+  /* In the call frame, the format list is followed by two more zero
+     bytes if that is needed to ensure 4-byte alignment. */
+  hdr->formatlen = 2*ix;
+  hdr->framelen = (ix & 1) ? 2*ix+2 : 2*ix;
+  hdr->codeaddr = addr;
+}
+
+/* enter_function():
+   This writes a new call frame onto the stack, at stackptr. It leaves
+   frameptr pointing to the frame (ie, the original stackptr value.) 
+   argc and argv are an array of arguments. Note that if argc is zero,
+   argv may be NULL.
+*/
+void enter_function(glui32 funcaddr, glui32 argc, glui32 *argv)
+{
+  int ix;
+  glui32 modeaddr, opaddr, val;
+  int loctype, locnum;
+  funcheader_t localhdr;
+  funcheader_t *hdr;
+  glui32 locallen;
+
+  hdr = &funccache[FUNC_CACHE_SLOT(funcaddr)];
+  if (hdr->addr != funcaddr) {
+    parse_function_header(funcaddr, &localhdr);
+    if (localhdr.accelfunc ? funcaddr < ramstart 
+      : localhdr.codeaddr <= ramstart)
+      *hdr = localhdr;
+    else
+      hdr = &localhdr;
+  }
 
-  /* We now know how long the locals-frame and locals segments are. */
-  localsbase = frameptr+8+2*ix;
+  if (hdr->accelfunc) {
+    profile_in(funcaddr, stackptr, TRUE);
+    val = hdr->accelfunc(argc, argv);
+    profile_out(stackptr);
+    pop_callstub(val);
+    return;
+  }
+    
+  profile_in(funcaddr, stackptr, FALSE);
+
+  /* Bump the frameptr to the top. */
+  frameptr = stackptr;
+
+  /* We know how long the locals-frame and locals segments are. */
+  locallen = hdr->locallen;
+  localsbase = frameptr+8+hdr->framelen;
   valstackbase = localsbase+locallen;
 
   /* Test for stack overflow. */
-  /* This really isn't good enough; if the format list overflowed the
-     stack, we've already written outside the stack array. */
   if (valstackbase >= stacksize)
     fatal_error("Stack overflow in function call.");
 
+  /* Copy the function's locals-format list to the call frame, with
+     its padding. */
+  memcpy(stack+frameptr+8, memmap+funcaddr+1, hdr->formatlen);
+  memset(stack+frameptr+8+hdr->formatlen, 0, 
+    hdr->framelen - hdr->formatlen);
+
   /* Fill in the beginning of the stack frame. */
-  StkW4(frameptr+4, 8+2*ix);
-  StkW4(frameptr, 8+2*ix+locallen);
+  StkW4(frameptr+4, 8+hdr->framelen);
+  StkW4(frameptr, 8+hdr->framelen+locallen);
 
   /* Set the stackptr and PC. */
   stackptr = valstackbase;
-  pc = addr;
+  pc = hdr->codeaddr;
 
   /* Zero out all the locals. */
-  for (jx=0; jx<locallen; jx++) 
-    StkW1(localsbase+jx, 0);
+  memset(stack+localsbase, 0, locallen);
 
-  if (functype == 0xC0) {
+  if (hdr->functype == 0xC0) {
     /* Push the function arguments on the stack. The locals have already
        been zeroed. */
     if (stackptr+4*(argc+1) >= stacksize)
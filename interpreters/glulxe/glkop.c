@@ -183,29 +183,32 @@ int init_dispatch()
   
   /* What with one thing and another, this *could* be called more than
      once. We only need to allocate the tables once. */
-  if (classes)
-      return TRUE;
-  
+  if (!classes) {
+    /* Allocate the class hash tables. */
+    num_classes = gidispatch_count_classes();
+    classes = (classtable_t **)glulx_malloc(num_classes 
+      * sizeof(classtable_t *));
+    if (!classes)
+      return FALSE;
+
+    randish = time(NULL) % 101;
+    for (ix=0; ix<num_classes; ix++) {
+      classes[ix] = new_classtable(1+120*ix+randish);
+      if (!classes[ix])
+        return FALSE;
+    }
+  }
+
+  /* The callbacks are set every time, though. Chimara's persistent
+     plugin mode runs glk_main() again without reloading us, and the
+     library forgets the callbacks between runs. */
+
   /* Set up the game-ID hook. (This is ifdeffed because not all Glk
      libraries have this call.) */
 #ifdef GI_DISPA_GAME_ID_AVAILABLE
   gidispatch_set_game_id_hook(&get_game_id);
 #endif /* GI_DISPA_GAME_ID_AVAILABLE */
     
-  /* Allocate the class hash tables. */
-  num_classes = gidispatch_count_classes();
-  classes = (classtable_t **)glulx_malloc(num_classes 
-    * sizeof(classtable_t *));
-  if (!classes)
-    return FALSE;
-
-  randish = time(NULL) % 101;
-  for (ix=0; ix<num_classes; ix++) {
-    classes[ix] = new_classtable(1+120*ix+randish);
-    if (!classes[ix])
-      return FALSE;
-  }
-    
   /* Set up the two callbacks. */
   gidispatch_set_object_registry(&glulxe_classtable_register, 
     &glulxe_classtable_unregister);
@@ -196,6 +196,7 @@ extern void (*stream_unichar_handler)(glui32 ch);
 
 /* main.c */
 extern glui32 init_rng_seed;
+extern void reset_main(void);
 extern void set_library_start_hook(void (*)(void));
 extern void set_library_autorestore_hook(void (*)(void));
 extern void fatal_error_handler(char *str, char *arg, int useval, glsi32 val) GLK_ATTRIBUTE_NORETURN;
@@ -235,6 +236,8 @@ extern void store_operand_s(glui32 desttype, glui32 destaddr, glui32 storeval);
 extern void store_operand_b(glui32 desttype, glui32 destaddr, glui32 storeval);
 
 /* funcs.c */
+extern void init_funcs(void);
+extern void forget_function(glui32 addr);
 extern void enter_function(glui32 addr, glui32 argc, glui32 *argv);
 extern void leave_function(void);
 extern void push_callstub(glui32 desttype, glui32 destaddr);
@@ -265,6 +268,7 @@ extern void heap_sanity_check(void);
 
 /* serial.c */
 extern int max_undo_level;
+extern const int default_max_undo_level;
 extern int init_serial(void);
 extern void final_serial(void);
 extern glui32 perform_save(strid_t str);
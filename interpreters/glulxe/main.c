@@ -27,6 +27,9 @@ static void (*library_start_hook)(void) = NULL;
    and remglk do.) */
 static void (*library_autorestore_hook)(void) = NULL;
 
+/* The window in which errors are displayed, once one has been opened. */
+static winid_t errorwin = NULL;
+
 static winid_t get_error_win(void);
 static void stream_hexnum(glsi32 val);
 
@@ -80,6 +83,28 @@ void glk_main()
   glk_exit();
 }
 
+/* reset_main():
+   Put the top-level state back to how it was before glk_main() first ran.
+   If the previous run was stopped in mid-game, shut down its VM first.
+   The Glk library has already closed all of that run's Glk objects.
+*/
+void reset_main()
+{
+  if (!vm_exited_cleanly)
+    finalize_vm();
+
+  vm_exited_cleanly = TRUE;
+  gamefile = NULL;
+  gamefile_start = 0;
+  gamefile_len = 0;
+  init_err = NULL;
+  init_err2 = NULL;
+  init_rng_seed = 0;
+  errorwin = NULL;
+  library_start_hook = NULL;
+  library_autorestore_hook = NULL;
+}
+
 void set_library_start_hook(void (*func)(void))
 {
   library_start_hook = func;
@@ -97,8 +122,6 @@ void set_library_autorestore_hook(void (*func)(void))
 */
 static winid_t get_error_win()
 {
-  static winid_t errorwin = NULL;
-
   if (!errorwin) {
     winid_t rootwin = glk_window_get_root();
     if (!rootwin) {
@@ -27,9 +27,14 @@ typedef struct dest_struct {
   | (((glui32)c3) << 8)     \
   | (((glui32)c4)) )
 
+#define DEFAULT_MAX_UNDO_LEVEL (8)
+
 /* This can be adjusted before startup by platform-specific startup
    code -- that is, preference code. */
-int max_undo_level = 8;
+int max_undo_level = DEFAULT_MAX_UNDO_LEVEL;
+/* The initial value of max_undo_level, for startup code that needs to
+   put it back. */
+const int default_max_undo_level = DEFAULT_MAX_UNDO_LEVEL;
 
 static int undo_chain_size = 0;
 static int undo_chain_num = 0;
@@ -88,6 +88,25 @@ void glkunix_set_autosave_signature(unsigned char *buf, glui32 len)
     game_signature[2*len] = '\0';
 }
 
+/* Put the autosave preferences back to their defaults, and forget the
+   game signature and the autosave path worked out from them. (Chimara
+   calls glkunix_reset_code() instead of reloading the plugin.)
+ */
+void glkunix_reset_autosave()
+{
+    if (game_signature) {
+        glulx_free(game_signature);
+        game_signature = NULL;
+    }
+    if (autosave_basepath) {
+        glulx_free(autosave_basepath);
+        autosave_basepath = NULL;
+    }
+    pref_autosavedir = ".";
+    pref_autosavename = "autosave";
+    pref_autosave_skiparrange = FALSE;
+}
+
 /* Construct the pathname for autosaving this game. Returns a statically allocated string; the caller should append a filename suffix to that.
    This looks at the autosavedir and autosavename preferences. If autosavename contains a "#" character, the game signature is substituted.
  */
@@ -62,6 +62,20 @@ glkunix_argumentlist_t glkunix_arguments[] = {
   { NULL, glkunix_arg_End, NULL }
 };
 
+/* Chimara extension: called instead of reloading the plugin when it is
+   run again. The VM state is set up afresh by glk_main(), and the
+   dispatch tables are reused; the rest goes back to its initial values
+   here, including any options the previous run's arguments changed. */
+void glkunix_reset_code()
+{
+  reset_main();
+  max_undo_level = default_max_undo_level;
+#if GLKUNIX_AUTOSAVE_FEATURES
+  set_library_select_hook(NULL);
+  glkunix_reset_autosave();
+#endif /* GLKUNIX_AUTOSAVE_FEATURES */
+}
+
 int glkunix_startup_code(glkunix_startup_t *data)
 {
   /* It turns out to be more convenient if we return TRUE from here, even 
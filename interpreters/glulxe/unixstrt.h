@@ -11,4 +11,5 @@ extern int pref_autosave_skiparrange;
 extern void glkunix_set_autosave_signature(unsigned char *buf, glui32 len);
 extern void glkunix_do_autosave(glui32 selector, glui32 arg0, glui32 arg1, glui32 arg2);
 extern int glkunix_do_autorestore(void);
+extern void glkunix_reset_autosave(void);
 
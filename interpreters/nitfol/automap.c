@@ -70,20 +70,33 @@ typedef struct loc_node loc_node;
 struct edge {
   loc_node *dest[2];                    /* Two endpoints of passage */
   BOOL is_oneway; /* Oneway passages are always created dest[0]--->dest[1] */
-  BOOL touched;
+  glui32 touched;                       /* == touch_stamp if touched */
   int min_length;
   int guess_length;
 };
 
 struct loc_node {
   zword number;
-  BOOL found, real, touched;
+  BOOL found, real;
+  glui32 touched;                       /* == touch_stamp if touched */
   edge *outgoing[NUM_DIRS];             /* Drawn map connections */
   loc_node *exits[NUM_EXITS];           /* Actual connections */
   glui32 dist;                          /* For automap_find_path */
+  glui32 dist_stamp;                    /* dist is valid if == dist_stamp */
+  loc_node *queue_next;                 /* For automap_calc_distances */
 };
 
 
+/* Rooms and edges are touched by setting their touched field to touch_stamp,
+   so everything can be untouched at once by moving to a new stamp instead of
+   walking over every room and edge on the map */
+static glui32 touch_stamp = 1;
+
+/* Bumped whenever rooms, exits or passages change, so cached layouts and
+   distances know when they are out of date */
+static glui32 automap_generation = 0;
+
+
 typedef struct edgelist edgelist;
 struct edgelist {
   edgelist *next;
@@ -99,10 +112,11 @@ static edge *automap_new_edge(loc_node *src, loc_node *dest, BOOL is_oneway)
   newedge.node->dest[0] = src;
   newedge.node->dest[1] = dest;
   newedge.node->is_oneway = is_oneway;
-  newedge.node->touched = FALSE;
+  newedge.node->touched = 0;
   newedge.node->min_length = is_oneway ? 4 : 2;
   newedge.node->guess_length = is_oneway ? 4 : 2;  
   LEadd(all_edges, newedge);
+  automap_generation++;
   return newedge.node;
 }
 
@@ -122,33 +136,36 @@ static void automap_remove_edge(edge *e)
       }
   }
   LEsearchremove(all_edges, p, t, p->node == e, n_free(p->node));
+  automap_generation++;
 }
 
 
-static void automap_edges_untouch(void)
+static hash_table rooms;
+static char *loc_exp;
+static zwinid automap_win;
+
+
+void make_untouched(const char *unused_key, void *r)
 {
-  edgelist *p;
-  for(p = all_edges; p; p=p->next) {
-    p->node->touched = FALSE;
-  }
+  loc_node *t = (loc_node *) r;
+  t->touched = 0;
 }
 
 
-static void automap_edges_mindist(void)
+/* Untouch all rooms and edges */
+static void automap_untouch(void)
 {
-  edgelist *p;
-  for(p = all_edges; p; p=p->next) {
-    int len = p->node->is_oneway ? 4 : 2;
-    p->node->min_length = p->node->guess_length = len;
+  touch_stamp++;
+  if(touch_stamp == 0) {                /* Wrapped; clear the old stamps */
+    edgelist *p;
+    n_hash_enumerate(&rooms, make_untouched);
+    for(p = all_edges; p; p=p->next)
+      p->node->touched = 0;
+    touch_stamp = 1;
   }
 }
 
 
-static hash_table rooms;
-static char *loc_exp;
-static zwinid automap_win;
-
-
 void automap_kill(void)
 {
   mymap_kill();
@@ -157,6 +174,7 @@ void automap_kill(void)
   LEdestruct(all_edges, n_free(all_edges->node));
   n_hash_free_table(&rooms, n_free);
   z_kill_window(automap_win);
+  automap_generation++;
 }
 
 BOOL automap_init(int numobj, const char *location_exp)
@@ -202,13 +220,15 @@ static loc_node *room_find_or_create(glui32 location, BOOL is_real)
     r->number = location;
     r->found = FALSE;
     r->real = is_real;
-    r->touched = FALSE;
+    r->touched = 0;
+    r->dist_stamp = 0;
     for(n = 0; n < NUM_EXITS; n++) {
       r->exits[n] = NULL;
       if(n < NUM_DIRS)
 	r->outgoing[n] = NULL;
     }
     n_hash_insert(key, r, &rooms);
+    automap_generation++;
   }
   return r;
 }
@@ -222,6 +242,7 @@ static void room_remove(loc_node *room)
     for(n = 0; n < NUM_DIRS; n++)
       automap_remove_edge(room->outgoing[n]);
     n_free(n_hash_del(n_static_number(preface, room->number), &rooms));
+    automap_generation++;
   }
 }
 
@@ -243,6 +264,8 @@ struct interlist {
 
 
 static BOOL mymap_plot(int x, int y, glui32 symbol, loc_node *node);
+static void mymap_plot_line(int x, int y, int deltax, int deltay, int count,
+			    glui32 symbol, loc_node *node);
 static edge *automap_get_edge(loc_node *location, int dir);
 static void automap_calc_location(loc_node *location, loc_node *last,
 				  int x, int y);
@@ -280,8 +303,7 @@ static int automap_find_and_count_interference(loc_node *center)
   automap_cycles_fill_values();
   automap_forget_interference();
   mymap_reinit();
-  n_hash_enumerate(&rooms, make_untouched);
-  automap_edges_untouch();
+  automap_untouch();
   automap_calc_location(center, NULL, 0, 0);
   
   count = 0;
@@ -426,6 +448,8 @@ static void automap_set_connection(int location, int d, int dest, BOOL is_real)
   if(t == r)
     t = NULL;
   
+  if(r->exits[d] != t)
+    automap_generation++;
   r->exits[d] = t;
 }
 
@@ -472,14 +496,13 @@ static int automap_edge_oneway(loc_node *location, int dir)
 static BOOL automap_draw_edge(loc_node *location, int dir, int *x, int *y)
 {
   int deltax, deltay;
-  int s;
   int len;
   int oneway;
   edge *e = automap_get_edge(location, dir);
   
-  if(e->touched)
+  if(e->touched == touch_stamp)
     return TRUE;
-  e->touched = TRUE;
+  e->touched = touch_stamp;
 
   deltax = dirways[dir].deltax;
   deltay = dirways[dir].deltay;
@@ -498,10 +521,11 @@ static BOOL automap_draw_edge(loc_node *location, int dir, int *x, int *y)
     *y += deltay;
   }
     
-  for(s = 1; s < len; s++) {
-    mymap_plot(*x, *y, dirways[dir].symbol, location);
-    *x += deltax;
-    *y += deltay;
+  if(len > 1) {
+    mymap_plot_line(*x, *y, deltax, deltay, len - 1,
+		    dirways[dir].symbol, location);
+    *x += deltax * (len - 1);
+    *y += deltay * (len - 1);
   }
 
   if(oneway == 1) {
@@ -525,6 +549,34 @@ static int mapheight;
 static glui32 *mymap = NULL;
 static loc_node **mymapnode = NULL;
 
+/* Bounding boxes of the cells written to since the map was last cleared, and
+   of the cells which aren't blank, so clearing and drawing the map only has to
+   look at the part of it that's in use */
+typedef struct map_box map_box;
+struct map_box {
+  int firstx, firsty, lastx, lasty;
+};
+
+static map_box dirty, drawn;
+
+static void mymap_box_empty(map_box *box)
+{
+  box->firstx = mapwidth; box->firsty = mapheight;
+  box->lastx = 0; box->lasty = 0;
+}
+
+static void mymap_box_add(map_box *box, int x, int y)
+{
+  if(y < box->firsty)
+    box->firsty = y;
+  if(y > box->lasty)
+    box->lasty = y;
+  if(x < box->firstx)
+    box->firstx = x;
+  if(x > box->lastx)
+    box->lastx = x;
+}
+
 static char mymap_read(int x, int y)
 {
   x += mapwidth / 2; y += mapheight / 2;
@@ -556,6 +608,9 @@ static BOOL mymap_plot(int x, int y, glui32 symbol, loc_node *node)
   if(status) {
     *dest = symbol;
     mymapnode[x + y * mapwidth] = node;
+    mymap_box_add(&dirty, x, y);
+    if(symbol != ' ')
+      mymap_box_add(&drawn, x, y);
   } else {
     loc_node *interfere = mymapnode[x + y * mapwidth];
     automap_remember_interference(node, interfere);
@@ -564,10 +619,64 @@ static BOOL mymap_plot(int x, int y, glui32 symbol, loc_node *node)
 }
 
 
+/* Blank the cells that have been written to */
+static void mymap_clear(void)
+{
+  int x, y;
+  for(y = dirty.firsty; y <= dirty.lasty; y++) {
+    for(x = dirty.firstx; x <= dirty.lastx; x++) {
+      mymap[x + y * mapwidth] = ' ';
+      mymapnode[x + y * mapwidth] = NULL;
+    }
+  }
+  mymap_box_empty(&dirty);
+  mymap_box_empty(&drawn);
+}
+
+
+/* Narrow the steps [*first, *last] of a line along one axis, starting at pos
+   and moving delta each step, to the ones that are between 0 and size - 1 */
+static void mymap_clip_steps(int pos, int delta, int size, int *first, int *last)
+{
+  if(delta == 0) {
+    if(pos < 0 || pos >= size)
+      *last = -1;
+  } else if(delta > 0) {
+    if(-pos > *first)
+      *first = -pos;
+    if(size - 1 - pos < *last)
+      *last = size - 1 - pos;
+  } else {
+    if(pos - (size - 1) > *first)
+      *first = pos - (size - 1);
+    if(pos < *last)
+      *last = pos;
+  }
+}
+
+
+/* Plot count symbols in a line from x, y.  Only plots the part of the line
+   that's on the map, as edges can be stretched far beyond it */
+static void mymap_plot_line(int x, int y, int deltax, int deltay, int count,
+			    glui32 symbol, loc_node *node)
+{
+  int s;
+  int first = 0, last = count - 1;
+  mymap_clip_steps(x + mapwidth / 2, deltax, mapwidth, &first, &last);
+  mymap_clip_steps(y + mapheight / 2, deltay, mapheight, &first, &last);
+  for(s = first; s <= last; s++)
+    mymap_plot(x + s * deltax, y + s * deltay, symbol, node);
+}
+
+
 void mymap_init(int width, int height)
 {
   int i;
   int max;
+  if(mymap && mapwidth == width * 2 && mapheight == height * 2) {
+    mymap_clear();
+    return;
+  }
   mapwidth = width * 2;
   mapheight = height * 2;
   max = mapwidth * mapheight;
@@ -579,6 +688,8 @@ void mymap_init(int width, int height)
     mymap[i] = ' ';
     mymapnode[i] = NULL;
   }
+  mymap_box_empty(&dirty);
+  mymap_box_empty(&drawn);
 }
 
 
@@ -611,21 +722,8 @@ static void mymap_draw(void)
   int firsty, firstx, lasty, lastx;
   int height, width;
 
-  firsty = mapheight; firstx = mapwidth;
-  lasty = 0; lastx = 0;
-  for(y = 0; y < mapheight; y++) {
-    for(x = 0; x < mapwidth; x++)
-      if(mymap[x + y * mapwidth] != ' ') {
-	if(y < firsty)
-	  firsty = y;
-	if(y > lasty)
-	  lasty = y;
-	if(x < firstx)
-	  firstx = x;
-	if(x > lastx)
-	  lastx = x;
-      }
-  }
+  firsty = drawn.firsty; firstx = drawn.firstx;
+  lasty = drawn.lasty; lastx = drawn.lastx;
 
   height = lasty - firsty; width = lastx - firstx;
   
@@ -649,6 +747,10 @@ static void mymap_draw(void)
 
 static glui32 selected_room_number = 0;
 
+/* What the map was last laid out for */
+static glui32 layout_generation;
+static int layout_center;
+
 static void automap_write_loc(int x, int y)
 {
   loc_node *room;
@@ -668,8 +770,13 @@ glui32 automap_draw_callback(winid_t win, glui32 width, glui32 height)
   if(win == NULL)
     return automap_size;
 
-  mymap_init(width, height);
-  automap_set_locations(automap_location);
+  /* Only lay out the map again if it, the player or the window has changed */
+  if(!mymap || width * 2 != mapwidth || height * 2 != mapheight
+     || layout_generation != automap_generation
+     || layout_center != automap_location) {
+    mymap_init(width, height);
+    automap_set_locations(automap_location);
+  }
   
   glk_stream_set_current(glk_window_get_stream(win));
   mymap_draw();
@@ -708,9 +815,9 @@ static void automap_calc_location(loc_node *location, loc_node *last,
   if(!location)
     return;
 
-  if(location->touched)
+  if(location->touched == touch_stamp)
     return;
-  location->touched = TRUE;
+  location->touched = touch_stamp;
 
   /* Make sure unfound locations are blanked */
   if(!location->found) {
@@ -812,6 +919,7 @@ static void automap_calc_exits(loc_node *location, int depth)
 	    
 	  is_oneway[i] = FALSE;
 	  newnode->found = TRUE;
+	  automap_generation++;
 	    
 	  automap_set_virtual_connection(proposed[i], n, newnode, FALSE);
 	  proposed[i] = newnode;
@@ -847,30 +955,71 @@ static void automap_calc_exits(loc_node *location, int depth)
 
 #define INFINITY 1000000L
 
+/* Distances are only valid if a room's dist_stamp matches dist_stamp, so
+   starting a new search doesn't mean visiting every room to reset them */
+static glui32 dist_stamp = 0;
+
+/* The search the distances are from */
+static loc_node *dist_dest = NULL;
+static BOOL dist_by_walking;
+static glui32 dist_generation;
+
 static void make_distant(const char *unused_key, void *r)
 {
   loc_node *t = (loc_node *) r;
-  t->dist = INFINITY;
+  t->dist_stamp = 0;
 }
 
 
-static void automap_calc_distances(loc_node *location, glui32 distance,
-				   BOOL by_walking)
+static glui32 automap_get_dist(loc_node *location)
+{
+  return location->dist_stamp == dist_stamp ? location->dist : INFINITY;
+}
+
+
+/* Find the distances of all nodes from dest, breadth first.  They're kept
+   until the map changes, as automap_resolve_interference often looks for
+   several paths to the same place */
+static void automap_calc_distances(loc_node *dest, BOOL by_walking)
 {
   unsigned i;
   unsigned maxdir = by_walking ? NUM_EXITS : NUM_DIRS;
-  if(location->dist < distance)
+  loc_node *head, *tail;
+
+  if(dest == dist_dest && by_walking == dist_by_walking
+     && automap_generation == dist_generation)
     return;
-  location->dist = distance;
-  for(i = 0; i < maxdir; i++) {
-    loc_node *thisdest;
-    if(by_walking)
-      thisdest = location->exits[i];
-    else
-      thisdest = automap_edge_follow(location, i);
+  dist_dest = dest;
+  dist_by_walking = by_walking;
+  dist_generation = automap_generation;
+
+  dist_stamp++;
+  if(dist_stamp == 0) {                 /* Wrapped; clear the old stamps */
+    n_hash_enumerate(&rooms, make_distant);
+    dist_stamp = 1;
+  }
 
-    if(thisdest)
-      automap_calc_distances(thisdest, distance+1, by_walking);
+  dest->dist = 0;
+  dest->dist_stamp = dist_stamp;
+  dest->queue_next = NULL;
+  head = tail = dest;
+  while(head) {
+    for(i = 0; i < maxdir; i++) {
+      loc_node *thisdest;
+      if(by_walking)
+	thisdest = head->exits[i];
+      else
+	thisdest = automap_edge_follow(head, i);
+
+      if(thisdest && thisdest->dist_stamp != dist_stamp) {
+	thisdest->dist = head->dist + 1;
+	thisdest->dist_stamp = dist_stamp;
+	thisdest->queue_next = NULL;
+	tail->queue_next = thisdest;
+	tail = thisdest;
+      }
+    }
+    head = head->queue_next;
   }
 }
 
@@ -884,11 +1033,10 @@ static automap_path *automap_find_path(loc_node *location, loc_node *dest,
   loc_node *p;
 
   /* Find the distances of all nodes from dest */
-  n_hash_enumerate(&rooms, make_distant);
-  automap_calc_distances(dest, 0, by_walking);
+  automap_calc_distances(dest, by_walking);
 
   /* If dest isn't reachable, location's distance will still be infinite */
-  if(location->dist == INFINITY)
+  if(automap_get_dist(location) == INFINITY)
     return NULL;
 
   /* At each step, go toward a nearer node 'till we're there */
@@ -906,9 +1054,9 @@ static automap_path *automap_find_path(loc_node *location, loc_node *dest,
       else
 	thisdest = automap_edge_follow(p, i);
       
-      if(thisdest && thisdest->dist < best_dist) {
+      if(thisdest && automap_get_dist(thisdest) < best_dist) {
 	best_dir = i;
-	best_dist = thisdest->dist;
+	best_dist = automap_get_dist(thisdest);
 	best_node = thisdest;
       }
     }
@@ -935,7 +1083,7 @@ static automap_path *automap_find_path(loc_node *location, loc_node *dest,
 static void automap_find_cycles(loc_node *location, automap_path *curpath)
 {
   unsigned i;
-  location->touched = TRUE;
+  location->touched = touch_stamp;
   for(i = 0; i < NUM_DIRS; i++) {
     loc_node *thisdest = automap_edge_follow(location, i);
     if(thisdest && thisdest->found) {
@@ -944,7 +1092,7 @@ static void automap_find_cycles(loc_node *location, automap_path *curpath)
       newnode.loc = location;
       LEadd(curpath, newnode);
 
-      if(thisdest->touched) {           /* Found a cycle! */
+      if(thisdest->touched == touch_stamp) { /* Found a cycle! */
 	int cyclelength = 0;
 	automap_path *p;
 	cycleequation *cycle = NULL;
@@ -987,10 +1135,23 @@ static void automap_calc_cycles(loc_node *start)
 }
 
 
-void make_untouched(const char *unused_key, void *r)
+/* Reset the lengths of the passages in the part of the map connected to
+   location.  Nothing outside it gets drawn, so it can keep its old lengths
+   until it's connected up */
+static void automap_edges_mindist(loc_node *location)
 {
-  loc_node *t = (loc_node *) r;
-  t->touched = FALSE;
+  unsigned i;
+  if(!location || location->touched == touch_stamp)
+    return;
+  location->touched = touch_stamp;
+  for(i = 0; i < NUM_DIRS; i++) {
+    edge *e = location->outgoing[i];
+    if(e) {
+      int len = e->is_oneway ? 4 : 2;
+      e->min_length = e->guess_length = len;
+      automap_edges_mindist(automap_edge_follow(location, i));
+    }
+  }
 }
 
 
@@ -1000,17 +1161,21 @@ void automap_set_locations(int center)
 
   r = room_find(center, TRUE);
 
-  n_hash_enumerate(&rooms, make_untouched);
-  automap_edges_mindist();
+  automap_untouch();
+  automap_edges_mindist(r);
+
+  automap_untouch();
   automap_calc_cycles(r);
 
-  n_hash_enumerate(&rooms, make_untouched);
   automap_forget_interference();
   mymap_reinit();
-  automap_edges_untouch();
+  automap_untouch();
   automap_calc_location(r, NULL, 0, 0);
 
   automap_resolve_interference(r, 2);
+
+  layout_generation = automap_generation;
+  layout_center = center;
 }
 
 
@@ -1041,6 +1206,7 @@ const char *automap_explore(void)
     if(automap_dir == NUM_EXITS) {
       loc_node *r = room_find(automap_location, TRUE);
       r->found = TRUE;
+      automap_generation++;
       automap_calc_exits(r, 0);
       allow_saveundo = TRUE;
       allow_output = TRUE;
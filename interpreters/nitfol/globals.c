@@ -111,6 +111,8 @@ glui32 automap_split = winmethod_Above;
 
 int stacklimit = 0;
 
+int undo_memory_limit = 0;      /* Kilobytes of undo history, 0 for no limit */
+
 BOOL enablefont3 = FALSE;        /* Enables font3 -> ascii conversion.
 				    Nitfol doesn't claim to support it
 				    even if you set this flag.  This
@@ -73,6 +73,7 @@ extern char * search_path;
 extern int automap_size;
 extern glui32 automap_split;
 extern int stacklimit;
+extern int undo_memory_limit;
 extern BOOL enablefont3;
 
 #endif /* CFH_GLOBALS_H */
@@ -60,33 +60,91 @@ help                           28  +  199  +  172  =  399
    memory, enough for a longish game.
 
    Note that stack size (and contents mostly) stay the same between calls
-   since save_undo is almost always called from the same place.  I should take
-   advantage of this somehow.  (another hundred bytes to save, another 1000
-   turns per meg...)
+   since save_undo is almost always called from the same place.  So the
+   delta and stack chunk are kept in reference-counted chunks, and a turn
+   whose stack chunk (or delta) is byte-for-byte the same as the previous
+   turn's just shares that chunk instead of storing another copy.
+
+   The moves are kept in a doubly linked list from oldest to newest, with
+   undo_next pointing at the move the next undo will take back.  prevstate
+   always holds the memory at that point in the list, so each undo or redo
+   applies exactly one delta no matter how far back in the list it is, and
+   the oldest move can be dropped without touching any of the others.  The
+   total size of the list is kept in undo_bytes so that undo_memory_limit
+   can be enforced by dropping moves from the old end.
 
 */
 
 
 static zbyte *prevstate = NULL;
 
+typedef struct undo_chunk undo_chunk;
+
+struct undo_chunk {
+  int refcount;
+  zbyte *data;
+  glui32 length;
+};
+
 typedef struct move_difference move_difference;
 
 struct move_difference {
-  move_difference *next;
+  move_difference *older;
+  move_difference *newer;
 
-  zbyte *delta;       /* Encoded like quetzal mixed with UTF-8 */
-  glui32 deltalength;
+  undo_chunk *delta;       /* Encoded like quetzal mixed with UTF-8 */
 
   offset PC;
   offset oldPC;
   BOOL PC_in_instruction;
 
-  zbyte *stackchunk;  /* Quetzal encoded */
-  glui32 stacklength;
+  undo_chunk *stackchunk;  /* Quetzal encoded */
 };
 
-static move_difference *movelist = NULL;
-static int move_index;
+static move_difference *oldest_move = NULL;
+static move_difference *newest_move = NULL;
+static move_difference *undo_next = NULL;
+static int redo_count;
+static glui32 undo_bytes;
+
+
+/* Takes ownership of data, unless it can be shared with prev */
+static undo_chunk *undo_chunk_new(undo_chunk *prev, zbyte *data,
+				  glui32 length)
+{
+  undo_chunk *c;
+  if(prev && prev->length == length
+     && (length == 0 || n_memcmp(prev->data, data, length) == 0)) {
+    n_free(data);
+    prev->refcount++;
+    return prev;
+  }
+  c = (undo_chunk *) n_malloc(sizeof(*c));
+  c->refcount = 1;
+  c->data = data;
+  c->length = length;
+  undo_bytes += sizeof(*c) + length;
+  return c;
+}
+
+
+static void undo_chunk_unref(undo_chunk *c)
+{
+  if(--c->refcount > 0)
+    return;
+  undo_bytes -= sizeof(*c) + c->length;
+  n_free(c->data);
+  n_free(c);
+}
+
+
+static void free_move(move_difference *m)
+{
+  undo_chunk_unref(m->delta);
+  undo_chunk_unref(m->stackchunk);
+  undo_bytes -= sizeof(*m);
+  n_free(m);
+}
 
 
 void init_undo(void)
@@ -97,28 +155,29 @@ void init_undo(void)
   n_memcpy(prevstate, z_memory, dynamic_size);
 }
 
-/* Frees old undo slots if possible in order to reduce memory consumption.
-   Will never free the most recent @save_undo */
+/* Frees the oldest undo slot if possible in order to reduce memory
+   consumption.  Will never free the most recent @save_undo, nor a slot
+   still needed to redo */
 BOOL free_undo(void)
 {
-  move_difference *p, *g = NULL;
-  for(p = movelist; p; p=p->next)
-    if(p->next)
-      g = p;
-  if(g == NULL)
+  move_difference *p = oldest_move;
+  if(p == NULL || p == newest_move || undo_next == NULL)
     return FALSE;
 
-  n_free(g->next->delta);
-  n_free(g->next->stackchunk);
-  n_free(g->next);
-  g->next = NULL;
+  if(undo_next == p)
+    undo_next = NULL;
+  oldest_move = p->newer;
+  oldest_move->older = NULL;
+  free_move(p);
   return TRUE;
 }
 
 
 BOOL saveundo(BOOL in_instruction)
 {
-  move_difference newdiff;
+  move_difference *newdiff;
+  zbyte *delta, *stackchunk;
+  glui32 deltalength, stacklength;
   strid_t stack;
   stream_result_t poo;
 
@@ -129,21 +188,21 @@ BOOL saveundo(BOOL in_instruction)
      saveundo before the first @save_undo hits, since there hadn't been any
      @save_undo before the first read line.  So when this happens, wipe the
      fake saveundo in favor of the real one */
-  if(in_instruction && movelist && !movelist->next
-     && !movelist->PC_in_instruction)
+  if(in_instruction && newest_move && newest_move == oldest_move
+     && !newest_move->PC_in_instruction)
     init_undo();
 
     
-  if(!quetzal_diff(z_memory, prevstate, dynamic_size, &newdiff.delta,
-		   &newdiff.deltalength, TRUE))
+  if(!quetzal_diff(z_memory, prevstate, dynamic_size, &delta,
+		   &deltalength, TRUE))
     return FALSE;
 
 #ifdef PARANOID
   {
     char *newmem = (char *) n_malloc(dynamic_size);
     n_memcpy(newmem, prevstate, dynamic_size);
-    quetzal_undiff(newmem, dynamic_size, newdiff.delta,
-		   newdiff.deltalength, TRUE);
+    quetzal_undiff(newmem, dynamic_size, delta,
+		   deltalength, TRUE);
     if(n_memcmp(z_memory, newmem, dynamic_size)) {
       n_show_error(E_SAVE, "save doesn't match itself", 0);
     }
@@ -151,42 +210,64 @@ BOOL saveundo(BOOL in_instruction)
   }
 #endif
   
-  newdiff.PC = PC;
-  newdiff.oldPC = oldPC;
-  
-  newdiff.PC_in_instruction = in_instruction;
-  newdiff.stacklength = get_quetzal_stack_size();
-  newdiff.stackchunk = (zbyte *) n_malloc(newdiff.stacklength);
-  stack = glk_stream_open_memory((char *) newdiff.stackchunk,
-				 newdiff.stacklength, filemode_Write, 0);
+  stacklength = get_quetzal_stack_size();
+  stackchunk = (zbyte *) n_malloc(stacklength);
+  stack = glk_stream_open_memory((char *) stackchunk,
+				 stacklength, filemode_Write, 0);
   if(!stack) {
-    n_free(newdiff.delta);
-    n_free(newdiff.stackchunk);
+    n_free(delta);
+    n_free(stackchunk);
     return FALSE;
   }
   if(!quetzal_stack_save(stack)) {
     glk_stream_close(stack, NULL);
-    n_free(newdiff.delta);
-    n_free(newdiff.stackchunk);
+    n_free(delta);
+    n_free(stackchunk);
     return FALSE;
   }
   glk_stream_close(stack, &poo);
-  if(poo.writecount != newdiff.stacklength) {
+  if(poo.writecount != stacklength) {
     n_show_error(E_SAVE, "incorrect stack size assessment", poo.writecount);
-    n_free(newdiff.delta);
-    n_free(newdiff.stackchunk);
+    n_free(delta);
+    n_free(stackchunk);
     return FALSE;
   }
 
-  while(move_index-- > 0) {
-    n_free(movelist->delta);
-    n_free(movelist->stackchunk);
-    LEremove(movelist);
+  /* Moves which had been undone can't be redone any more */
+  while(newest_move != undo_next) {
+    move_difference *p = newest_move;
+    newest_move = p->older;
+    if(newest_move)
+      newest_move->newer = NULL;
+    else
+      oldest_move = NULL;
+    free_move(p);
   }
-  LEadd(movelist, newdiff);
-  move_index++;
+  redo_count = 0;
+
+  newdiff = (move_difference *) n_malloc(sizeof(*newdiff));
+  undo_bytes += sizeof(*newdiff);
+  newdiff->delta = undo_chunk_new(newest_move ? newest_move->delta : NULL,
+				  delta, deltalength);
+  newdiff->stackchunk = undo_chunk_new(newest_move ? newest_move->stackchunk
+				       : NULL, stackchunk, stacklength);
+  newdiff->PC = PC;
+  newdiff->oldPC = oldPC;
+  newdiff->PC_in_instruction = in_instruction;
+
+  newdiff->older = newest_move;
+  newdiff->newer = NULL;
+  if(newest_move)
+    newest_move->newer = newdiff;
+  else
+    oldest_move = newdiff;
+  newest_move = undo_next = newdiff;
   n_memcpy(prevstate, z_memory, dynamic_size);
 
+  if(undo_memory_limit > 0)
+    while(undo_bytes > (glui32) undo_memory_limit * 1024 && free_undo())
+      ;
+
   has_done_save_undo = TRUE;
   return TRUE;
 }
@@ -195,28 +276,24 @@ BOOL saveundo(BOOL in_instruction)
 BOOL restoreundo(void)
 {
   strid_t stack;
-  int i;
   glui32 wid, hei;
-  move_difference *p = movelist;
+  move_difference *p = undo_next;
 
-  if(!p || move_index < 0)
+  if(!p)
     return FALSE;
   
-  for(i = 0; i < move_index; i++) {
-    p=p->next;
-    if(!p)
-      return FALSE;
-  }
-  move_index++;
+  undo_next = p->older;
+  redo_count++;
 
   n_memcpy(z_memory, prevstate, dynamic_size);
 
-  quetzal_undiff(prevstate, dynamic_size, p->delta, p->deltalength, TRUE);
+  quetzal_undiff(prevstate, dynamic_size, p->delta->data,
+		 p->delta->length, TRUE);
   
-  stack = glk_stream_open_memory((char *) p->stackchunk, p->stacklength,
-				 filemode_Read, 0);
+  stack = glk_stream_open_memory((char *) p->stackchunk->data,
+				 p->stackchunk->length, filemode_Read, 0);
 
-  quetzal_stack_restore(stack, p->stacklength);
+  quetzal_stack_restore(stack, p->stackchunk->length);
   glk_stream_close(stack, NULL);
 
   if(p->PC_in_instruction) {
@@ -242,32 +319,31 @@ BOOL restoreundo(void)
 BOOL restoreredo(void)
 {
   strid_t stack;
-  int i;
   glui32 wid, hei;
   stream_result_t poo;
-  move_difference *p = movelist;
+  move_difference *p;
 
-  if(!p || move_index <= 0)
+  if(redo_count <= 0)
     return FALSE;
-  
-  move_index--;
-  for(i = 0; i < move_index; i++) {
-    p=p->next;
-    if(!p)
-      return FALSE;
-  }
+  p = undo_next ? undo_next->newer : oldest_move;
+  if(!p)
+    return FALSE;
+
+  undo_next = p;
+  redo_count--;
 
-  quetzal_undiff(prevstate, dynamic_size, p->delta, p->deltalength, TRUE);
+  quetzal_undiff(prevstate, dynamic_size, p->delta->data,
+		 p->delta->length, TRUE);
   
   n_memcpy(z_memory, prevstate, dynamic_size);
 
-  stack = glk_stream_open_memory((char *) p->stackchunk, p->stacklength,
-				 filemode_Read, 0);
+  stack = glk_stream_open_memory((char *) p->stackchunk->data,
+				 p->stackchunk->length, filemode_Read, 0);
 
-  quetzal_stack_restore(stack, p->stacklength);
+  quetzal_stack_restore(stack, p->stackchunk->length);
   glk_stream_close(stack, &poo);
 
-  if(poo.readcount != p->stacklength) {
+  if(poo.readcount != p->stackchunk->length) {
     n_show_error(E_SAVE, "incorrect stack size assessment", poo.readcount);
     return FALSE;
   }
@@ -366,12 +442,14 @@ void kill_undo(void)
   n_free(prevstate);
   prevstate = 0;
 
-  while(movelist) {
-    n_free(movelist->delta);
-    n_free(movelist->stackchunk);
-    LEremove(movelist);
+  while(oldest_move) {
+    move_difference *p = oldest_move;
+    oldest_move = p->newer;
+    free_move(p);
   }
-  move_index = 0;
+  newest_move = undo_next = NULL;
+  redo_count = 0;
+  undo_bytes = 0;
 
 #ifdef DEBUGGING
   n_free(automap_undoslot.z_mem);
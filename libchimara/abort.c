@@ -2,6 +2,7 @@
 
 #include "abort.h"
 #include "chimara-glk-private.h"
+#include "glkunix.h"
 #include "strio.h"
 #include "ui-message.h"
 #include "window.h"
@@ -107,7 +108,7 @@ shutdown_glk_pre(void)
 	}
 
 	/* Wait for any pending window rearrange */
-	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+	ui_message_sync_arrange();
 }
 
 /* Internal function: do any Glk-thread cleanup for shutting down the Glk library. */
@@ -131,13 +132,15 @@ shutdown_glk_post(void)
 	while( (sch = glk_schannel_iterate(NULL, NULL)) )
 		glk_schannel_destroy(sch);
 
+	/* Make sure autosaved library state has reached the disk */
+	autosave_wait_for_writes();
+
 	/* Shut down the UI message queue */
 	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SHUTDOWN, NULL));
 
 	/* Empty the event queue */
 	g_mutex_lock(&glk_data->event_lock);
-	g_queue_foreach(glk_data->event_queue, (GFunc)g_free, NULL);
-	g_queue_clear(glk_data->event_queue);
+	event_queue_clear(&glk_data->event_queue);
 	g_mutex_unlock(&glk_data->event_lock);
 
 	/* Reset the abort signaling mechanism */
@@ -161,6 +164,8 @@ shutdown_glk_post(void)
 	glk_data->unregister_obj = NULL;
 	glk_data->register_arr = NULL;
 	glk_data->unregister_arr = NULL;
+	glk_data->locate_arr = NULL;
+	glk_data->restore_arr = NULL;
 #endif
 }
 
@@ -0,0 +1,1349 @@
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include "chimara-glk-private.h"
+#include "fileref.h"
+#include "gi_blorb.h"
+#include "glk.h"
+#include "glkstart.h"
+#include "glkunix.h"
+#include "magic.h"
+#include "stream.h"
+#include "ui-message.h"
+#include "window.h"
+
+extern GPrivate glk_data_key;
+
+/* The library state is one GVariant dictionary (a{sv}), stored in
+ little-endian byte order. Objects are dictionaries as well, and lists of
+ objects are arrays of variants (av) each holding a dictionary. Increase this
+ number if the meaning of a key changes. */
+#define AUTOSAVE_VERSION 1
+
+struct glkunix_serialize_context_struct {
+	GVariantBuilder builder;
+};
+
+struct glkunix_unserialize_context_struct {
+	GVariant *value;
+	/* All the contexts made while reading the extra state, so that they can be
+	 freed together afterwards */
+	GPtrArray *pool;
+};
+
+struct glk_library_state_struct {
+	GVariant *value;
+};
+
+/* Data for writing the library state to a file on the write thread */
+struct autosave_write {
+	int fd;
+	off_t offset;
+	GBytes *data;
+};
+
+static GMutex write_lock;
+static GCond write_done;
+static unsigned writes_pending;
+static GThreadPool *write_pool;
+
+/**
+ * glkunix_get_last_event_type:
+ *
+ * Returns the type of the last event that glk_select() returned. Before the
+ * first event it returns 0xFFFFFFFF, and right after
+ * glkunix_update_from_library_state() it returns 0xFFFFFFFE. An interpreter
+ * can use this to avoid autosaving when nothing has happened yet.
+ *
+ * Returns: an event type, or one of the special values above.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_get_last_event_type(void)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	return glk_data->last_event_type;
+}
+
+/**
+ * glkunix_window_get_updatetag:
+ * @win: A window.
+ *
+ * Every window, stream, and file reference has an update tag, a number that
+ * identifies it in a saved library state.
+ *
+ * Returns: the update tag of @win.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_window_get_updatetag(winid_t win)
+{
+	VALID_WINDOW(win, return 0);
+	return win->updatetag;
+}
+
+/**
+ * glkunix_window_find_by_updatetag:
+ * @tag: An update tag.
+ *
+ * Finds the window with update tag @tag, usually after
+ * glkunix_update_from_library_state().
+ *
+ * Returns: a window, or %NULL if there is none with that tag.
+ *
+ * Stability: Unstable
+ */
+winid_t
+glkunix_window_find_by_updatetag(glui32 tag)
+{
+	winid_t win;
+	for(win = glk_window_iterate(NULL, NULL); win; win = glk_window_iterate(win, NULL))
+		if(win->updatetag == tag)
+			return win;
+	return NULL;
+}
+
+/**
+ * glkunix_window_set_dispatch_rock:
+ * @win: A window.
+ * @rock: A dispatch rock.
+ *
+ * The objects created by glkunix_update_from_library_state() are not passed to
+ * the object registry callbacks; instead, the interpreter registers them
+ * itself and sets their dispatch rocks with this function.
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_window_set_dispatch_rock(winid_t win, gidispatch_rock_t rock)
+{
+	VALID_WINDOW(win, return);
+	win->disprock = rock;
+}
+
+/**
+ * glkunix_stream_get_updatetag:
+ * @str: A stream.
+ *
+ * See glkunix_window_get_updatetag().
+ *
+ * Returns: the update tag of @str.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_stream_get_updatetag(strid_t str)
+{
+	VALID_STREAM(str, return 0);
+	return str->updatetag;
+}
+
+/**
+ * glkunix_stream_find_by_updatetag:
+ * @tag: An update tag.
+ *
+ * See glkunix_window_find_by_updatetag().
+ *
+ * Returns: a stream, or %NULL if there is none with that tag.
+ *
+ * Stability: Unstable
+ */
+strid_t
+glkunix_stream_find_by_updatetag(glui32 tag)
+{
+	strid_t str;
+	for(str = glk_stream_iterate(NULL, NULL); str; str = glk_stream_iterate(str, NULL))
+		if(str->updatetag == tag)
+			return str;
+	return NULL;
+}
+
+/**
+ * glkunix_stream_set_dispatch_rock:
+ * @str: A stream.
+ * @rock: A dispatch rock.
+ *
+ * See glkunix_window_set_dispatch_rock().
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_stream_set_dispatch_rock(strid_t str, gidispatch_rock_t rock)
+{
+	VALID_STREAM(str, return);
+	str->disprock = rock;
+}
+
+/**
+ * glkunix_fileref_get_updatetag:
+ * @fref: A file reference.
+ *
+ * See glkunix_window_get_updatetag().
+ *
+ * Returns: the update tag of @fref.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_fileref_get_updatetag(frefid_t fref)
+{
+	VALID_FILEREF(fref, return 0);
+	return fref->updatetag;
+}
+
+/**
+ * glkunix_fileref_find_by_updatetag:
+ * @tag: An update tag.
+ *
+ * See glkunix_window_find_by_updatetag().
+ *
+ * Returns: a file reference, or %NULL if there is none with that tag.
+ *
+ * Stability: Unstable
+ */
+frefid_t
+glkunix_fileref_find_by_updatetag(glui32 tag)
+{
+	frefid_t fref;
+	for(fref = glk_fileref_iterate(NULL, NULL); fref; fref = glk_fileref_iterate(fref, NULL))
+		if(fref->updatetag == tag)
+			return fref;
+	return NULL;
+}
+
+/**
+ * glkunix_fileref_set_dispatch_rock:
+ * @fref: A file reference.
+ * @rock: A dispatch rock.
+ *
+ * See glkunix_window_set_dispatch_rock().
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_fileref_set_dispatch_rock(frefid_t fref, gidispatch_rock_t rock)
+{
+	VALID_FILEREF(fref, return);
+	fref->disprock = rock;
+}
+
+/**
+ * glkunix_serialize_uint32:
+ * @ctx: A serialization context.
+ * @key: Name of the value.
+ * @val: Value to store.
+ *
+ * Stores @val under @key. Use this in a #glkunix_serialize_object_f callback.
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_serialize_uint32(glkunix_serialize_context_t ctx, char *key, glui32 val)
+{
+	g_variant_builder_add(&ctx->builder, "{sv}", key, g_variant_new_uint32(val));
+}
+
+/* Internal function: call @func to serialize @rock into a new dictionary. */
+static GVariant *
+serialize_object(glkunix_serialize_object_f func, void *rock)
+{
+	struct glkunix_serialize_context_struct ctx;
+	g_variant_builder_init(&ctx.builder, G_VARIANT_TYPE_VARDICT);
+	func(&ctx, rock);
+	return g_variant_builder_end(&ctx.builder);
+}
+
+/**
+ * glkunix_serialize_object:
+ * @ctx: A serialization context.
+ * @key: Name of the object.
+ * @func: Callback that serializes the object.
+ * @rock: The object, passed to @func.
+ *
+ * Stores a nested object under @key, whose contents are filled in by @func.
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_serialize_object(glkunix_serialize_context_t ctx, char *key, glkunix_serialize_object_f func, void *rock)
+{
+	g_variant_builder_add(&ctx->builder, "{sv}", key, serialize_object(func, rock));
+}
+
+/**
+ * glkunix_serialize_object_list:
+ * @ctx: A serialization context.
+ * @key: Name of the list.
+ * @func: Callback that serializes one object.
+ * @count: Number of objects in @array.
+ * @size: Size of one object in @array, in bytes.
+ * @array: Array of objects.
+ *
+ * Stores a list of objects under @key, calling @func for each of them.
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_serialize_object_list(glkunix_serialize_context_t ctx, char *key, glkunix_serialize_object_f func, int count, size_t size, void *array)
+{
+	GVariantBuilder list;
+	g_variant_builder_init(&list, G_VARIANT_TYPE("av"));
+	for(int ix = 0; ix < count; ix++)
+		g_variant_builder_add(&list, "v", serialize_object(func, (char *)array + ix * size));
+	g_variant_builder_add(&ctx->builder, "{sv}", key, g_variant_builder_end(&list));
+}
+
+/* Internal function: wrap @value, taking ownership of it */
+static glkunix_unserialize_context_t
+unserialize_context_new(GVariant *value, GPtrArray *pool)
+{
+	glkunix_unserialize_context_t ctx = g_slice_new(struct glkunix_unserialize_context_struct);
+	ctx->value = value;
+	ctx->pool = pool;
+	g_ptr_array_add(pool, ctx);
+	return ctx;
+}
+
+static void
+unserialize_context_free(glkunix_unserialize_context_t ctx)
+{
+	g_variant_unref(ctx->value);
+	g_slice_free(struct glkunix_unserialize_context_struct, ctx);
+}
+
+/**
+ * glkunix_unserialize_uint32:
+ * @ctx: An unserialization context.
+ * @key: Name of the value.
+ * @res: Return location for the value.
+ *
+ * Reads back a value stored with glkunix_serialize_uint32().
+ *
+ * Returns: %TRUE if there was a value under @key, %FALSE otherwise.
+ *
+ * Stability: Unstable
+ */
+int
+glkunix_unserialize_uint32(glkunix_unserialize_context_t ctx, char *key, glui32 *res)
+{
+	if(!g_variant_is_of_type(ctx->value, G_VARIANT_TYPE_VARDICT))
+		return FALSE;
+	return g_variant_lookup(ctx->value, key, "u", res);
+}
+
+/**
+ * glkunix_unserialize_struct:
+ * @ctx: An unserialization context.
+ * @key: Name of the object.
+ * @subctx: Return location for a context for the object.
+ *
+ * Reads back an object stored with glkunix_serialize_object().
+ *
+ * Returns: %TRUE if there was an object under @key, %FALSE otherwise.
+ *
+ * Stability: Unstable
+ */
+int
+glkunix_unserialize_struct(glkunix_unserialize_context_t ctx, char *key, glkunix_unserialize_context_t *subctx)
+{
+	if(!g_variant_is_of_type(ctx->value, G_VARIANT_TYPE_VARDICT))
+		return FALSE;
+	GVariant *value = g_variant_lookup_value(ctx->value, key, G_VARIANT_TYPE_VARDICT);
+	if(value == NULL)
+		return FALSE;
+	*subctx = unserialize_context_new(value, ctx->pool);
+	return TRUE;
+}
+
+/**
+ * glkunix_unserialize_list:
+ * @ctx: An unserialization context.
+ * @key: Name of the list.
+ * @subctx: Return location for a context for the list.
+ * @count: Return location for the number of objects in the list.
+ *
+ * Reads back a list stored with glkunix_serialize_object_list(). Get at the
+ * objects in it with glkunix_unserialize_list_entry() or
+ * glkunix_unserialize_object_list_entries().
+ *
+ * Returns: %TRUE if there was a list under @key, %FALSE otherwise.
+ *
+ * Stability: Unstable
+ */
+int
+glkunix_unserialize_list(glkunix_unserialize_context_t ctx, char *key, glkunix_unserialize_context_t *subctx, int *count)
+{
+	if(!g_variant_is_of_type(ctx->value, G_VARIANT_TYPE_VARDICT))
+		return FALSE;
+	GVariant *value = g_variant_lookup_value(ctx->value, key, G_VARIANT_TYPE("av"));
+	if(value == NULL)
+		return FALSE;
+	*subctx = unserialize_context_new(value, ctx->pool);
+	*count = g_variant_n_children(value);
+	return TRUE;
+}
+
+/**
+ * glkunix_unserialize_list_entry:
+ * @ctx: An unserialization context for a list.
+ * @pos: Index of the object in the list.
+ * @subctx: Return location for a context for the object.
+ *
+ * Reads back one object from a list.
+ *
+ * Returns: %TRUE if the object exists, %FALSE otherwise.
+ *
+ * Stability: Unstable
+ */
+int
+glkunix_unserialize_list_entry(glkunix_unserialize_context_t ctx, int pos, glkunix_unserialize_context_t *subctx)
+{
+	if(!g_variant_is_of_type(ctx->value, G_VARIANT_TYPE("av")))
+		return FALSE;
+	if(pos < 0 || pos >= g_variant_n_children(ctx->value))
+		return FALSE;
+
+	GVariant *boxed = g_variant_get_child_value(ctx->value, pos);
+	GVariant *value = g_variant_get_variant(boxed);
+	g_variant_unref(boxed);
+	if(!g_variant_is_of_type(value, G_VARIANT_TYPE_VARDICT)) {
+		g_variant_unref(value);
+		return FALSE;
+	}
+	*subctx = unserialize_context_new(value, ctx->pool);
+	return TRUE;
+}
+
+/**
+ * glkunix_unserialize_object_list_entries:
+ * @ctx: An unserialization context for a list.
+ * @func: Callback that unserializes one object.
+ * @count: Number of objects to read.
+ * @size: Size of one object in @array, in bytes.
+ * @array: Array to read the objects into.
+ *
+ * Reads back the first @count objects of a list, calling @func for each of
+ * them.
+ *
+ * Returns: %TRUE if all objects were read, %FALSE otherwise.
+ *
+ * Stability: Unstable
+ */
+int
+glkunix_unserialize_object_list_entries(glkunix_unserialize_context_t ctx, glkunix_unserialize_object_f func, int count, size_t size, void *array)
+{
+	for(int ix = 0; ix < count; ix++) {
+		glkunix_unserialize_context_t entry;
+		if(!glkunix_unserialize_list_entry(ctx, ix, &entry))
+			return FALSE;
+		if(!func(entry, (char *)array + ix * size))
+			return FALSE;
+	}
+	return TRUE;
+}
+
+/*
+ *
+ **************** SAVING ******************************************************
+ *
+ */
+
+static void
+add_uint32(GVariantBuilder *builder, const char *key, guint32 val)
+{
+	g_variant_builder_add(builder, "{sv}", key, g_variant_new_uint32(val));
+}
+
+static void
+add_boolean(GVariantBuilder *builder, const char *key, gboolean val)
+{
+	g_variant_builder_add(builder, "{sv}", key, g_variant_new_boolean(val));
+}
+
+/* Internal function: store the style hints that the Glk program has set. */
+static GVariant *
+serialize_stylehints(ChimaraGlkPrivate *glk_data)
+{
+	GVariantBuilder builder;
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("a(uuui)"));
+	for(int index = 0; index < 2; index++) {
+		glui32 wintype = index == 0? wintype_TextBuffer : wintype_TextGrid;
+		for(glui32 styl = 0; styl < style_NUMSTYLES; styl++)
+			for(glui32 hint = 0; hint < stylehint_NUMHINTS; hint++)
+				if(glk_data->stylehints_set[index][styl] & (1 << hint))
+					g_variant_builder_add(&builder, "(uuui)", wintype, styl, hint,
+						glk_data->stylehints[index][styl][hint]);
+	}
+	return g_variant_builder_end(&builder);
+}
+
+/* Internal function: store all file references, oldest first. */
+static GVariant *
+serialize_filerefs(ChimaraGlkPrivate *glk_data)
+{
+	GVariantBuilder list;
+	g_variant_builder_init(&list, G_VARIANT_TYPE("av"));
+	for(GList *iter = g_list_last(glk_data->fileref_list); iter; iter = g_list_previous(iter)) {
+		frefid_t fref = iter->data;
+		GVariantBuilder builder;
+		g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+		add_uint32(&builder, "tag", fref->updatetag);
+		add_uint32(&builder, "rock", fref->rock);
+		add_uint32(&builder, "usage", fref->usage);
+		add_uint32(&builder, "orig_filemode", fref->orig_filemode);
+		g_variant_builder_add(&builder, "{sv}", "filename", g_variant_new_bytestring(fref->filename));
+		g_variant_builder_add(&builder, "{sv}", "basename", g_variant_new_bytestring(fref->basename));
+		g_variant_builder_add(&list, "v", g_variant_builder_end(&builder));
+	}
+	return g_variant_builder_end(&list);
+}
+
+/* Internal function: store the contents of a memory stream's buffer. Returns
+ FALSE if the buffer can't be saved. */
+static gboolean
+serialize_memory_stream(ChimaraGlkPrivate *glk_data, strid_t str, GVariantBuilder *builder)
+{
+	add_uint32(builder, "mark", str->mark);
+	add_uint32(builder, "endmark", str->endmark);
+	if(str->buffer == NULL && str->ubuffer == NULL)
+		return TRUE;
+
+	if(glk_data->locate_arr == NULL) {
+		WARNING("Can't save a memory stream without gidispatch_set_autorestore_registry()");
+		return FALSE;
+	}
+
+	void *buf = str->unicode? (void *)str->ubuffer : (void *)str->buffer;
+	int elemsize;
+	long bufkey = (*glk_data->locate_arr)(buf, str->buflen, str->unicode? "&+#!Iu" : "&+#!Cn", str->buffer_rock, &elemsize);
+	g_variant_builder_add(builder, "{sv}", "buffer", g_variant_new_int64(bufkey));
+	add_uint32(builder, "buflen", str->buflen);
+
+	/* The program's copy of a retained array isn't up to date until the array
+	 is released, so the contents must be saved separately */
+	if(elemsize == 0)
+		return TRUE;
+	if(str->unicode)
+		g_variant_builder_add(builder, "{sv}", "contents",
+			g_variant_new_fixed_array(G_VARIANT_TYPE_UINT32, str->ubuffer, str->buflen, sizeof(glui32)));
+	else
+		g_variant_builder_add(builder, "{sv}", "contents",
+			g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, str->buffer, str->buflen, sizeof(char)));
+	return TRUE;
+}
+
+/* Internal function: store all streams except window streams and
+ @omitstream, oldest first. */
+static GVariant *
+serialize_streams(ChimaraGlkPrivate *glk_data, strid_t omitstream)
+{
+	GVariantBuilder list;
+	g_variant_builder_init(&list, G_VARIANT_TYPE("av"));
+	for(GList *iter = g_list_last(glk_data->stream_list); iter; iter = g_list_previous(iter)) {
+		strid_t str = iter->data;
+		if(str == omitstream || str->type == STREAM_TYPE_WINDOW)
+			continue;
+
+		GVariantBuilder builder;
+		g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+		add_uint32(&builder, "tag", str->updatetag);
+		add_uint32(&builder, "rock", str->rock);
+		add_uint32(&builder, "type", str->type);
+		add_uint32(&builder, "file_mode", str->file_mode);
+		add_uint32(&builder, "read_count", str->read_count);
+		add_uint32(&builder, "write_count", str->write_count);
+		add_boolean(&builder, "unicode", str->unicode);
+		add_boolean(&builder, "binary", str->binary);
+
+		gboolean ok = TRUE;
+		switch(str->type) {
+			case STREAM_TYPE_MEMORY:
+				ok = serialize_memory_stream(glk_data, str, &builder);
+				break;
+			case STREAM_TYPE_FILE:
+			{
+				char *path = g_filename_from_utf8(str->filename, -1, NULL, NULL, NULL);
+				file_stream_sync(str);
+				long position = ftell(str->file_pointer);
+				if(path == NULL || position == -1) {
+					WARNING_S("Can't save file stream", str->filename);
+					ok = FALSE;
+				} else {
+					g_variant_builder_add(&builder, "{sv}", "path", g_variant_new_bytestring(path));
+					g_variant_builder_add(&builder, "{sv}", "position", g_variant_new_int64(position));
+				}
+				g_free(path);
+			}
+				break;
+			case STREAM_TYPE_RESOURCE:
+				add_uint32(&builder, "resource_number", str->resource_number);
+				add_uint32(&builder, "mark", str->mark);
+				break;
+			default:
+				ok = FALSE;
+		}
+
+		if(ok)
+			g_variant_builder_add(&list, "v", g_variant_builder_end(&builder));
+		else
+			g_variant_builder_clear(&builder);
+	}
+	return g_variant_builder_end(&list);
+}
+
+/* Internal function: store the pending input request of a leaf window. */
+static void
+serialize_input_request(ChimaraGlkPrivate *glk_data, winid_t win, GVariantBuilder *builder)
+{
+	add_uint32(builder, "input_request", win->input_request_type);
+
+	if(win->input_request_type == INPUT_REQUEST_LINE || win->input_request_type == INPUT_REQUEST_LINE_UNICODE) {
+		gboolean unicode = win->input_request_type == INPUT_REQUEST_LINE_UNICODE;
+		void *buf = unicode? (void *)win->line_input_buffer_unicode : (void *)win->line_input_buffer;
+		if(glk_data->locate_arr) {
+			int elemsize;
+			long bufkey = (*glk_data->locate_arr)(buf, win->line_input_buffer_max_len, unicode? "&+#!Iu" : "&+#!Cn", win->buffer_rock, &elemsize);
+			g_variant_builder_add(builder, "{sv}", "line_buffer", g_variant_new_int64(bufkey));
+		} else {
+			WARNING("Can't save a line input request without gidispatch_set_autorestore_registry()");
+		}
+		add_uint32(builder, "line_maxlen", win->line_input_buffer_max_len);
+	}
+
+	add_boolean(builder, "mouse", win->mouse_input_requested);
+	add_boolean(builder, "hyperlink", win->hyperlink_event_requested);
+}
+
+/* Internal function: store one window; called for each node of the window
+ tree in preorder, so that parents come before their children. */
+static gboolean
+serialize_window(GNode *node, GVariantBuilder *list)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	winid_t win = node->data;
+
+	GVariantBuilder builder;
+	g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+	add_uint32(&builder, "tag", win->updatetag);
+	add_uint32(&builder, "rock", win->rock);
+	add_uint32(&builder, "type", win->type);
+	add_uint32(&builder, "parent", node->parent? ((winid_t)node->parent->data)->updatetag : 0);
+	add_uint32(&builder, "stream", win->window_stream->updatetag);
+	add_uint32(&builder, "stream_read_count", win->window_stream->read_count);
+	add_uint32(&builder, "stream_write_count", win->window_stream->write_count);
+	add_uint32(&builder, "echo_stream", win->echo_stream? win->echo_stream->updatetag : 0);
+
+	if(win->type == wintype_Pair) {
+		add_uint32(&builder, "key", win->key_window? win->key_window->updatetag : 0);
+		add_uint32(&builder, "split_method", win->split_method);
+		add_uint32(&builder, "constraint_size", win->constraint_size);
+	} else {
+		serialize_input_request(glk_data, win, &builder);
+		add_boolean(&builder, "echo_line_input", win->echo_line_input);
+
+		GVariantBuilder terminators;
+		g_variant_builder_init(&terminators, G_VARIANT_TYPE("au"));
+		for(GSList *iter = win->extra_line_terminators; iter; iter = g_slist_next(iter))
+			g_variant_builder_add(&terminators, "u", GPOINTER_TO_UINT(iter->data));
+		g_variant_builder_add(&builder, "{sv}", "line_terminators", g_variant_builder_end(&terminators));
+
+		if(win->type == wintype_Graphics)
+			add_uint32(&builder, "background_color", win->background_color);
+	}
+
+	g_variant_builder_add(list, "v", g_variant_builder_end(&builder));
+	return FALSE; /* keep going */
+}
+
+static GVariant *
+serialize_windows(ChimaraGlkPrivate *glk_data)
+{
+	GVariantBuilder list;
+	g_variant_builder_init(&list, G_VARIANT_TYPE("av"));
+	if(glk_data->root_window)
+		g_node_traverse(glk_data->root_window, G_PRE_ORDER, G_TRAVERSE_ALL, -1, (GNodeTraverseFunc)serialize_window, &list);
+	return g_variant_builder_end(&list);
+}
+
+/* Internal function: write one library state to disk, on the write thread. */
+static void
+write_library_state(struct autosave_write *job, gpointer unused)
+{
+	gsize len;
+	const char *buf = g_bytes_get_data(job->data, &len);
+	while(len > 0) {
+		ssize_t written = pwrite(job->fd, buf, len, job->offset);
+		if(written == -1) {
+			if(errno == EINTR)
+				continue;
+			WARNING_S("Error writing library state", g_strerror(errno));
+			break;
+		}
+		buf += written;
+		len -= written;
+		job->offset += written;
+	}
+	if(close(job->fd) != 0)
+		WARNING_S("Error closing library state file", g_strerror(errno));
+	g_bytes_unref(job->data);
+	g_slice_free(struct autosave_write, job);
+
+	g_mutex_lock(&write_lock);
+	writes_pending--;
+	g_cond_broadcast(&write_done);
+	g_mutex_unlock(&write_lock);
+}
+
+/* Internal function: write @data to @str. Binary file streams reserve room for
+ the data and hand it over to the write thread, so that the Glk program
+ doesn't have to wait for the disk; other streams are written directly. */
+static void
+put_library_state(strid_t str, GBytes *data)
+{
+	gsize len;
+	const char *buf = g_bytes_get_data(data, &len);
+
+	if(str->type != STREAM_TYPE_FILE || !str->binary || str->unicode) {
+		glk_put_buffer_stream(str, (char *)buf, len);
+		return;
+	}
+
+	int fd = -1;
+	long offset = -1;
+	file_stream_sync(str);
+	if(fflush(str->file_pointer) == 0 && (offset = ftell(str->file_pointer)) != -1)
+		fd = dup(fileno(str->file_pointer));
+	if(fd == -1 || fseek(str->file_pointer, len, SEEK_CUR) != 0) {
+		if(fd != -1)
+			close(fd);
+		IO_WARNING("Error writing library state to", str->filename, g_strerror(errno));
+		return;
+	}
+	str->lastop = 0;
+	str->write_count += len;
+
+	struct autosave_write *job = g_slice_new(struct autosave_write);
+	job->fd = fd;
+	job->offset = offset;
+	job->data = g_bytes_ref(data);
+
+	g_mutex_lock(&write_lock);
+	if(write_pool == NULL)
+		write_pool = g_thread_pool_new((GFunc)write_library_state, NULL, 1, FALSE, NULL);
+	writes_pending++;
+	g_mutex_unlock(&write_lock);
+	g_thread_pool_push(write_pool, job, NULL);
+}
+
+/* Internal function: wait until all library states handed to the write thread
+ are on disk. Call this before anything that might read or truncate the file
+ that they are being written to. */
+void
+autosave_wait_for_writes(void)
+{
+	g_mutex_lock(&write_lock);
+	while(writes_pending > 0)
+		g_cond_wait(&write_done, &write_lock);
+	g_mutex_unlock(&write_lock);
+}
+
+/**
+ * glkunix_save_library_state:
+ * @file: Stream to write the library state to.
+ * @omitstream: A stream that should not be saved, or %NULL. This is usually
+ * @file itself.
+ * @extra_state_func: Callback that saves the interpreter's own extra state, or
+ * %NULL.
+ * @extra_state_rock: Data to pass to @extra_state_func.
+ *
+ * Writes the state of the Glk library to @file: all windows, streams, and file
+ * references, the style hints, the current stream, the timer, and the pending
+ * input requests. Memory stream buffers and line input buffers are saved by
+ * means of the callbacks passed to gidispatch_set_autorestore_registry().
+ *
+ * > # Chimara #
+ * > If @file is a binary file stream, the data is written on a background
+ * > thread, and this function returns before it is on disk. Chimara waits for
+ * > the write to finish before the file can be opened for writing again, read
+ * > by glkunix_load_library_state(), or the Glk program exits.
+ *
+ * Returns: %TRUE on success, %FALSE if @extra_state_func failed.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serialize_object_f extra_state_func, void *extra_state_rock)
+{
+	VALID_STREAM(file, return FALSE);
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+
+	/* Input requests are carried out by the UI thread; wait for it to catch up
+	 with all the messages sent so far */
+	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+
+	GVariantBuilder builder;
+	g_variant_builder_init(&builder, G_VARIANT_TYPE_VARDICT);
+	add_uint32(&builder, "version", AUTOSAVE_VERSION);
+	add_uint32(&builder, "current_stream", glk_data->current_stream? glk_data->current_stream->updatetag : 0);
+	add_uint32(&builder, "resource_file", glk_data->resource_file? glk_data->resource_file->updatetag : 0);
+	add_uint32(&builder, "timer_interval", glk_data->timer_interval);
+	g_variant_builder_add(&builder, "{sv}", "stylehints", serialize_stylehints(glk_data));
+	g_variant_builder_add(&builder, "{sv}", "filerefs", serialize_filerefs(glk_data));
+	g_variant_builder_add(&builder, "{sv}", "streams", serialize_streams(glk_data, omitstream));
+	g_variant_builder_add(&builder, "{sv}", "windows", serialize_windows(glk_data));
+
+	if(extra_state_func) {
+		struct glkunix_serialize_context_struct ctx;
+		g_variant_builder_init(&ctx.builder, G_VARIANT_TYPE_VARDICT);
+		if(!extra_state_func(&ctx, extra_state_rock)) {
+			g_variant_builder_clear(&ctx.builder);
+			g_variant_builder_clear(&builder);
+			return FALSE;
+		}
+		g_variant_builder_add(&builder, "{sv}", "extra_state", g_variant_builder_end(&ctx.builder));
+	}
+
+	GVariant *state = g_variant_ref_sink(g_variant_builder_end(&builder));
+	if(G_BYTE_ORDER == G_BIG_ENDIAN) {
+		GVariant *swapped = g_variant_byteswap(state);
+		g_variant_unref(state);
+		state = swapped;
+	}
+	GBytes *data = g_variant_get_data_as_bytes(state);
+	g_variant_unref(state);
+
+	put_library_state(file, data);
+	g_bytes_unref(data);
+	return TRUE;
+}
+
+/**
+ * glkunix_load_library_state:
+ * @file: Stream to read the library state from.
+ * @extra_state_func: Callback that reads the interpreter's own extra state, or
+ * %NULL.
+ * @extra_state_rock: Data to pass to @extra_state_func.
+ *
+ * Reads a library state written by glkunix_save_library_state(). This does not
+ * change anything yet; call glkunix_update_from_library_state() for that, once
+ * the interpreter has restored its own state.
+ *
+ * Returns: a library state, or %NULL if @file did not contain one, or if
+ * @extra_state_func failed. Free it with glkunix_library_state_free().
+ *
+ * Stability: Unstable
+ */
+glkunix_library_state_t
+glkunix_load_library_state(strid_t file, glkunix_unserialize_object_f extra_state_func, void *extra_state_rock)
+{
+	VALID_STREAM(file, return NULL);
+
+	autosave_wait_for_writes();
+
+	GByteArray *contents = g_byte_array_new();
+	char buf[4096];
+	glui32 count;
+	while((count = glk_get_buffer_stream(file, buf, sizeof(buf))) > 0)
+		g_byte_array_append(contents, (guint8 *)buf, count);
+	GBytes *data = g_byte_array_free_to_bytes(contents);
+
+	GVariant *value = g_variant_ref_sink(g_variant_new_from_bytes(G_VARIANT_TYPE_VARDICT, data, FALSE));
+	g_bytes_unref(data);
+	if(G_BYTE_ORDER == G_BIG_ENDIAN) {
+		GVariant *swapped = g_variant_byteswap(value);
+		g_variant_unref(value);
+		value = swapped;
+	}
+
+	glui32 version;
+	if(!g_variant_lookup(value, "version", "u", &version) || version != AUTOSAVE_VERSION) {
+		WARNING("Not a library state, or one from an incompatible version");
+		g_variant_unref(value);
+		return NULL;
+	}
+
+	if(extra_state_func) {
+		GVariant *extra = g_variant_lookup_value(value, "extra_state", G_VARIANT_TYPE_VARDICT);
+		if(extra == NULL) {
+			g_variant_unref(value);
+			return NULL;
+		}
+		GPtrArray *pool = g_ptr_array_new_with_free_func((GDestroyNotify)unserialize_context_free);
+		int success = extra_state_func(unserialize_context_new(extra, pool), extra_state_rock);
+		g_ptr_array_free(pool, TRUE);
+		if(!success) {
+			g_variant_unref(value);
+			return NULL;
+		}
+	}
+
+	glkunix_library_state_t state = g_slice_new(struct glk_library_state_struct);
+	state->value = value;
+	return state;
+}
+
+/**
+ * glkunix_library_state_free:
+ * @state: A library state.
+ *
+ * Frees a library state returned by glkunix_load_library_state().
+ *
+ * Stability: Unstable
+ */
+void
+glkunix_library_state_free(glkunix_library_state_t state)
+{
+	g_return_if_fail(state);
+	g_variant_unref(state->value);
+	g_slice_free(struct glk_library_state_struct, state);
+}
+
+/*
+ *
+ **************** RESTORING ***************************************************
+ *
+ */
+
+/* Holds the objects restored so far, by update tag */
+struct restore_data {
+	ChimaraGlkPrivate *glk_data;
+	GHashTable *windows;
+	GHashTable *streams;
+	glui32 max_tag;
+};
+
+static guint32
+lookup_uint32(GVariant *dict, const char *key)
+{
+	guint32 val = 0;
+	g_variant_lookup(dict, key, "u", &val);
+	return val;
+}
+
+static gboolean
+lookup_boolean(GVariant *dict, const char *key)
+{
+	gboolean val = FALSE;
+	g_variant_lookup(dict, key, "b", &val);
+	return val;
+}
+
+/* Internal function: call @func for each object in the list under @key in
+ @dict. Stops and returns FALSE if @func does. */
+static gboolean
+foreach_object(GVariant *dict, const char *key, gboolean (*func)(GVariant *, struct restore_data *), struct restore_data *data)
+{
+	GVariant *list = g_variant_lookup_value(dict, key, G_VARIANT_TYPE("av"));
+	if(list == NULL)
+		return TRUE;
+
+	gboolean success = TRUE;
+	GVariantIter iter;
+	GVariant *object;
+	g_variant_iter_init(&iter, list);
+	while(success && g_variant_iter_next(&iter, "v", &object)) {
+		if(g_variant_is_of_type(object, G_VARIANT_TYPE_VARDICT))
+			success = func(object, data);
+		else
+			success = FALSE;
+		g_variant_unref(object);
+	}
+	g_variant_unref(list);
+	return success;
+}
+
+static void
+note_tag(struct restore_data *data, glui32 tag)
+{
+	if(tag > data->max_tag)
+		data->max_tag = tag;
+}
+
+static gboolean
+restore_fileref(GVariant *dict, struct restore_data *data)
+{
+	const char *filename = NULL, *basename = NULL;
+	g_variant_lookup(dict, "filename", "^&ay", &filename);
+	g_variant_lookup(dict, "basename", "^&ay", &basename);
+	if(filename == NULL || *filename == '\0')
+		return FALSE;
+
+	frefid_t fref = fileref_new((char *)filename, (char *)basename, lookup_uint32(dict, "rock"),
+		lookup_uint32(dict, "usage"), lookup_uint32(dict, "orig_filemode"));
+	fref->updatetag = lookup_uint32(dict, "tag");
+	note_tag(data, fref->updatetag);
+	return TRUE;
+}
+
+static strid_t
+restore_memory_stream(GVariant *dict, struct restore_data *data)
+{
+	ChimaraGlkPrivate *glk_data = data->glk_data;
+	gboolean unicode = lookup_boolean(dict, "unicode");
+
+	void *buf = NULL;
+	gidispatch_rock_t arrrock = { 0 };
+	gint64 bufkey;
+	glui32 buflen = lookup_uint32(dict, "buflen");
+	if(g_variant_lookup(dict, "buffer", "x", &bufkey) && buflen > 0) {
+		if(glk_data->restore_arr == NULL) {
+			WARNING("Can't restore a memory stream without gidispatch_set_autorestore_registry()");
+			return NULL;
+		}
+		arrrock = (*glk_data->restore_arr)(bufkey, buflen, unicode? "&+#!Iu" : "&+#!Cn", &buf);
+	}
+
+	strid_t str = stream_new_common(lookup_uint32(dict, "rock"));
+	str->type = STREAM_TYPE_MEMORY;
+	str->unicode = unicode;
+	if(buf) {
+		if(unicode)
+			str->ubuffer = buf;
+		else
+			str->buffer = buf;
+		str->buflen = buflen;
+		str->buffer_rock = arrrock;
+
+		GVariant *contents = g_variant_lookup_value(dict, "contents", unicode? G_VARIANT_TYPE("au") : G_VARIANT_TYPE_BYTESTRING);
+		if(contents) {
+			gsize n_elements;
+			const void *elements = g_variant_get_fixed_array(contents, &n_elements, unicode? sizeof(glui32) : sizeof(char));
+			if(n_elements == buflen)
+				memcpy(buf, elements, buflen * (unicode? sizeof(glui32) : sizeof(char)));
+			g_variant_unref(contents);
+		}
+	}
+	str->mark = MIN(lookup_uint32(dict, "mark"), str->buflen);
+	str->endmark = MIN(lookup_uint32(dict, "endmark"), str->buflen);
+	return str;
+}
+
+static gboolean
+restore_stream(GVariant *dict, struct restore_data *data)
+{
+	strid_t str = NULL;
+	glui32 file_mode = lookup_uint32(dict, "file_mode");
+
+	switch(lookup_uint32(dict, "type")) {
+		case STREAM_TYPE_MEMORY:
+			str = restore_memory_stream(dict, data);
+			break;
+		case STREAM_TYPE_FILE:
+		{
+			const char *path = NULL;
+			gint64 position = 0;
+			g_variant_lookup(dict, "path", "^&ay", &path);
+			g_variant_lookup(dict, "position", "x", &position);
+			if(path == NULL || *path == '\0')
+				return FALSE;
+			str = file_stream_reopen(path, file_mode, lookup_boolean(dict, "binary"),
+				lookup_boolean(dict, "unicode"), position, lookup_uint32(dict, "rock"));
+		}
+			break;
+		case STREAM_TYPE_RESOURCE:
+			return TRUE; /* after the resource map, see restore_resource_stream() */
+		default:
+			return FALSE;
+	}
+
+	/* A missing file is not fatal; the program will notice that the stream is
+	 gone */
+	if(str == NULL)
+		return TRUE;
+
+	str->file_mode = file_mode;
+	str->read_count = lookup_uint32(dict, "read_count");
+	str->write_count = lookup_uint32(dict, "write_count");
+	str->updatetag = lookup_uint32(dict, "tag");
+	note_tag(data, str->updatetag);
+	g_hash_table_insert(data->streams, GUINT_TO_POINTER(str->updatetag), str);
+	return TRUE;
+}
+
+static gboolean
+restore_resource_stream(GVariant *dict, struct restore_data *data)
+{
+	if(lookup_uint32(dict, "type") != STREAM_TYPE_RESOURCE)
+		return TRUE;
+
+	strid_t str = glk_stream_open_resource(lookup_uint32(dict, "resource_number"), lookup_uint32(dict, "rock"));
+	if(str == NULL)
+		return TRUE;
+
+	str->unicode = lookup_boolean(dict, "unicode");
+	str->mark = MIN(lookup_uint32(dict, "mark"), str->buflen);
+	str->read_count = lookup_uint32(dict, "read_count");
+	str->updatetag = lookup_uint32(dict, "tag");
+	note_tag(data, str->updatetag);
+	g_hash_table_insert(data->streams, GUINT_TO_POINTER(str->updatetag), str);
+	return TRUE;
+}
+
+/* Internal function: create a window and link it into the window tree.
+ The windows come in preorder, so the parent has always been restored
+ already. */
+static gboolean
+restore_window(GVariant *dict, struct restore_data *data)
+{
+	ChimaraGlkPrivate *glk_data = data->glk_data;
+
+	glui32 type = lookup_uint32(dict, "type");
+	if(type != wintype_Pair && type != wintype_Blank && type != wintype_TextBuffer
+		&& type != wintype_TextGrid && type != wintype_Graphics)
+		return FALSE;
+
+	winid_t parent = NULL;
+	glui32 parent_tag = lookup_uint32(dict, "parent");
+	if(parent_tag != 0) {
+		parent = g_hash_table_lookup(data->windows, GUINT_TO_POINTER(parent_tag));
+		if(parent == NULL || parent->type != wintype_Pair)
+			return FALSE;
+	} else if(glk_data->root_window != NULL) {
+		return FALSE;
+	}
+
+	winid_t win = window_new_common(lookup_uint32(dict, "rock"));
+	win->type = type;
+	win->updatetag = lookup_uint32(dict, "tag");
+	note_tag(data, win->updatetag);
+	g_hash_table_insert(data->windows, GUINT_TO_POINTER(win->updatetag), win);
+
+	win->window_stream->updatetag = lookup_uint32(dict, "stream");
+	win->window_stream->read_count = lookup_uint32(dict, "stream_read_count");
+	win->window_stream->write_count = lookup_uint32(dict, "stream_write_count");
+	note_tag(data, win->window_stream->updatetag);
+	g_hash_table_insert(data->streams, GUINT_TO_POINTER(win->window_stream->updatetag), win->window_stream);
+
+	if(type == wintype_Pair) {
+		win->split_method = lookup_uint32(dict, "split_method");
+		win->constraint_size = lookup_uint32(dict, "constraint_size");
+	} else {
+		win->echo_line_input = lookup_boolean(dict, "echo_line_input");
+
+		GVariant *terminators = g_variant_lookup_value(dict, "line_terminators", G_VARIANT_TYPE("au"));
+		if(terminators) {
+			GVariantIter iter;
+			guint32 keyval;
+			g_variant_iter_init(&iter, terminators);
+			while(g_variant_iter_next(&iter, "u", &keyval))
+				win->extra_line_terminators = g_slist_append(win->extra_line_terminators, GUINT_TO_POINTER(keyval));
+			g_variant_unref(terminators);
+		}
+
+		if(type == wintype_Graphics) {
+			win->unit_width = 1;
+			win->unit_height = 1;
+			win->background_color = lookup_uint32(dict, "background_color");
+			win->backing_store = NULL;
+		}
+
+		/* Hold up in order to create the UI widgets first */
+		ui_message_queue_and_await(ui_message_new(UI_MESSAGE_CREATE_WINDOW, win));
+	}
+
+	g_mutex_lock(&glk_data->arrange_lock);
+	if(parent)
+		g_node_append(parent->window_node, win->window_node);
+	else
+		glk_data->root_window = win->window_node;
+	g_mutex_unlock(&glk_data->arrange_lock);
+
+	return TRUE;
+}
+
+/* Internal function: fill in the references from windows to other objects,
+ once all windows and streams exist. */
+static gboolean
+restore_window_links(GVariant *dict, struct restore_data *data)
+{
+	winid_t win = g_hash_table_lookup(data->windows, GUINT_TO_POINTER(lookup_uint32(dict, "tag")));
+
+	glui32 echo_tag = lookup_uint32(dict, "echo_stream");
+	if(echo_tag != 0)
+		win->echo_stream = g_hash_table_lookup(data->streams, GUINT_TO_POINTER(echo_tag));
+
+	if(win->type == wintype_Pair) {
+		winid_t key = g_hash_table_lookup(data->windows, GUINT_TO_POINTER(lookup_uint32(dict, "key")));
+		g_mutex_lock(&data->glk_data->arrange_lock);
+		win->key_window = key;
+		g_mutex_unlock(&data->glk_data->arrange_lock);
+	}
+	return TRUE;
+}
+
+/* Internal function: clear a restored window and make its input request
+ again. */
+static gboolean
+restore_window_input(GVariant *dict, struct restore_data *data)
+{
+	ChimaraGlkPrivate *glk_data = data->glk_data;
+	winid_t win = g_hash_table_lookup(data->windows, GUINT_TO_POINTER(lookup_uint32(dict, "tag")));
+	if(win->type == wintype_Pair)
+		return TRUE;
+
+	glk_window_clear(win);
+
+	switch(lookup_uint32(dict, "input_request")) {
+		case INPUT_REQUEST_CHARACTER:
+			glk_request_char_event(win);
+			break;
+		case INPUT_REQUEST_CHARACTER_UNICODE:
+			glk_request_char_event_uni(win);
+			break;
+		case INPUT_REQUEST_LINE:
+		case INPUT_REQUEST_LINE_UNICODE:
+		{
+			gboolean unicode = lookup_uint32(dict, "input_request") == INPUT_REQUEST_LINE_UNICODE;
+			glui32 maxlen = lookup_uint32(dict, "line_maxlen");
+			gint64 bufkey;
+			if(!g_variant_lookup(dict, "line_buffer", "x", &bufkey) || maxlen == 0 || glk_data->restore_arr == NULL) {
+				WARNING("Can't restore a line input request");
+				break;
+			}
+			void *buf = NULL;
+			gidispatch_rock_t arrrock = (*glk_data->restore_arr)(bufkey, maxlen, unicode? "&+#!Iu" : "&+#!Cn", &buf);
+			if(buf == NULL)
+				break;
+			if(unicode)
+				glk_request_line_event_uni(win, buf, maxlen, 0);
+			else
+				glk_request_line_event(win, buf, maxlen, 0);
+			win->buffer_rock = arrrock;
+		}
+			break;
+	}
+
+	if(lookup_boolean(dict, "mouse"))
+		glk_request_mouse_event(win);
+	if(lookup_boolean(dict, "hyperlink"))
+		glk_request_hyperlink_event(win);
+	return TRUE;
+}
+
+/* Internal function: close all windows, streams, and file references, and
+ forget the resource map, which refers to one of the streams. */
+static void
+close_all_objects(ChimaraGlkPrivate *glk_data)
+{
+	glk_request_timer_events(0);
+
+	giblorb_unset_resource_map();
+
+	if(glk_data->root_window)
+		glk_window_close(glk_data->root_window->data, NULL);
+	strid_t str;
+	while( (str = glk_stream_iterate(NULL, NULL)) )
+		glk_stream_close(str, NULL);
+	frefid_t fref;
+	while( (fref = glk_fileref_iterate(NULL, NULL)) )
+		glk_fileref_destroy(fref);
+
+	for(int index = 0; index < 2; index++) {
+		glui32 wintype = index == 0? wintype_TextBuffer : wintype_TextGrid;
+		for(glui32 styl = 0; styl < style_NUMSTYLES; styl++)
+			for(glui32 hint = 0; hint < stylehint_NUMHINTS; hint++)
+				if(glk_data->stylehints_set[index][styl] & (1 << hint))
+					glk_stylehint_clear(wintype, styl, hint);
+	}
+}
+
+static gboolean
+restore_library_state(GVariant *value, struct restore_data *data)
+{
+	ChimaraGlkPrivate *glk_data = data->glk_data;
+
+	GVariant *stylehints = g_variant_lookup_value(value, "stylehints", G_VARIANT_TYPE("a(uuui)"));
+	if(stylehints) {
+		GVariantIter iter;
+		guint32 wintype, styl, hint;
+		gint32 val;
+		g_variant_iter_init(&iter, stylehints);
+		while(g_variant_iter_next(&iter, "(uuui)", &wintype, &styl, &hint, &val))
+			glk_stylehint_set(wintype, styl, hint, val);
+		g_variant_unref(stylehints);
+	}
+
+	if(!foreach_object(value, "filerefs", restore_fileref, data)
+		|| !foreach_object(value, "streams", restore_stream, data))
+		return FALSE;
+
+	glui32 resource_tag = lookup_uint32(value, "resource_file");
+	strid_t resource_file = resource_tag? g_hash_table_lookup(data->streams, GUINT_TO_POINTER(resource_tag)) : NULL;
+	if(resource_file && giblorb_set_resource_map(resource_file) != giblorb_err_None)
+		WARNING("Could not restore the resource map");
+	if(!foreach_object(value, "streams", restore_resource_stream, data))
+		return FALSE;
+
+	if(!foreach_object(value, "windows", restore_window, data)
+		|| !foreach_object(value, "windows", restore_window_links, data))
+		return FALSE;
+	ui_message_queue(ui_message_new(UI_MESSAGE_ARRANGE_SILENTLY, NULL));
+	if(!foreach_object(value, "windows", restore_window_input, data))
+		return FALSE;
+
+	glui32 current_tag = lookup_uint32(value, "current_stream");
+	glk_data->current_stream = current_tag? g_hash_table_lookup(data->streams, GUINT_TO_POINTER(current_tag)) : NULL;
+
+	glk_request_timer_events(lookup_uint32(value, "timer_interval"));
+	return TRUE;
+}
+
+/**
+ * glkunix_update_from_library_state:
+ * @state: A library state returned by glkunix_load_library_state().
+ *
+ * Replaces all windows, streams, and file references with the ones in @state,
+ * and restores the style hints, the current stream, the timer, and the pending
+ * input requests. The objects that are closed are passed to the unregistering
+ * callbacks as usual, but the new objects are not passed to the registering
+ * callbacks. Instead, the interpreter should find them with
+ * glkunix_window_find_by_updatetag() and friends, and set their dispatch rocks
+ * itself.
+ *
+ * The resource map, if any, is recreated from the restored stream that it
+ * was read from.
+ *
+ * Returns: %TRUE on success, %FALSE if @state was damaged. In that case, some
+ * of the objects may have been restored and others not.
+ *
+ * Stability: Unstable
+ */
+glui32
+glkunix_update_from_library_state(glkunix_library_state_t state)
+{
+	g_return_val_if_fail(state, FALSE);
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+
+	close_all_objects(glk_data);
+
+	/* Don't register the new objects */
+	gidispatch_rock_t (*register_obj)(void *, glui32) = glk_data->register_obj;
+	gidispatch_rock_t (*register_arr)(void *, glui32, char *) = glk_data->register_arr;
+	glk_data->register_obj = NULL;
+	glk_data->register_arr = NULL;
+
+	struct restore_data data;
+	data.glk_data = glk_data;
+	data.windows = g_hash_table_new(NULL, NULL);
+	data.streams = g_hash_table_new(NULL, NULL);
+	data.max_tag = 0;
+
+	gboolean success = restore_library_state(state->value, &data);
+
+	g_hash_table_destroy(data.windows);
+	g_hash_table_destroy(data.streams);
+	glk_data->register_obj = register_obj;
+	glk_data->register_arr = register_arr;
+
+	/* New objects must not reuse any of the restored tags */
+	if(data.max_tag > glk_data->last_updatetag)
+		glk_data->last_updatetag = data.max_tag;
+
+	glk_data->last_event_type = 0xFFFFFFFE;
+	return success;
+}
@@ -2,9 +2,287 @@
 
 #include <glib.h>
 
-#include "charset.h"
 #include "glk.h"
 
+/* The case mappings, in the order of the deltas and special mappings in
+ * CaseRecord. CASE_NONE leaves a character unchanged. */
+typedef enum {
+	CASE_UPPER,
+	CASE_LOWER,
+	CASE_TITLE,
+	CASE_NONE
+} CaseMode;
+
+typedef struct {
+	gint32 delta[3];  /* Simple one-to-one mapping, as an offset */
+	guint16 special[3];  /* Offset of a one-to-many mapping in case_special */
+} CaseRecord;
+
+typedef struct {
+	glui32 first;
+	glui32 second;
+	glui32 composite;
+} CompositionPair;
+
+#include "unicode-tables.h"
+
+/* Look up @ch in the two-stage table @table, whose entries are all 0 from
+ * @limit upwards */
+#define TABLE_LOOKUP(table, limit, ch) \
+	((ch) >= (limit) ? 0 : \
+	table##_stage2[(table##_stage1[(ch) >> UNICODE_TABLES_SHIFT] << UNICODE_TABLES_SHIFT) | ((ch) & UNICODE_TABLES_MASK)])
+
+/* Hangul syllable constants, from chapter 3.12 of the Unicode spec */
+#define HANGUL_SBASE 0xAC00
+#define HANGUL_LBASE 0x1100
+#define HANGUL_VBASE 0x1161
+#define HANGUL_TBASE 0x11A7
+#define HANGUL_LCOUNT 19
+#define HANGUL_VCOUNT 21
+#define HANGUL_TCOUNT 28
+#define HANGUL_NCOUNT (HANGUL_VCOUNT * HANGUL_TCOUNT)
+#define HANGUL_SCOUNT (HANGUL_LCOUNT * HANGUL_NCOUNT)
+
+/* Internal function: store the case mapping of @ch in @mode into @out, which
+ * must have room for CASE_MAX_EXPANSION characters. Returns the number of
+ * characters stored. */
+static inline unsigned
+map_case(glui32 ch, CaseMode mode, glui32 *out)
+{
+	if (mode == CASE_NONE) {
+		out[0] = ch;
+		return 1;
+	}
+
+	const CaseRecord *rec = &case_records[TABLE_LOOKUP(case, CASE_LIMIT, ch)];
+	guint16 special = rec->special[mode];
+	if (special) {
+		unsigned count = case_special[special];
+		memcpy(out, case_special + special + 1, count * sizeof(glui32));
+		return count;
+	}
+	out[0] = ch + rec->delta[mode];
+	return 1;
+}
+
+/* Internal function: change the case of @buf in place, mapping the first
+ * character with @first and the rest with @rest. Characters are mapped one by
+ * one going forwards until one of them expands; from there on, the rest of the
+ * buffer is measured and then mapped going backwards from its final length,
+ * so that output never overwrites characters that have not been read yet.
+ * Output beyond @len is dropped, but counted. */
+static glui32
+buffer_change_case(glui32 *buf, glui32 len, glui32 numchars, CaseMode first, CaseMode rest)
+{
+	glui32 mapped[CASE_MAX_EXPANSION];
+	glui32 ix;
+	CaseMode mode = first;
+
+	for (ix = 0; ix < numchars; ix++, mode = rest) {
+		glui32 ch = buf[ix];
+		if (mode == CASE_NONE)
+			return numchars;
+		/* Fast path for ASCII */
+		if (ch < 0x80) {
+			if (mode == CASE_LOWER) {
+				if (ch >= 'A' && ch <= 'Z')
+					buf[ix] = ch + 0x20;
+			} else if (ch >= 'a' && ch <= 'z') {
+				buf[ix] = ch - 0x20;
+			}
+			continue;
+		}
+		if (map_case(ch, mode, mapped) != 1)
+			break;
+		buf[ix] = mapped[0];
+	}
+	if (ix == numchars)
+		return numchars;
+
+	glui32 expanded = ix, jx;
+	for (jx = ix; jx < numchars; jx++)
+		expanded += map_case(buf[jx], jx == 0 ? first : rest, mapped);
+
+	glui32 out = expanded;
+	for (jx = numchars; jx-- > ix; ) {
+		unsigned count = map_case(buf[jx], jx == 0 ? first : rest, mapped);
+		while (count-- > 0) {
+			out--;
+			if (out < len)
+				buf[out] = mapped[count];
+		}
+	}
+	return expanded;
+}
+
+/* Internal function: canonical combining class of @ch */
+static inline guint8
+combining_class(glui32 ch)
+{
+	return TABLE_LOOKUP(norm_ccc, NORM_CCC_LIMIT, ch);
+}
+
+/* Internal function: store the full canonical decomposition of @ch into @out,
+ * which must have room for NORM_MAX_DECOMPOSITION characters. Returns the
+ * number of characters stored. */
+static inline unsigned
+decompose_char(glui32 ch, glui32 *out)
+{
+	if (ch - HANGUL_SBASE < HANGUL_SCOUNT) {
+		glui32 sindex = ch - HANGUL_SBASE;
+		out[0] = HANGUL_LBASE + sindex / HANGUL_NCOUNT;
+		out[1] = HANGUL_VBASE + (sindex % HANGUL_NCOUNT) / HANGUL_TCOUNT;
+		if (sindex % HANGUL_TCOUNT == 0)
+			return 2;
+		out[2] = HANGUL_TBASE + sindex % HANGUL_TCOUNT;
+		return 3;
+	}
+
+	guint16 offset = TABLE_LOOKUP(norm_decomp, NORM_DECOMP_LIMIT, ch);
+	if (offset == 0) {
+		out[0] = ch;
+		return 1;
+	}
+	unsigned count = norm_decomp_data[offset];
+	memcpy(out, norm_decomp_data + offset + 1, count * sizeof(glui32));
+	return count;
+}
+
+/* Internal function: put each run of combining characters in @buf into
+ * canonical order. This is a stable insertion sort on the combining class;
+ * the runs are nearly always very short. */
+static void
+canonical_reorder(glui32 *buf, glui32 count)
+{
+	glui32 ix;
+	for (ix = 1; ix < count; ix++) {
+		glui32 ch = buf[ix];
+		guint8 ccc = combining_class(ch);
+		if (ccc == 0)
+			continue;
+		glui32 jx = ix;
+		while (jx > 0 && combining_class(buf[jx - 1]) > ccc) {
+			buf[jx] = buf[jx - 1];
+			jx--;
+		}
+		buf[jx] = ch;
+	}
+}
+
+/* Internal function: decompose @buf in place, in the same way as
+ * buffer_change_case(). If the decomposition is longer than @len, returns its
+ * length without finishing; @buf then still holds a string canonically
+ * equivalent to the original. */
+static glui32
+buffer_decompose(glui32 *buf, glui32 len, glui32 numchars)
+{
+	glui32 decomposed[NORM_MAX_DECOMPOSITION];
+	glui32 ix;
+
+	for (ix = 0; ix < numchars; ix++) {
+		glui32 ch = buf[ix];
+		if (ch < NFD_QUICK_LIMIT)
+			continue;
+		if (decompose_char(ch, decomposed) != 1)
+			break;
+		buf[ix] = decomposed[0];
+	}
+
+	glui32 expanded = numchars;
+	if (ix < numchars) {
+		glui32 jx;
+		expanded = ix;
+		for (jx = ix; jx < numchars; jx++)
+			expanded += decompose_char(buf[jx], decomposed);
+		if (expanded > len)
+			return expanded;
+
+		glui32 out = expanded;
+		for (jx = numchars; jx-- > ix; ) {
+			unsigned count = decompose_char(buf[jx], decomposed);
+			while (count-- > 0)
+				buf[--out] = decomposed[count];
+		}
+	}
+
+	canonical_reorder(buf, expanded);
+	return expanded;
+}
+
+/* Internal function: return the primary composite of @first and @second, or 0
+ * if they do not compose. */
+static glui32
+compose_pair(glui32 first, glui32 second)
+{
+	if (first - HANGUL_LBASE < HANGUL_LCOUNT && second - HANGUL_VBASE < HANGUL_VCOUNT)
+		return HANGUL_SBASE + ((first - HANGUL_LBASE) * HANGUL_VCOUNT + second - HANGUL_VBASE) * HANGUL_TCOUNT;
+	if (first - HANGUL_SBASE < HANGUL_SCOUNT && (first - HANGUL_SBASE) % HANGUL_TCOUNT == 0
+		&& second - HANGUL_TBASE - 1 < HANGUL_TCOUNT - 1)
+		return first + second - HANGUL_TBASE;
+
+	size_t lo = 0, hi = G_N_ELEMENTS(norm_compositions);
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		const CompositionPair *pair = &norm_compositions[mid];
+		if (pair->first < first || (pair->first == first && pair->second < second))
+			lo = mid + 1;
+		else if (pair->first == first && pair->second == second)
+			return pair->composite;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/* Internal function: canonically compose the decomposed string in @buf in
+ * place, following the algorithm in chapter 3.11 of the Unicode spec.
+ * Composition never makes a string longer. Returns the new length. */
+static glui32
+canonical_compose(glui32 *buf, glui32 count)
+{
+	if (count == 0)
+		return 0;
+
+	glui32 starter_pos = 0;
+	glui32 starter = buf[0];
+	/* 256 means no starter has been seen yet, so nothing can compose */
+	unsigned last_class = combining_class(starter) ? 256 : 0;
+	glui32 out = 1, ix;
+
+	for (ix = 1; ix < count; ix++) {
+		glui32 ch = buf[ix];
+		unsigned ccc = combining_class(ch);
+		glui32 composite;
+		if ((last_class < ccc || last_class == 0) && (composite = compose_pair(starter, ch)) != 0) {
+			buf[starter_pos] = starter = composite;
+			continue;
+		}
+		if (ccc == 0) {
+			starter_pos = out;
+			starter = ch;
+		}
+		last_class = ccc;
+		buf[out++] = ch;
+	}
+	return out;
+}
+
+/* Internal function: normalize @buf when its decomposition, @decomposed
+ * characters long, doesn't fit in @len. The canonical ordering of combining
+ * characters can't be done on a truncated string, so this needs temporary
+ * space. Copies back as much of the result as fits and returns its length. */
+static glui32
+normalize_with_overflow(glui32 *buf, glui32 len, glui32 numchars, glui32 decomposed, gboolean compose)
+{
+	g_autofree glui32 *tmp = g_new(glui32, decomposed);
+	memcpy(tmp, buf, numchars * sizeof(glui32));
+	glui32 outchars = buffer_decompose(tmp, decomposed, numchars);
+	if (compose)
+		outchars = canonical_compose(tmp, outchars);
+	memcpy(buf, tmp, MIN(outchars, len) * sizeof(glui32));
+	return outchars;
+}
+
 /**
  * glk_char_to_lower:
  * @ch: A Latin-1 character.
@@ -98,24 +376,7 @@ glk_buffer_to_lower_case_uni(glui32 *buf, glui32 len, glui32 numchars)
 	g_return_val_if_fail(buf != NULL && (len > 0 || numchars > 0), 0);
 	g_return_val_if_fail(numchars <= len, 0);
 
-	long outchars;
-
-	/* Lowercase the string */
-	char *utf8 = convert_ucs4_to_utf8(buf, numchars);
-	if(!utf8)
-		return numchars;
-	char *lowered = g_utf8_strdown(utf8, -1);
-	g_free(utf8);
-	gunichar *outbuf = convert_utf8_to_ucs4(lowered, &outchars);
-	g_free(lowered);
-	if(!outbuf)
-		return numchars;
-	
-	/* Copy the output buffer to the original buffer */
-	memcpy(buf, outbuf, MIN(outchars, len) * 4);
-	g_free(outbuf);
-	
-	return outchars;
+	return buffer_change_case(buf, len, numchars, CASE_LOWER, CASE_LOWER);
 }
 
 /**
@@ -134,25 +395,8 @@ glk_buffer_to_upper_case_uni(glui32 *buf, glui32 len, glui32 numchars)
 {
 	g_return_val_if_fail(buf != NULL && (len > 0 || numchars > 0), 0);
 	g_return_val_if_fail(numchars <= len, 0);
-	
-	long outchars;
-	
-	/* Uppercase the string */
-	char *utf8 = convert_ucs4_to_utf8(buf, numchars);
-	if(!utf8)
-		return numchars;
-	char *uppered = g_utf8_strup(utf8, -1);
-	g_free(utf8);
-	gunichar *outbuf = convert_utf8_to_ucs4(uppered, &outchars);
-	g_free(uppered);
-	if(!outbuf)
-		return numchars;
-
-	/* Copy the output buffer to the original buffer */
-	memcpy(buf, outbuf, MIN(outchars, len) * 4);
-	g_free(outbuf);
 
-	return outchars;
+	return buffer_change_case(buf, len, numchars, CASE_UPPER, CASE_UPPER);
 }
 
 /**
@@ -184,253 +428,9 @@ glk_buffer_to_title_case_uni(glui32 *buf, glui32 len, glui32 numchars, glui32 lo
 	g_return_val_if_fail(buf != NULL && (len > 0 || numchars > 0), 0);
 	g_return_val_if_fail(numchars <= len, 0);
 
-	/* Special-cases not handled by g_unichar_totitle() because they expand to
-	 * more than one character in title case.
-	 * Source: https://www.unicode.org/Public/UCD/latest/ucd/SpecialCasing.txt
-	 * Does not include any context- or locale-sensitive case mappings. */
-	unsigned tlen = 0;
-	glui32 titled[3];
-	switch (buf[0]) {
-	case 0x00df:  /* LATIN SMALL LETTER SHARP S */
-		titled[tlen++] = 0x0053;
-		titled[tlen++] = 0x0073;
-		break;
-	case 0xfb00:  /* LATIN SMALL LIGATURE FF */
-		titled[tlen++] = 0x0046;
-		titled[tlen++] = 0x0066;
-		break;
-	case 0xfb01:  /* LATIN SMALL LIGATURE FI */
-		titled[tlen++] = 0x0046;
-		titled[tlen++] = 0x0069;
-		break;
-	case 0xfb02:  /* LATIN SMALL LIGATURE FL */
-		titled[tlen++] = 0x0046;
-		titled[tlen++] = 0x006c;
-		break;
-	case 0xfb03:  /* LATIN SMALL LIGATURE FFI */
-		titled[tlen++] = 0x0046;
-		titled[tlen++] = 0x0066;
-		titled[tlen++] = 0x0069;
-		break;
-	case 0xfb04:  /* LATIN SMALL LIGATURE FFL */
-		titled[tlen++] = 0x0046;
-		titled[tlen++] = 0x0066;
-		titled[tlen++] = 0x006c;
-		break;
-	case 0xfb05:  /* LATIN SMALL LIGATURE LONG S T */
-		titled[tlen++] = 0x0053;
-		titled[tlen++] = 0x0074;
-		break;
-	case 0xfb06:  /* LATIN SMALL LIGATURE ST */
-		titled[tlen++] = 0x0053;
-		titled[tlen++] = 0x0074;
-		break;
-	case 0x0587:  /* ARMENIAN SMALL LIGATURE ECH YIWN */
-		titled[tlen++] = 0x0535;
-		titled[tlen++] = 0x0582;
-		break;
-	case 0xfb13:  /* ARMENIAN SMALL LIGATURE MEN NOW */
-		titled[tlen++] = 0x0544;
-		titled[tlen++] = 0x0576;
-		break;
-	case 0xfb14:  /* ARMENIAN SMALL LIGATURE MEN ECH */
-		titled[tlen++] = 0x0544;
-		titled[tlen++] = 0x0565;
-		break;
-	case 0xfb15:  /* ARMENIAN SMALL LIGATURE MEN INI */
-		titled[tlen++] = 0x0544;
-		titled[tlen++] = 0x056b;
-		break;
-	case 0xfb16:  /* ARMENIAN SMALL LIGATURE VEW NOW */
-		titled[tlen++] = 0x054e;
-		titled[tlen++] = 0x0576;
-		break;
-	case 0xfb17:  /* ARMENIAN SMALL LIGATURE MEN XEH */
-		titled[tlen++] = 0x0544;
-		titled[tlen++] = 0x056d;
-		break;
-	case 0x0149:  /* LATIN SMALL LETTER N PRECEDED BY APOSTROPHE */
-		titled[tlen++] = 0x02bc;
-		titled[tlen++] = 0x004e;
-		break;
-	case 0x0390:  /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND TONOS */
-		titled[tlen++] = 0x0399;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0301;
-		break;
-	case 0x03b0:  /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND TONOS */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0301;
-		break;
-	case 0x01f0:  /* LATIN SMALL LETTER J WITH CARON */
-		titled[tlen++] = 0x004a;
-		titled[tlen++] = 0x030c;
-		break;
-	case 0x1e96:  /* LATIN SMALL LETTER H WITH LINE BELOW */
-		titled[tlen++] = 0x0048;
-		titled[tlen++] = 0x0331;
-		break;
-	case 0x1e97:  /* LATIN SMALL LETTER T WITH DIAERESIS */
-		titled[tlen++] = 0x0054;
-		titled[tlen++] = 0x0308;
-		break;
-	case 0x1e98:  /* LATIN SMALL LETTER W WITH RING ABOVE */
-		titled[tlen++] = 0x0057;
-		titled[tlen++] = 0x030a;
-		break;
-	case 0x1e99:  /* LATIN SMALL LETTER Y WITH RING ABOVE */
-		titled[tlen++] = 0x0059;
-		titled[tlen++] = 0x030a;
-		break;
-	case 0x1e9a:  /* LATIN SMALL LETTER A WITH RIGHT HALF RING */
-		titled[tlen++] = 0x0041;
-		titled[tlen++] = 0x02be;
-		break;
-	case 0x1f50:  /* GREEK SMALL LETTER UPSILON WITH PSILI */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0313;
-		break;
-	case 0x1f52:  /* GREEK SMALL LETTER UPSILON WITH PSILI AND VARIA */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0313;
-		titled[tlen++] = 0x0300;
-		break;
-	case 0x1f54:  /* GREEK SMALL LETTER UPSILON WITH PSILI AND OXIA */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0313;
-		titled[tlen++] = 0x0301;
-		break;
-	case 0x1f56:  /* GREEK SMALL LETTER UPSILON WITH PSILI AND PERISPOMENI */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0313;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fb6:  /* GREEK SMALL LETTER ALPHA WITH PERISPOMENI */
-		titled[tlen++] = 0x0391;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fc6:  /* GREEK SMALL LETTER ETA WITH PERISPOMENI */
-		titled[tlen++] = 0x0397;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fd2:  /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND VARIA */
-		titled[tlen++] = 0x0399;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0300;
-		break;
-	case 0x1fd3:  /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND OXIA */
-		titled[tlen++] = 0x0399;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0301;
-		break;
-	case 0x1fd6:  /* GREEK SMALL LETTER IOTA WITH PERISPOMENI */
-		titled[tlen++] = 0x0399;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fd7:  /* GREEK SMALL LETTER IOTA WITH DIALYTIKA AND PERISPOMENI */
-		titled[tlen++] = 0x0399;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fe2:  /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND VARIA */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0300;
-		break;
-	case 0x1fe3:  /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND OXIA */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0301;
-		break;
-	case 0x1fe4:  /* GREEK SMALL LETTER RHO WITH PSILI */
-		titled[tlen++] = 0x03a1;
-		titled[tlen++] = 0x0313;
-		break;
-	case 0x1fe6:  /* GREEK SMALL LETTER UPSILON WITH PERISPOMENI */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fe7:  /* GREEK SMALL LETTER UPSILON WITH DIALYTIKA AND PERISPOMENI */
-		titled[tlen++] = 0x03a5;
-		titled[tlen++] = 0x0308;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1ff6:  /* GREEK SMALL LETTER OMEGA WITH PERISPOMENI */
-		titled[tlen++] = 0x03a9;
-		titled[tlen++] = 0x0342;
-		break;
-	case 0x1fb2:  /* GREEK SMALL LETTER ALPHA WITH VARIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x1fba;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1fb4:  /* GREEK SMALL LETTER ALPHA WITH OXIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x0386;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1fc2:  /* GREEK SMALL LETTER ETA WITH VARIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x1fca;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1fc4:  /* GREEK SMALL LETTER ETA WITH OXIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x0389;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1ff2:  /* GREEK SMALL LETTER OMEGA WITH VARIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x1ffa;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1ff4:  /* GREEK SMALL LETTER OMEGA WITH OXIA AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x038f;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1fb7:  /* GREEK SMALL LETTER ALPHA WITH PERISPOMENI AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x0391;
-		titled[tlen++] = 0x0342;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1fc7:  /* GREEK SMALL LETTER ETA WITH PERISPOMENI AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x0397;
-		titled[tlen++] = 0x0342;
-		titled[tlen++] = 0x0345;
-		break;
-	case 0x1ff7:  /* GREEK SMALL LETTER OMEGA WITH PERISPOMENI AND YPOGEGRAMMENI */
-		titled[tlen++] = 0x03a9;
-		titled[tlen++] = 0x0342;
-		titled[tlen++] = 0x0345;
-		break;
-	}
-
-	if (tlen == 0) {
-		/* Easy path. g_unichar_totitle() returns the titlecase of one Unicode
-		 * code point, but that is only correct if the titlecase character is
-		 * also one code point. */
-		*buf = g_unichar_totitle(*buf);
-		/* Call lowercase on the rest of the string */
-		if (lowerrest)
-			return glk_buffer_to_lower_case_uni(buf + 1, len - 1, numchars - 1) + 1;
-		return numchars;
-	}
-
-	/* This code handles the special cases from the above switch statement. For
-	 * example, the one-character 'ffi' ligature should be title-cased to the
-	 * three-character string 'Ffi'. */
-
-	/* Allocate a new buffer, because the number of characters has already
-	 * changed. */
-	g_autofree glui32 *newbuf = g_new0(glui32, len + tlen);
-
-	memcpy(newbuf, titled, tlen * sizeof(glui32));
-	memcpy(newbuf + tlen, buf + 1, (numchars - 1) * sizeof(glui32));
-
-	if (!lowerrest) {
-		memcpy(buf, newbuf, len * sizeof(glui32));
-		return numchars + tlen - 1;
-	}
-
-	glui32 lowercount = glk_buffer_to_lower_case_uni(newbuf + tlen, len - tlen, numchars - 1);
-	memcpy(buf, newbuf, len * sizeof(glui32));
-	return lowercount + tlen;
+	/* Title-case the first character, which may expand to more than one
+	 * character (for example, the 'ffi' ligature becomes 'Ffi') */
+	return buffer_change_case(buf, len, numchars, CASE_TITLE, lowerrest ? CASE_LOWER : CASE_NONE);
 }
 
 /**
@@ -457,24 +457,10 @@ glk_buffer_canon_decompose_uni(glui32 *buf, glui32 len, glui32 numchars)
 	g_return_val_if_fail(buf != NULL && (len > 0 || numchars > 0), 0);
 	g_return_val_if_fail(numchars <= len, 0);
 
-	long outchars;
-
-	/* Normalize the string */
-	char *utf8 = convert_ucs4_to_utf8(buf, numchars);
-	if(!utf8)
-		return numchars;
-	char *decomposed = g_utf8_normalize(utf8, -1, G_NORMALIZE_NFD);
-	g_free(utf8);
-	gunichar *outbuf = convert_utf8_to_ucs4(decomposed, &outchars);
-	g_free(decomposed);
-	if(!outbuf)
-		return numchars;
-
-	/* Copy the output buffer to the original buffer */
-	memcpy(buf, outbuf, MIN(outchars, len) * 4);
-	g_free(outbuf);
-
-	return outchars;
+	glui32 decomposed = buffer_decompose(buf, len, numchars);
+	if (decomposed <= len)
+		return decomposed;
+	return normalize_with_overflow(buf, len, numchars, decomposed, FALSE);
 }
 
 /**
@@ -536,22 +522,16 @@ glk_buffer_canon_normalize_uni(glui32 *buf, glui32 len, glui32 numchars)
 	g_return_val_if_fail(buf != NULL && (len > 0 || numchars > 0), 0);
 	g_return_val_if_fail(numchars <= len, 0);
 
-	long outchars;
-
-	/* Normalize the string */
-	char *utf8 = convert_ucs4_to_utf8(buf, numchars);
-	if(!utf8)
-		return numchars;
-	char *decomposed = g_utf8_normalize(utf8, -1, G_NORMALIZE_NFC);
-	g_free(utf8);
-	gunichar *outbuf = convert_utf8_to_ucs4(decomposed, &outchars);
-	g_free(decomposed);
-	if(!outbuf)
+	/* Fast path for strings that are certainly already normalized */
+	glui32 ix;
+	for (ix = 0; ix < numchars && buf[ix] < NFC_QUICK_LIMIT; ix++)
+		;
+	if (ix == numchars)
 		return numchars;
 
-	/* Copy the output buffer to the original buffer */
-	memcpy(buf, outbuf, MIN(outchars, len) * 4);
-	g_free(outbuf);
-
-	return outchars;
+	glui32 decomposed = buffer_decompose(buf, len, numchars);
+	if (decomposed <= len)
+		return canonical_compose(buf, decomposed);
+	/* The intermediate decomposition doesn't fit, even if the result would */
+	return normalize_with_overflow(buf, len, numchars, decomposed, TRUE);
 }
@@ -3,6 +3,11 @@
 #include "charset.h"
 #include "magic.h"
 
+/* Number of characters converted per inner loop iteration in the conversions
+between Latin-1 and UCS-4. A fixed-size inner loop lets the compiler vectorize
+it at -O2. */
+#define CONVERT_CHUNK 16
+
 /* Internal function: change illegal (control) characters in a string to a
 placeholder character. Must free returned string afterwards. */
 static gchar *
@@ -45,10 +50,8 @@ gchar *
 convert_latin1_to_ucs4be_string(const gchar *s, const gsize len)
 {
 	/* "UCS-4BE" is also a conversion type in g_convert()... but this may be more efficient */
-	gchar *retval = g_new0(gchar, len * 4);
-	int i;
-	for(i = 0; i < len; i++)
-		retval[i * 4 + 3] = s[i];
+	gchar *retval = g_new(gchar, len * 4);
+	convert_latin1_to_ucs4be_buffer(s, len, retval);
 	return retval;
 }
 
@@ -98,32 +101,124 @@ convert_ucs4_to_utf8(const gunichar *buf, const glong len)
 	return retval;
 }
 
-/* Internal function: Convert a Unicode buffer to a Latin-1 string. Do not do
-any character processing, just return values > 255 as the placeholder character.
-The returned string must be freed afterwards.*/
+/* Internal function: convert a Unicode buffer to a four-byte-per-character
+big-endian string of gchars. The string must be freed afterwards. */
 gchar *
-convert_ucs4_to_latin1_binary(const gunichar *buf, const glong len)
+convert_ucs4_to_ucs4be_string(const gunichar *buf, const glong len)
 {
-	gchar *retval = g_new0(gchar, len);
-	int foo;
-	for(foo = 0; foo < len; foo++)
-		retval[foo] = (buf[foo] > 255)? PLACEHOLDER : buf[foo];
+	gchar *retval = g_new(gchar, len * 4);
+	convert_ucs4_to_ucs4be_buffer(buf, len, retval);
 	return retval;
 }
 
+/* The following functions do the same conversions as the ones above, but write
+into a buffer supplied by the caller instead of allocating a string, and return
+the number of bytes written. They don't NUL-terminate the output. */
+
+/* Internal function: convert a Latin-1 string to UTF-8, replacing Latin-1
+control characters by a placeholder. @out must have room for 2 * @len bytes. */
+gsize
+convert_latin1_to_utf8_buffer(const gchar *s, const gsize len, gchar *out)
+{
+	gchar *start = out;
+	gsize i;
+	for(i = 0; i < len; i++)
+	{
+		unsigned char ch = s[i];
+		if( (ch < 32 && ch != 10) || (ch >= 127 && ch <= 159) )
+			*out++ = PLACEHOLDER;
+		else if(ch < 0x80)
+			*out++ = ch;
+		else
+		{
+			*out++ = 0xC0 | ch >> 6;
+			*out++ = 0x80 | (ch & 0x3F);
+		}
+	}
+	return out - start;
+}
+
+/* Internal function: convert a Latin-1 string to a four-byte-per-character
+big-endian string. @out must have room for 4 * @len bytes. */
+gsize
+convert_latin1_to_ucs4be_buffer(const gchar *s, const gsize len, gchar *out)
+{
+	gsize i;
+	for(i = 0; i < len; i++)
+	{
+		out[i * 4]     = 0;
+		out[i * 4 + 1] = 0;
+		out[i * 4 + 2] = 0;
+		out[i * 4 + 3] = s[i];
+	}
+	return len * 4;
+}
+
+/* Internal function: convert a Unicode buffer to UTF-8, replacing characters
+that are not valid Unicode by a placeholder. @out must have room for 4 * @len
+bytes. */
+gsize
+convert_ucs4_to_utf8_buffer(const gunichar *buf, const gsize len, gchar *out)
+{
+	gchar *start = out;
+	gsize i;
+	for(i = 0; i < len; i++)
+	{
+		if(buf[i] < 0x80)
+			*out++ = buf[i];
+		else if(g_unichar_validate(buf[i]))
+			out += g_unichar_to_utf8(buf[i], out);
+		else
+			*out++ = PLACEHOLDER;
+	}
+	return out - start;
+}
+
+/* Internal function: convert a Unicode buffer to Latin-1 without any character
+processing, just writing values > 255 as the placeholder character. @out must
+have room for @len bytes, and must not overlap @buf. */
+gsize
+convert_ucs4_to_latin1_binary_buffer(const gunichar *restrict buf, const gsize len, gchar *restrict out)
+{
+	gsize i = 0;
+	for(; i + CONVERT_CHUNK <= len; i += CONVERT_CHUNK) {
+		for(gsize j = 0; j < CONVERT_CHUNK; j++)
+			out[i + j] = (buf[i + j] > 255)? PLACEHOLDER : buf[i + j];
+	}
+	for(; i < len; i++)
+		out[i] = (buf[i] > 255)? PLACEHOLDER : buf[i];
+	return len;
+}
+
+/* Internal function: convert a Latin-1 string to UCS-4 without any character
+processing. @out must have room for @len characters, and must not overlap @s.
+Returns the number of characters written. */
+gsize
+convert_latin1_to_ucs4_buffer(const gchar *restrict s, const gsize len, gunichar *restrict out)
+{
+	const unsigned char *in = (const unsigned char *)s;
+	gsize i = 0;
+	for(; i + CONVERT_CHUNK <= len; i += CONVERT_CHUNK) {
+		for(gsize j = 0; j < CONVERT_CHUNK; j++)
+			out[i + j] = in[i + j];
+	}
+	for(; i < len; i++)
+		out[i] = in[i];
+	return len;
+}
+
 /* Internal function: convert a Unicode buffer to a four-byte-per-character
-big-endian string of gchars. The string must be freed afterwards. */
-gchar *
-convert_ucs4_to_ucs4be_string(const gunichar *buf, const glong len)
+big-endian string. @out must have room for 4 * @len bytes. */
+gsize
+convert_ucs4_to_ucs4be_buffer(const gunichar *buf, const gsize len, gchar *out)
 {
-	gchar *retval = g_new0(gchar, len * 4);
-	int i;
+	gsize i;
 	for(i = 0; i < len; i++)
 	{
-		retval[i * 4]     = buf[i] >> 24       ;
-		retval[i * 4 + 1] = buf[i] >> 16 & 0xFF;
-		retval[i * 4 + 2] = buf[i] >> 8  & 0xFF;
-		retval[i * 4 + 3] = buf[i]       & 0xFF;
+		out[i * 4]     = buf[i] >> 24       ;
+		out[i * 4 + 1] = buf[i] >> 16 & 0xFF;
+		out[i * 4 + 2] = buf[i] >> 8  & 0xFF;
+		out[i * 4 + 3] = buf[i]       & 0xFF;
 	}
-	return retval;
+	return len * 4;
 }
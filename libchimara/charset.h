@@ -12,7 +12,12 @@ G_GNUC_INTERNAL gchar *convert_latin1_to_ucs4be_string(const gchar *s, const gsi
 G_GNUC_INTERNAL gchar *convert_utf8_to_latin1(const gchar *s, gsize *bytes_written);
 G_GNUC_INTERNAL gunichar *convert_utf8_to_ucs4(const gchar *s, glong *items_written);
 G_GNUC_INTERNAL gchar *convert_ucs4_to_utf8(const gunichar *buf, const glong len);
-G_GNUC_INTERNAL gchar *convert_ucs4_to_latin1_binary(const gunichar *buf, const glong len);
 G_GNUC_INTERNAL gchar *convert_ucs4_to_ucs4be_string(const gunichar *buf, const glong len);
+G_GNUC_INTERNAL gsize convert_latin1_to_utf8_buffer(const gchar *s, const gsize len, gchar *out);
+G_GNUC_INTERNAL gsize convert_latin1_to_ucs4be_buffer(const gchar *s, const gsize len, gchar *out);
+G_GNUC_INTERNAL gsize convert_latin1_to_ucs4_buffer(const gchar *restrict s, const gsize len, gunichar *restrict out);
+G_GNUC_INTERNAL gsize convert_ucs4_to_utf8_buffer(const gunichar *buf, const gsize len, gchar *out);
+G_GNUC_INTERNAL gsize convert_ucs4_to_latin1_binary_buffer(const gunichar *restrict buf, const gsize len, gchar *restrict out);
+G_GNUC_INTERNAL gsize convert_ucs4_to_ucs4be_buffer(const gunichar *buf, const gsize len, gchar *out);
 
 #endif /* CHARSET_H */
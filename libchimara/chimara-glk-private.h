@@ -5,10 +5,12 @@
 #include <gmodule.h>
 
 #include "chimara-glk.h"
+#include "event.h"
 #include "glk.h"
 #include "glkstart.h"
 #include "gi_blorb.h"
 #include "gi_dispa.h"
+#include "metrics.h"
 
 G_BEGIN_DECLS
 
@@ -40,6 +42,13 @@ struct _ChimaraGlkPrivate {
     gboolean protect;
 	/* Spacing between Glk windows */
 	guint spacing;
+	/* Lines kept in text buffer windows before archiving, or 0 */
+	guint scrollback_lines;
+	/* Whether to keep the plugin loaded between runs */
+	gboolean persistent_plugin;
+	/* Size to lay the Glk windows out in without a widget hierarchy, or 0 */
+	int headless_width;
+	int headless_height;
 	/* The CSS file to read style defaults from */
 	gchar *css_file;
 	/* Hashtable containing the current styles set by CSS and GLK */
@@ -52,6 +61,14 @@ struct _ChimaraGlkPrivate {
 	/* Size allocate flags */
 	gboolean needs_rearrange;
 	gboolean ignore_next_arrange_event;
+	/* Number of arrangements requested by the Glk thread, and the number of
+	the last one that the UI thread has carried out; if those are equal, the
+	Glk thread can read window sizes without waiting for the UI thread */
+	unsigned arranges_requested;  /* Glk thread only */
+	unsigned arrange_pending;     /* UI thread only */
+	int arranges_completed;       /* atomic */
+	/* Incremented whenever the styles change other than through style hints */
+	int styles_generation;        /* atomic */
 
 	/* *** Threading data *** */
 	/* Whether program is running */
@@ -60,13 +77,16 @@ struct _ChimaraGlkPrivate {
 	gboolean after_finalize;
     /* Glk program loaded in widget */
     GModule *program;
+	/* Path the loaded plugin was opened from */
+	char *program_path;
     /* Thread in which Glk program is run */
     GThread *thread;
 	/* Pipe through which to schedule updates to the UI */
 	unsigned ui_message_handler_id;
 	GAsyncQueue *ui_message_queue;
     /* Event queue and threading stuff */
-    GQueue *event_queue;
+	EventQueue event_queue;
+	gboolean event_queue_closed;
 	GMutex event_lock;
 	GCond event_queue_not_empty;
 	GCond event_queue_not_full;
@@ -86,6 +106,14 @@ struct _ChimaraGlkPrivate {
 	GCond resource_loaded;
 	GCond resource_info_available;
 	guint32 resource_available;
+	/* Detected media types of sound resources, shared with GStreamer threads */
+	GMutex sound_types_lock;
+	GHashTable *sound_types;
+	/* Runtime metrics, written by the Glk thread and read by the UI thread */
+	ChimaraMetrics metrics;
+	/* Seconds between emissions of the metrics signal, or 0 */
+	guint metrics_interval;
+	guint metrics_timeout_id;
 
 	/* *** Glk library data *** */
 	/* Info about current plugin */
@@ -102,12 +130,27 @@ struct _ChimaraGlkPrivate {
     GList *fileref_list;
     /* Current stream */
     strid_t current_stream;
+	/* Results of glk_style_measure() from the UI thread, with one bit per
+	style hint telling whether the result is known */
+	gint64 style_measure_cache[2][style_NUMSTYLES][stylehint_NUMHINTS];
+	guint32 style_measure_valid[2][style_NUMSTYLES];
+	int style_measure_generation;
+	/* Style hints set by the Glk program, with one bit per style hint telling
+	whether it is set, so that they can be autosaved */
+	glsi32 stylehints[2][style_NUMSTYLES][stylehint_NUMHINTS];
+	guint32 stylehints_set[2][style_NUMSTYLES];
     /* List of streams currently in existence */
     GList *stream_list;
 	/* List of sound channels currently in existence */
 	GList *schannel_list;
 	/* Current timer */
 	guint timer_id;
+	glui32 timer_interval;
+	/* Type of the last event returned by glk_select(), see
+	glkunix_get_last_event_type() */
+	glui32 last_event_type;
+	/* Last tag given to a window, stream, or fileref */
+	glui32 last_updatetag;
 	/* Current resource blorb map */
 	giblorb_map_t *resource_map;
 	/* File stream pointing to the blorb used as current resource map */
@@ -121,6 +164,9 @@ struct _ChimaraGlkPrivate {
 	void (*unregister_obj)(void *, glui32, gidispatch_rock_t);
 	gidispatch_rock_t (*register_arr)(void *, glui32, char *);
 	void (*unregister_arr)(void *, glui32, char *, gidispatch_rock_t);
+	/* Callbacks for saving and restoring retained arrays when autosaving */
+	long (*locate_arr)(void *, glui32, char *, gidispatch_rock_t, int *);
+	gidispatch_rock_t (*restore_arr)(long, glui32, char *, void **);
 
 	/* *** Platform-dependent Glk library data *** */
 	/* Flag for functions to find out if they are being called from startup code */
@@ -137,7 +183,7 @@ G_GNUC_INTERNAL void chimara_glk_push_event(ChimaraGlk *self, uint32_t type, win
 G_GNUC_INTERNAL void chimara_glk_init_textbuffer_styles(ChimaraGlk *self, ChimaraGlkWindowType wintype, GtkTextBuffer *buffer);
 G_GNUC_INTERNAL GtkTextTag *chimara_glk_get_glk_tag(ChimaraGlk *self, ChimaraGlkWindowType window, const char *name);
 G_GNUC_INTERNAL gboolean chimara_glk_needs_rearrange(ChimaraGlk *self);
-G_GNUC_INTERNAL void chimara_glk_queue_arrange(ChimaraGlk *self, gboolean suppress_next_arrange_event);
+G_GNUC_INTERNAL void chimara_glk_queue_arrange(ChimaraGlk *self, gboolean suppress_next_arrange_event, unsigned arrange_number);
 G_GNUC_INTERNAL gboolean chimara_glk_process_queue(ChimaraGlk *self);
 G_GNUC_INTERNAL void chimara_glk_drain_queue(ChimaraGlk *self);
 G_GNUC_INTERNAL void chimara_glk_stop_processing_queue(ChimaraGlk *self);
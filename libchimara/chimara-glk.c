@@ -20,7 +20,10 @@
 #include "graphics.h"
 #include "init.h"
 #include "magic.h"
+#include "metrics.h"
 #include "style.h"
+#include "trace.h"
+#include "ui-grid.h"
 #include "ui-message.h"
 #include "window.h"
 
@@ -28,7 +31,6 @@
 #define CHIMARA_GLK_MIN_HEIGHT 0
 #define CHIMARA_NUM_STYLES 12
 #define EVENT_TIMEOUT_MICROSECONDS 3000000
-#define EVENT_QUEUE_MAX_LENGTH 100
 
 /**
  * SECTION:chimara-glk
@@ -97,6 +99,7 @@
  */
 
 typedef void (* glk_main_t) (void);
+typedef void (* glkunix_reset_code_t) (void);
 typedef int (* glkunix_startup_code_t) (glkunix_startup_t*);
 
 /* The first 11 tag names must correspond to the first 11 glk tag names as defined below */
@@ -136,10 +139,13 @@ enum {
     PROP_INTERACTIVE,
     PROP_PROTECT,
 	PROP_SPACING,
+	PROP_SCROLLBACK_LINES,
+	PROP_PERSISTENT_PLUGIN,
 	PROP_PROGRAM_NAME,
 	PROP_PROGRAM_INFO,
 	PROP_STORY_NAME,
-	PROP_RUNNING
+	PROP_RUNNING,
+	PROP_METRICS_INTERVAL
 };
 
 enum {
@@ -150,6 +156,7 @@ enum {
 	LINE_INPUT,
 	TEXT_BUFFER_OUTPUT,
 	ILIAD_SCREEN_UPDATE,
+	METRICS,
 
 	LAST_SIGNAL
 };
@@ -184,6 +191,7 @@ chimara_glk_reset_glk_styles(ChimaraGlk *self)
 
 	priv->glk_styles->text_grid = glk_text_grid_styles;
 	priv->glk_styles->text_buffer = glk_text_buffer_styles;
+	g_atomic_int_inc(&priv->styles_generation);
 }
 
 /* Reset style tables to the library's internal defaults */
@@ -404,7 +412,6 @@ chimara_glk_init(ChimaraGlk *self)
 	priv->glk_styles = g_new0(StyleSet,1);
 	priv->final_message = g_strdup("[ The game has finished ]");
 	priv->ui_message_queue = g_async_queue_new_full((GDestroyNotify)ui_message_free);
-    priv->event_queue = g_queue_new();
 	reset_input_queues(priv);
 
 	g_mutex_init(&priv->event_lock);
@@ -412,6 +419,9 @@ chimara_glk_init(ChimaraGlk *self)
 	g_mutex_init(&priv->shutdown_lock);
 	g_mutex_init(&priv->arrange_lock);
 	g_mutex_init(&priv->resource_lock);
+	g_mutex_init(&priv->sound_types_lock);
+	priv->sound_types = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	metrics_init(&priv->metrics);
 
 	g_cond_init(&priv->event_queue_not_empty);
 	g_cond_init(&priv->event_queue_not_full);
@@ -438,6 +448,15 @@ chimara_glk_set_property(GObject *object, guint prop_id, const GValue *value, GP
 		case PROP_SPACING:
 			chimara_glk_set_spacing( glk, g_value_get_uint(value) );
 			break;
+		case PROP_SCROLLBACK_LINES:
+			chimara_glk_set_scrollback_lines(glk, g_value_get_uint(value));
+			break;
+		case PROP_PERSISTENT_PLUGIN:
+			chimara_glk_set_persistent_plugin(glk, g_value_get_boolean(value));
+			break;
+		case PROP_METRICS_INTERVAL:
+			chimara_glk_set_metrics_interval(glk, g_value_get_uint(value));
+			break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
     }
@@ -459,6 +478,12 @@ chimara_glk_get_property(GObject *object, guint prop_id, GValue *value, GParamSp
 		case PROP_SPACING:
 			g_value_set_uint(value, priv->spacing);
 			break;
+		case PROP_SCROLLBACK_LINES:
+			g_value_set_uint(value, priv->scrollback_lines);
+			break;
+		case PROP_PERSISTENT_PLUGIN:
+			g_value_set_boolean(value, priv->persistent_plugin);
+			break;
 		case PROP_PROGRAM_NAME:
 			g_value_set_string(value, priv->program_name);
 			break;
@@ -471,6 +496,9 @@ chimara_glk_get_property(GObject *object, guint prop_id, GValue *value, GParamSp
 		case PROP_RUNNING:
 			g_value_set_boolean(value, priv->running);
 			break;
+		case PROP_METRICS_INTERVAL:
+			g_value_set_uint(value, priv->metrics_interval);
+			break;
 		default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
     }
@@ -490,6 +518,9 @@ chimara_glk_finalize(GObject *object)
 	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
 	priv->after_finalize = TRUE;
 
+	if(priv->metrics_timeout_id != 0)
+		g_source_remove(priv->metrics_timeout_id);
+
 	/* Free widget properties */
 	g_free(priv->final_message);
 	/* Free styles */
@@ -502,11 +533,10 @@ chimara_glk_finalize(GObject *object)
 
     /* Free the event queue */
     g_mutex_lock(&priv->event_lock);
-	g_queue_foreach(priv->event_queue, (GFunc)g_free, NULL);
-	g_queue_free(priv->event_queue);
+	event_queue_clear(&priv->event_queue);
 	g_cond_clear(&priv->event_queue_not_empty);
 	g_cond_clear(&priv->event_queue_not_full);
-	priv->event_queue = NULL;
+	priv->event_queue_closed = TRUE;
 	g_mutex_unlock(&priv->event_lock);
 	g_mutex_clear(&priv->event_lock);
 
@@ -532,6 +562,9 @@ chimara_glk_finalize(GObject *object)
 	g_cond_clear(&priv->resource_info_available);
 	g_mutex_unlock(&priv->resource_lock);
 	g_mutex_clear(&priv->resource_lock);
+	g_hash_table_destroy(priv->sound_types);
+	g_mutex_clear(&priv->sound_types_lock);
+	metrics_clear(&priv->metrics);
 	g_slist_foreach(priv->image_cache, (GFunc)clear_image_cache_iterate, NULL);
 	g_slist_free(priv->image_cache);
 
@@ -544,6 +577,7 @@ chimara_glk_finalize(GObject *object)
 	
 	/* Free other stuff */
 	g_free(priv->current_dir);
+	g_free(priv->program_path);
 	g_free(priv->program_name);
 	g_free(priv->program_info);
 	g_free(priv->story_name);
@@ -815,6 +849,9 @@ allocate_recurse(winid_t win, GtkAllocation *allocation, guint spacing)
 			}
 		}
 	
+		if(new_width != win->grid_columns || new_height != win->grid_rows)
+			ui_grid_resize_cells(win, new_width, new_height);
+
 		gboolean arrange = !(win->width == new_width && win->height == new_height);
 		win->width = new_width;
 		win->height = new_height;
@@ -852,6 +889,7 @@ chimara_glk_size_allocate(GtkWidget *widget, GtkAllocation *allocation)
 		winid_t arrange = allocate_recurse(priv->root_window->data, &child, priv->spacing);
 		g_mutex_unlock(&priv->arrange_lock);
 		priv->needs_rearrange = FALSE;
+		g_atomic_int_set(&priv->arranges_completed, priv->arrange_pending);
 
 		/* arrange points to a window that contains all text grid and graphics
 		 windows which have been resized */
@@ -1053,6 +1091,19 @@ chimara_glk_class_init(ChimaraGlkClass *klass)
 		G_STRUCT_OFFSET(ChimaraGlkClass, iliad_screen_update), NULL, NULL,
 		_chimara_marshal_VOID__BOOLEAN,
 		G_TYPE_NONE, 1, G_TYPE_BOOLEAN);
+	/**
+	 * ChimaraGlk::metrics:
+	 * @self: The widget that received the signal
+	 * @metrics: The metrics of the running Glk program, in the same form as
+	 * returned by chimara_glk_get_metrics()
+	 *
+	 * Emitted periodically while a Glk program is running, every
+	 * #ChimaraGlk:metrics-interval seconds.
+	 */
+	chimara_glk_signals[METRICS] = g_signal_new("metrics",
+		G_OBJECT_CLASS_TYPE(klass), 0, 0, NULL, NULL,
+		g_cclosure_marshal_VOID__VARIANT,
+		G_TYPE_NONE, 1, G_TYPE_VARIANT);
 
     /* Properties */
     /**
@@ -1098,6 +1149,40 @@ chimara_glk_class_init(ChimaraGlkClass *klass)
 		"The amount of space between Glk windows",
 		0, G_MAXUINT, 0,
 		G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_LAX_VALIDATION | G_PARAM_STATIC_STRINGS) );
+
+	/**
+	 * ChimaraGlk:scrollback-lines:
+	 *
+	 * The number of lines of text that text buffer windows keep on display.
+	 * When a window grows past this limit, the oldest lines are moved into a
+	 * compressed archive, so that printing does not slow down during long
+	 * sessions. Archived text is brought back when the user scrolls to the top
+	 * of the window. Text the user has not yet seen is never archived.
+	 * A value of 0 means no limit.
+	 */
+	g_object_class_install_property(object_class, PROP_SCROLLBACK_LINES,
+		g_param_spec_uint("scrollback-lines", "Scrollback lines",
+		"Number of lines kept in text buffer windows, or 0 for no limit",
+		0, G_MAXUINT, 0,
+		G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_LAX_VALIDATION | G_PARAM_STATIC_STRINGS) );
+
+	/**
+	 * ChimaraGlk:persistent-plugin:
+	 *
+	 * Whether to keep a plugin loaded when the same plugin is run again. This
+	 * saves loading and relocating the module for each game, which adds up
+	 * when running many short sessions in a row.
+	 *
+	 * Most interpreters keep state in static variables, so a plugin is only
+	 * kept loaded if it exports a `glkunix_reset_code()` function, which
+	 * Chimara calls to reset that state before starting the plugin again.
+	 * Other plugins are reloaded as usual.
+	 */
+	g_object_class_install_property(object_class, PROP_PERSISTENT_PLUGIN,
+		g_param_spec_boolean("persistent-plugin", "Persistent plugin",
+		"Whether to keep a plugin loaded between runs",
+		FALSE,
+		G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS) );
 	
 	/**
 	 * ChimaraGlk:program-name:
@@ -1156,6 +1241,20 @@ chimara_glk_class_init(ChimaraGlkClass *klass)
 		"Whether there is a program currently running",
 		FALSE,
 		G_PARAM_READABLE | G_PARAM_STATIC_STRINGS) );
+
+	/**
+	 * ChimaraGlk:metrics-interval:
+	 *
+	 * The number of seconds between emissions of the #ChimaraGlk::metrics
+	 * signal while a Glk program is running. A value of 0 means the signal is
+	 * not emitted; the metrics are still available from
+	 * chimara_glk_get_metrics().
+	 */
+	g_object_class_install_property(object_class, PROP_METRICS_INTERVAL,
+		g_param_spec_uint("metrics-interval", "Metrics interval",
+		"Seconds between emissions of the metrics signal, or 0 for never",
+		0, G_MAXUINT, 0,
+		G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS) );
 }
 
 /* PUBLIC FUNCTIONS */
@@ -1298,6 +1397,7 @@ chimara_glk_set_css_from_file(ChimaraGlk *glk, const gchar *filename, GError **e
 	g_return_val_if_fail(filename, FALSE);
 	g_return_val_if_fail(error == NULL || *error == NULL, FALSE);
 
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(glk);
 	int fd = open(filename, O_RDONLY);
 	if(fd == -1) {
 		if(error)
@@ -1310,6 +1410,7 @@ chimara_glk_set_css_from_file(ChimaraGlk *glk, const gchar *filename, GError **e
 	g_scanner_input_file(scanner, fd);
 	scanner->input_name = filename;
 	scan_css_file(scanner, glk);
+	g_atomic_int_inc(&priv->styles_generation);
 
 	if(close(fd) == -1) {
 		if(error)
@@ -1335,11 +1436,13 @@ chimara_glk_set_css_from_string(ChimaraGlk *glk, const gchar *css)
 {
 	g_return_if_fail(glk || CHIMARA_IS_GLK(glk));
 	g_return_if_fail(css || *css);
-	
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(glk);
 	GScanner *scanner = create_css_file_scanner();
 	g_scanner_input_text(scanner, css, strlen(css));
 	scanner->input_name = "<string>";
 	scan_css_file(scanner, glk);
+	g_atomic_int_inc(&priv->styles_generation);
 }
 
 /**
@@ -1377,8 +1480,253 @@ chimara_glk_get_spacing(ChimaraGlk *self)
 	return priv->spacing;
 }
 
+/**
+ * chimara_glk_set_scrollback_lines:
+ * @self: a #ChimaraGlk widget
+ * @lines: the number of lines to keep in text buffer windows, or 0
+ *
+ * Sets the #ChimaraGlk:scrollback-lines property of @self, which is the number
+ * of lines text buffer windows keep before archiving the oldest ones. The new
+ * limit takes effect the next time text is printed.
+ */
+void
+chimara_glk_set_scrollback_lines(ChimaraGlk *self, guint lines)
+{
+	g_return_if_fail(self || CHIMARA_IS_GLK(self));
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	priv->scrollback_lines = lines;
+	g_object_notify(G_OBJECT(self), "scrollback-lines");
+}
+
+/**
+ * chimara_glk_get_scrollback_lines:
+ * @self: a #ChimaraGlk widget
+ *
+ * Gets the value set by chimara_glk_set_scrollback_lines().
+ *
+ * Return value: number of lines kept in text buffer windows, or 0 for no limit
+ */
+guint
+chimara_glk_get_scrollback_lines(ChimaraGlk *self)
+{
+	g_return_val_if_fail(self || CHIMARA_IS_GLK(self), 0);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	return priv->scrollback_lines;
+}
+
+/**
+ * chimara_glk_set_persistent_plugin:
+ * @self: a #ChimaraGlk widget
+ * @persistent: whether to keep the plugin loaded between runs
+ *
+ * Sets the #ChimaraGlk:persistent-plugin property of @self. The new value takes
+ * effect the next time chimara_glk_run() is called.
+ */
+void
+chimara_glk_set_persistent_plugin(ChimaraGlk *self, gboolean persistent)
+{
+	g_return_if_fail(self || CHIMARA_IS_GLK(self));
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	priv->persistent_plugin = persistent;
+	g_object_notify(G_OBJECT(self), "persistent-plugin");
+}
+
+/**
+ * chimara_glk_get_persistent_plugin:
+ * @self: a #ChimaraGlk widget
+ *
+ * Returns whether @self keeps plugins loaded between runs. See
+ * #ChimaraGlk:persistent-plugin.
+ *
+ * Return value: %TRUE if plugins are kept loaded.
+ */
+gboolean
+chimara_glk_get_persistent_plugin(ChimaraGlk *self)
+{
+	g_return_val_if_fail(self || CHIMARA_IS_GLK(self), FALSE);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	return priv->persistent_plugin;
+}
+
+/**
+ * chimara_glk_set_headless_size:
+ * @self: a #ChimaraGlk widget
+ * @width: width in pixels to lay out the Glk windows in, or 0
+ * @height: height in pixels to lay out the Glk windows in, or 0
+ *
+ * Lets @self run a Glk program without being put into a window, for example
+ * to replay transcripts in a test harness. The Glk windows are laid out as if
+ * @self had been allocated @width by @height pixels, whenever the Glk program
+ * changes its window arrangement, instead of waiting for GTK to allocate a
+ * size to @self. @self is shown, but is never realized.
+ *
+ * Use this together with chimara_glk_set_interactive(), and feed input with
+ * chimara_glk_feed_line_input() and chimara_glk_feed_char_input().
+ * Graphics windows are not drawn in headless mode.
+ *
+ * Pass 0 for both dimensions to go back to taking the size from GTK. Don't do
+ * this while a Glk program is running.
+ */
+void
+chimara_glk_set_headless_size(ChimaraGlk *self, int width, int height)
+{
+	g_return_if_fail(self || CHIMARA_IS_GLK(self));
+	g_return_if_fail(width >= 0 && height >= 0);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	priv->headless_width = width;
+	priv->headless_height = height;
+	if(width == 0 || height == 0)
+		return;
+
+	/* A widget must be visible to be given a size allocation */
+	gtk_widget_show(GTK_WIDGET(self));
+	if(priv->root_window)
+		chimara_glk_queue_arrange(self, FALSE, priv->arrange_pending);
+}
+
+/**
+ * chimara_glk_get_headless_size:
+ * @self: a #ChimaraGlk widget
+ * @width: (out) (optional): return location for the width, or %NULL
+ * @height: (out) (optional): return location for the height, or %NULL
+ *
+ * Gets the size set by chimara_glk_set_headless_size().
+ *
+ * Return value: %TRUE if @self lays out its windows without a widget
+ * hierarchy.
+ */
+gboolean
+chimara_glk_get_headless_size(ChimaraGlk *self, int *width, int *height)
+{
+	g_return_val_if_fail(self || CHIMARA_IS_GLK(self), FALSE);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	if(width)
+		*width = priv->headless_width;
+	if(height)
+		*height = priv->headless_height;
+	return priv->headless_width > 0 && priv->headless_height > 0;
+}
+
+static gboolean
+emit_metrics_signal(ChimaraGlk *self)
+{
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	if(priv->running)
+		g_signal_emit(self, chimara_glk_signals[METRICS], 0, chimara_glk_get_metrics(self));
+	return G_SOURCE_CONTINUE;
+}
+
+/**
+ * chimara_glk_set_metrics_interval:
+ * @self: a #ChimaraGlk widget
+ * @seconds: seconds between emissions of the #ChimaraGlk::metrics signal, or 0
+ *
+ * Sets the #ChimaraGlk:metrics-interval property of @self.
+ */
+void
+chimara_glk_set_metrics_interval(ChimaraGlk *self, guint seconds)
+{
+	g_return_if_fail(self || CHIMARA_IS_GLK(self));
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	if(priv->metrics_timeout_id != 0) {
+		g_source_remove(priv->metrics_timeout_id);
+		priv->metrics_timeout_id = 0;
+	}
+	priv->metrics_interval = seconds;
+	if(seconds != 0)
+		priv->metrics_timeout_id = g_timeout_add_seconds(seconds, (GSourceFunc)emit_metrics_signal, self);
+	g_object_notify(G_OBJECT(self), "metrics-interval");
+}
+
+/**
+ * chimara_glk_get_metrics_interval:
+ * @self: a #ChimaraGlk widget
+ *
+ * Gets the value set by chimara_glk_set_metrics_interval().
+ *
+ * Return value: seconds between emissions of the #ChimaraGlk::metrics signal,
+ * or 0 if it is not emitted
+ */
+guint
+chimara_glk_get_metrics_interval(ChimaraGlk *self)
+{
+	g_return_val_if_fail(self || CHIMARA_IS_GLK(self), 0);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+	return priv->metrics_interval;
+}
+
+/**
+ * chimara_glk_get_metrics:
+ * @self: a #ChimaraGlk widget
+ *
+ * Takes a snapshot of counters and histograms that Chimara keeps about the
+ * Glk program running in @self, or the last one that ran. They are reset
+ * whenever a new program is started with chimara_glk_run(). The snapshot is
+ * cheap to take, so it is fine to call this function periodically, or connect
+ * to #ChimaraGlk::metrics instead.
+ *
+ * The return value is a dictionary of type `a{sv}` with the following keys:
+ *
+ * - `ui-messages` (`a{su}`): the number of messages the Glk thread sent to the
+ *   UI thread, by type of message.
+ *   Message types that were not sent are left out.
+ * - `ui-messages-pending` (`u`): the number of messages that the UI thread has
+ *   not processed yet.
+ * - `ui-round-trip-usec`: time in microseconds that the Glk thread spent
+ *   waiting for the UI thread, each time it needed a response.
+ * - `flush-bytes`: the number of bytes of text sent to the UI thread each
+ *   time a text window's buffer was flushed.
+ * - `select-wait-usec`: time in microseconds that glk_select() spent waiting
+ *   for an event.
+ * - `events-pending` (`u`): the number of events waiting for glk_select().
+ * - `events-dropped` (`u`): the number of events discarded because the event
+ *   queue was full.
+ * - `image-cache-hits`, `image-cache-misses` (`u`): lookups of images in the
+ *   image cache.
+ * - `blorb-chunk-loads` (`u`): the number of image, sound, and data resources
+ *   loaded from the Blorb resource map.
+ *
+ * The histograms are dictionaries of type `a{sv}`, with keys `count` (`t`),
+ * the number of values recorded; `sum` (`t`), the total of all the values; and
+ * `buckets` (`at`), the number of values that fell into each bucket.
+ * Bucket 0 counts values of 0, and bucket n counts values from
+ * 2<superscript>n-1</superscript> up to 2<superscript>n</superscript> - 1.
+ * Empty buckets at the end are left out.
+ *
+ * Returns: (transfer floating): a #GVariant of type `a{sv}`.
+ */
+GVariant *
+chimara_glk_get_metrics(ChimaraGlk *self)
+{
+	g_return_val_if_fail(self || CHIMARA_IS_GLK(self), NULL);
+
+	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
+
+	GVariantDict dict;
+	g_variant_dict_init(&dict, NULL);
+	metrics_add_to_dict(&priv->metrics, &dict);
+
+	g_variant_dict_insert(&dict, "ui-messages-pending", "u", (guint32) MAX(g_async_queue_length(priv->ui_message_queue), 0));
+
+	g_mutex_lock(&priv->event_lock);
+	g_variant_dict_insert(&dict, "events-pending", "u", (guint32) priv->event_queue.length);
+	g_variant_dict_insert(&dict, "events-dropped", "u", (guint32) priv->event_queue.dropped);
+	g_mutex_unlock(&priv->event_lock);
+
+	return g_variant_dict_end(&dict);
+}
+
 struct StartupData {
 	glk_main_t glk_main;
+	glkunix_reset_code_t glkunix_reset_code;
 	glkunix_startup_code_t glkunix_startup_code;
 	ChimaraGlkPrivate *glk_data;
 };
@@ -1410,6 +1758,10 @@ glk_enter(struct StartupData *startup)
 
 	gdk_threads_add_idle((GSourceFunc)emit_started_signal, startup->glk_data->self);
 
+	/* If the plugin was kept loaded from a previous run, reset its state */
+	if(startup->glkunix_reset_code)
+		startup->glkunix_reset_code();
+
 	/* Run startup function */
 	if(startup->glkunix_startup_code) {
 		startup->glk_data->in_startup = TRUE;
@@ -1463,7 +1815,9 @@ chimara_glk_process_queue(ChimaraGlk *self)
  * a separate thread. On failure, returns %FALSE and sets @error.
  *
  * The plugin must at least export a glk_main() function; #glkunix_arguments and
- * glkunix_startup_code() are optional.
+ * glkunix_startup_code() are optional. If #ChimaraGlk:persistent-plugin is set
+ * and @plugin is the plugin that was run last, the module is not loaded again
+ * if it exports glkunix_reset_code().
  *
  * Return value: %TRUE if the Glk program was started successfully.
  */
@@ -1485,26 +1839,38 @@ chimara_glk_run(ChimaraGlk *self, const gchar *plugin, int argc, char *argv[], G
 	struct StartupData *startup = g_slice_new0(struct StartupData);
 
     g_assert( g_module_supported() );
-	/* If there is already a module loaded, free it first -- you see, we want to
-	 * keep modules loaded as long as possible to avoid crashes in stack
-	 * unwinding. And in fact, skip unloading it altogether if we are running
-	 * under address sanitizer, because otherwise symbolizing stack traces at
-	 * the end of the process won't work (and then the stack traces won't match
-	 * the suppressions file. This is an unfortunate but necessary hack unless
-	 * we can either deallocate all static data in glulxe manually, or rewrite
-	 * the unit test suite so that it doesn't need to unload plugins. */
+	/* In persistent plugin mode, keep the module that is already loaded if it
+	 * is the same plugin and it can reset its own state */
+	if( !(priv->persistent_plugin && priv->program
+		&& g_strcmp0(priv->program_path, plugin) == 0
+		&& g_module_symbol(priv->program, "glkunix_reset_code", (gpointer *) &startup->glkunix_reset_code)) )
+	{
+		startup->glkunix_reset_code = NULL;
+
+		/* If there is already a module loaded, free it first -- you see, we
+		 * want to keep modules loaded as long as possible to avoid crashes in
+		 * stack unwinding. And in fact, skip unloading it altogether if we are
+		 * running under address sanitizer, because otherwise symbolizing stack
+		 * traces at the end of the process won't work (and then the stack
+		 * traces won't match the suppressions file. This is an unfortunate but
+		 * necessary hack unless we can either deallocate all static data in
+		 * glulxe manually, or rewrite the unit test suite so that it doesn't
+		 * need to unload plugins. */
 #ifndef CHIMARA_ASAN_HACK
-	chimara_glk_unload_plugin(self);
+		chimara_glk_unload_plugin(self);
 #endif
-	/* Open the module to run */
-    priv->program = g_module_open(plugin, G_MODULE_BIND_LAZY);
-    
-    if(!priv->program)
-    {
-		g_set_error(error, CHIMARA_ERROR, CHIMARA_LOAD_MODULE_ERROR,
-			"Error opening module: %s", g_module_error());
-        return FALSE;
-    }
+		/* Open the module to run */
+		priv->program = g_module_open(plugin, G_MODULE_BIND_LAZY);
+
+		if(!priv->program)
+		{
+			g_set_error(error, CHIMARA_ERROR, CHIMARA_LOAD_MODULE_ERROR,
+				"Error opening module: %s", g_module_error());
+			return FALSE;
+		}
+		g_free(priv->program_path);
+		priv->program_path = g_strdup(plugin);
+	}
     if( !g_module_symbol(priv->program, "glk_main", (gpointer *) &startup->glk_main) )
     {
 		g_set_error(error, CHIMARA_ERROR, CHIMARA_NO_GLK_MAIN,
@@ -1534,10 +1900,19 @@ chimara_glk_run(ChimaraGlk *self, const gchar *plugin, int argc, char *argv[], G
 
 	/* Set Glk styles to defaults */
 	chimara_glk_reset_glk_styles(self);
+	memset(priv->stylehints_set, 0, sizeof(priv->stylehints_set));
+
+	/* Nothing has happened yet, see glkunix_get_last_event_type() */
+	priv->last_event_type = 0xFFFFFFFF;
 
 	/* Reset arrangement mechanism */
 	priv->needs_rearrange = FALSE;
 	priv->ignore_next_arrange_event = FALSE;
+	priv->arranges_requested = 0;
+	priv->arrange_pending = 0;
+	g_atomic_int_set(&priv->arranges_completed, 0);
+
+	metrics_reset(&priv->metrics);
 
 	/* Start listening for UI messages */
 	priv->ui_message_handler_id = gdk_threads_add_idle((GSourceFunc)chimara_glk_process_queue, self);
@@ -1671,6 +2046,7 @@ chimara_glk_unload_plugin(ChimaraGlk *self)
 	if( priv->program && !g_module_close(priv->program) )
 		g_warning( "Error closing module :%s", g_module_error() );
 	priv->program = NULL;
+	g_clear_pointer(&priv->program_path, g_free);
 }
 
 /**
@@ -1933,39 +2309,39 @@ chimara_glk_set_story_name(ChimaraGlk *self, const char *story_name)
     g_object_notify(G_OBJECT(self), "story-name");
 }
 
-/* Private method: push an event onto the event queue. If the event queue is
-full, wait for max three seconds and then drop the event. If the event queue is
-NULL, i.e. freed, then fail silently. */
+/* Private method: push an event onto the event queue. Timer and arrange events
+that are already pending are not queued again. If the event queue is full, wait
+for max three seconds and then drop the event. If the event queue is closed,
+i.e. the widget is being finalized, then fail silently. */
 void
 chimara_glk_push_event(ChimaraGlk *self, uint32_t type, winid_t win, uint32_t val1, uint32_t val2)
 {
 	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
 
-	if (!priv->event_queue)
+	if (priv->event_queue_closed)
 		return;
 
+	event_t event = { type, win, val1, val2 };
+	TRACE4(push__event, type, win, val1, val2);
 	gint64 timeout = g_get_monotonic_time() + EVENT_TIMEOUT_MICROSECONDS;
 
 	g_mutex_lock(&priv->event_lock);
 
-	/* Wait for room in the event queue */
-	while (g_queue_get_length(priv->event_queue) >= EVENT_QUEUE_MAX_LENGTH)
+	/* Wait for room in the event queue; the event may be coalesced with a
+	pending one, in which case no room is needed */
+	while (!event_queue_push(&priv->event_queue, &event))
 	{
 		if (!g_cond_wait_until(&priv->event_queue_not_full, &priv->event_lock, timeout))
 		{
 			/* Drop the event if the event queue is still not emptying */
+			priv->event_queue.dropped++;
+			g_debug("Event queue full, dropped event of type %d (%u dropped so far)",
+				(int)type, priv->event_queue.dropped);
 			g_mutex_unlock(&priv->event_lock);
 			return;
 		}
 	}
 
-	event_t *event = g_new0(event_t, 1);
-	event->type = type;
-	event->win = win;
-	event->val1 = val1;
-	event->val2 = val2;
-	g_queue_push_head(priv->event_queue, event);
-
 	/* Signal that there is an event */
 	g_cond_signal(&priv->event_queue_not_empty);
 
@@ -1982,13 +2358,25 @@ chimara_glk_needs_rearrange(ChimaraGlk *self)
 
 /* Private method. Queues a size reallocation for the entire Glk window
  * hierarchy. If @suppress_next_arrange_event is %TRUE, an %evtype_Arrange event
- * will not be sent back to the Glk thread as a result of this resize. */
+ * will not be sent back to the Glk thread as a result of this resize.
+ * @arrange_number is the number that the Glk thread gave this arrangement
+ * request; it is published once the reallocation is done. */
 void
-chimara_glk_queue_arrange(ChimaraGlk *self, gboolean suppress_next_arrange_event)
+chimara_glk_queue_arrange(ChimaraGlk *self, gboolean suppress_next_arrange_event, unsigned arrange_number)
 {
 	ChimaraGlkPrivate *priv = chimara_glk_get_instance_private(self);
 	priv->needs_rearrange = TRUE;
 	priv->ignore_next_arrange_event = suppress_next_arrange_event;
+	priv->arrange_pending = arrange_number;
+
+	/* Without a widget hierarchy nothing would ever allocate a size to us, so
+	 lay out the windows right away */
+	if(priv->headless_width > 0 && priv->headless_height > 0) {
+		GtkAllocation allocation = { 0, 0, priv->headless_width, priv->headless_height };
+		chimara_glk_size_allocate(GTK_WIDGET(self), &allocation);
+		return;
+	}
+
 	gtk_widget_queue_resize(GTK_WIDGET(self));
 }
 
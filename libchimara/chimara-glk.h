@@ -121,6 +121,14 @@ gboolean chimara_glk_set_css_from_file(ChimaraGlk *glk, const gchar *filename, G
 void chimara_glk_set_css_from_string(ChimaraGlk *glk, const gchar *css);
 void chimara_glk_set_spacing(ChimaraGlk *self, guint spacing);
 guint chimara_glk_get_spacing(ChimaraGlk *self);
+void chimara_glk_set_scrollback_lines(ChimaraGlk *self, guint lines);
+guint chimara_glk_get_scrollback_lines(ChimaraGlk *self);
+void chimara_glk_set_persistent_plugin(ChimaraGlk *self, gboolean persistent);
+gboolean chimara_glk_get_persistent_plugin(ChimaraGlk *self);
+void chimara_glk_set_headless_size(ChimaraGlk *self, int width, int height);
+gboolean chimara_glk_get_headless_size(ChimaraGlk *self, int *width, int *height);
+void chimara_glk_set_metrics_interval(ChimaraGlk *self, guint seconds);
+guint chimara_glk_get_metrics_interval(ChimaraGlk *self);
 gboolean chimara_glk_run(ChimaraGlk *self, const gchar *plugin, int argc, char *argv[], GError **error);
 gboolean chimara_glk_run_file(ChimaraGlk *self, GFile *plugin_file, int argc, char *argv[], GError **error);
 void chimara_glk_stop(ChimaraGlk *self);
@@ -134,6 +142,7 @@ gboolean chimara_glk_is_line_input_pending(ChimaraGlk *self);
 GtkTextTag *chimara_glk_get_tag(ChimaraGlk *self, ChimaraGlkWindowType window, const char *name);
 const char * const *chimara_glk_get_tag_names(ChimaraGlk *glk, unsigned *num_tags);
 void chimara_glk_set_resource_load_callback(ChimaraGlk *self, ChimaraResourceLoadFunc func, void *user_data, GDestroyNotify destroy_user_data);
+GVariant *chimara_glk_get_metrics(ChimaraGlk *self);
 
 G_END_DECLS
 
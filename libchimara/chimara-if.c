@@ -1,4 +1,9 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
 #include <glib-object.h>
+#include <glib/gstdio.h>
 
 #include "chimara-if.h"
 #include "chimara-glk.h"
@@ -64,6 +69,7 @@ typedef struct _ChimaraIFPrivate {
 	gint random_seed;
 	gboolean random_seed_set;
 	gchar *graphics_file;
+	guint undo_memory;
 	/* Holding buffers for inputs and responses */
 	GHashTable *active_inputs;
 	GSList *window_librock_list;
@@ -85,7 +91,8 @@ enum {
 	PROP_INTERPRETER_NUMBER,
 	PROP_RANDOM_SEED,
 	PROP_RANDOM_SEED_SET,
-	PROP_GRAPHICS_FILE
+	PROP_GRAPHICS_FILE,
+	PROP_UNDO_MEMORY
 };
 
 enum {
@@ -268,6 +275,10 @@ chimara_if_set_property(GObject *object, guint prop_id, const GValue *value, GPa
 			priv->graphics_file = g_strdup(g_value_get_string(value));
 			g_object_notify(object, "graphics-file");
 			break;
+		case PROP_UNDO_MEMORY:
+			priv->undo_memory = g_value_get_uint(value);
+			g_object_notify(object, "undo-memory");
+			break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
     }
@@ -306,6 +317,9 @@ chimara_if_get_property(GObject *object, guint prop_id, GValue *value, GParamSpe
 		case PROP_GRAPHICS_FILE:
 			g_value_set_string(value, priv->graphics_file);
 			break;
+		case PROP_UNDO_MEMORY:
+			g_value_set_uint(value, priv->undo_memory);
+			break;
         default:
             G_OBJECT_WARN_INVALID_PROPERTY_ID(object, prop_id, pspec);
     }
@@ -515,6 +529,20 @@ chimara_if_class_init(ChimaraIFClass *klass)
 	    g_param_spec_string("graphics-file", "Graphics file",
 	    "Location in which to look for a separate graphics Blorb file", NULL,
 	    G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_LAX_VALIDATION | G_PARAM_STATIC_STRINGS));
+	/**
+	 * ChimaraIF:undo-memory:
+	 *
+	 * How many kilobytes of memory the interpreter may use to remember moves
+	 * for undo. The interpreter keeps as many moves as fit in this amount of
+	 * memory, forgetting the oldest ones first. If this property is 0, the
+	 * interpreter's own default is used.
+	 *
+	 * Only affects Frotz and Nitfol.
+	 */
+	g_object_class_install_property(object_class, PROP_UNDO_MEMORY,
+		g_param_spec_uint("undo-memory", "Undo memory",
+		"Kilobytes of memory to use for undo history", 0, G_MAXUINT, 0,
+		G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_LAX_VALIDATION | G_PARAM_STATIC_STRINGS));
 }
 
 /* PUBLIC FUNCTIONS */
@@ -581,6 +609,92 @@ chimara_if_get_preferred_interpreter(ChimaraIF *self, ChimaraIFFormat format)
 	return priv->preferred_interpreter[format];
 }
 
+static uint32_t
+read_be32(const unsigned char *buf)
+{
+	return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3];
+}
+
+/* Find the type of the executable chunk in the Blorb file @fp, by walking the
+chunk list. Returns CHIMARA_IF_FORMAT_NONE if there is no executable chunk. */
+static ChimaraIFFormat
+sniff_blorb_format(FILE *fp, uint32_t form_length)
+{
+	unsigned char chunk[8];
+	uint32_t pos = 12;
+	uint32_t end = form_length + 8;
+
+	while(pos + 8 <= end) {
+		if(fseek(fp, pos, SEEK_SET) != 0 || fread(chunk, 1, 8, fp) != 8)
+			break;
+		if(memcmp(chunk, "ZCOD", 4) == 0)
+			return CHIMARA_IF_FORMAT_Z_BLORB;
+		if(memcmp(chunk, "GLUL", 4) == 0)
+			return CHIMARA_IF_FORMAT_GLULX_BLORB;
+		uint32_t length = read_be32(chunk + 4);
+		if(length > end - pos - 8)
+			break;
+		pos += 8 + length + (length & 1); /* Chunks are padded to even length */
+	}
+	return CHIMARA_IF_FORMAT_NONE;
+}
+
+/* Find out what format the game file at @game_path is by looking at its header.
+Returns CHIMARA_IF_FORMAT_NONE if the file could not be read or the format was
+not recognized. */
+static ChimaraIFFormat
+sniff_game_format(const char *game_path)
+{
+	FILE *fp = g_fopen(game_path, "rb");
+	if(fp == NULL)
+		return CHIMARA_IF_FORMAT_NONE;
+
+	ChimaraIFFormat format = CHIMARA_IF_FORMAT_NONE;
+	unsigned char header[64];
+	size_t length = fread(header, 1, sizeof(header), fp);
+
+	if(length >= 12 && memcmp(header, "FORM", 4) == 0 && memcmp(header + 8, "IFRS", 4) == 0)
+		format = sniff_blorb_format(fp, read_be32(header + 4));
+	else if(length >= 4 && memcmp(header, "Glul", 4) == 0)
+		format = CHIMARA_IF_FORMAT_GLULX;
+	else if(length == sizeof(header)) {
+		/* Z-code has no magic number, only a version byte; versions 1-4 are
+		handled the same as version 5, and version 7 the same as version 8 */
+		switch(header[0]) {
+			case 1: case 2: case 3: case 4: case 5:
+				format = CHIMARA_IF_FORMAT_Z5;
+				break;
+			case 6:
+				format = CHIMARA_IF_FORMAT_Z6;
+				break;
+			case 7: case 8:
+				format = CHIMARA_IF_FORMAT_Z8;
+				break;
+		}
+	}
+
+	fclose(fp);
+	return format;
+}
+
+/* Guess the format of the game file at @game_path from its extension, for
+files whose contents are not recognized. Defaults to Z-code version 5. */
+static ChimaraIFFormat
+guess_game_format_from_extension(const char *game_path)
+{
+	if(g_str_has_suffix(game_path, ".z6"))
+		return CHIMARA_IF_FORMAT_Z6;
+	if(g_str_has_suffix(game_path, ".z8"))
+		return CHIMARA_IF_FORMAT_Z8;
+	if(g_str_has_suffix(game_path, ".zlb") || g_str_has_suffix(game_path, ".zblorb"))
+		return CHIMARA_IF_FORMAT_Z_BLORB;
+	if(g_str_has_suffix(game_path, ".ulx"))
+		return CHIMARA_IF_FORMAT_GLULX;
+	if(g_str_has_suffix(game_path, ".blb") || g_str_has_suffix(game_path, ".blorb") || g_str_has_suffix(game_path, ".glb") || g_str_has_suffix(game_path, ".gblorb"))
+		return CHIMARA_IF_FORMAT_GLULX_BLORB;
+	return CHIMARA_IF_FORMAT_Z5;
+}
+
 /**
  * chimara_if_run_game:
  * @self: A #ChimaraIF widget.
@@ -592,6 +706,10 @@ chimara_if_get_preferred_interpreter(ChimaraIF *self, ChimaraIFFormat format)
  * file format, the preferred one will be picked, according to
  * chimara_if_set_preferred_interpreter().
  *
+ * The type is detected by looking at the file's header, so a game file with
+ * the wrong extension is still run by the right interpreter. Only if the
+ * contents are not recognized is the type guessed from the extension.
+ *
  * Returns: %TRUE if the game was started successfully, %FALSE if not, in which
  * case @error is set.
  */
@@ -605,20 +723,9 @@ chimara_if_run_game(ChimaraIF *self, const char *game_path, GError **error)
 	ChimaraIFPrivate *priv = chimara_if_get_instance_private(self);
 
 	/* Find out what format the game is */
-	/* TODO: Look inside the file instead of just looking at the extension */
-	ChimaraIFFormat format = CHIMARA_IF_FORMAT_Z5;
-	if(g_str_has_suffix(game_path, ".z5"))
-		format = CHIMARA_IF_FORMAT_Z5;
-	else if(g_str_has_suffix(game_path, ".z6"))
-		format = CHIMARA_IF_FORMAT_Z6;
-	else if(g_str_has_suffix(game_path, ".z8"))
-		format = CHIMARA_IF_FORMAT_Z8;
-	else if(g_str_has_suffix(game_path, ".zlb") || g_str_has_suffix(game_path, ".zblorb"))
-		format = CHIMARA_IF_FORMAT_Z_BLORB;
-	else if(g_str_has_suffix(game_path, ".ulx"))
-		format = CHIMARA_IF_FORMAT_GLULX;
-	else if(g_str_has_suffix(game_path, ".blb") || g_str_has_suffix(game_path, ".blorb") || g_str_has_suffix(game_path, ".glb") || g_str_has_suffix(game_path, ".gblorb"))
-		format = CHIMARA_IF_FORMAT_GLULX_BLORB;
+	ChimaraIFFormat format = sniff_game_format(game_path);
+	if(format == CHIMARA_IF_FORMAT_NONE)
+		format = guess_game_format_from_extension(game_path);
 
 	/* Now decide what interpreter to use */
 	ChimaraIFInterpreter interpreter = priv->preferred_interpreter[format];
@@ -649,7 +756,7 @@ chimara_if_run_game(ChimaraIF *self, const char *game_path, GError **error)
 	/* Decide what arguments to pass to the interpreters; currently only the
 	Z-machine interpreters accept command line arguments other than the game */
 	GSList *args = NULL;
-	gchar *terpnumstr = NULL, *randomstr = NULL;
+	gchar *terpnumstr = NULL, *randomstr = NULL, *undostr = NULL;
 	args = g_slist_prepend(args, pluginpath);
 	switch(interpreter)
 	{
@@ -672,6 +779,11 @@ chimara_if_run_game(ChimaraIF *self, const char *game_path, GError **error)
 				randomstr = g_strdup_printf("-s%d", priv->random_seed);
 				args = g_slist_prepend(args, randomstr);
 			}
+			if(priv->undo_memory != 0)
+			{
+				undostr = g_strdup_printf("-U%u", priv->undo_memory);
+				args = g_slist_prepend(args, undostr);
+			}
 			break;
 		case CHIMARA_IF_INTERPRETER_NITFOL:
 			if(priv->flags & CHIMARA_IF_PIRACY_MODE)
@@ -694,6 +806,11 @@ chimara_if_run_game(ChimaraIF *self, const char *game_path, GError **error)
 				randomstr = g_strdup_printf("-random%d", priv->random_seed);
 				args = g_slist_prepend(args, randomstr);
 			}
+			if(priv->undo_memory != 0)
+			{
+				undostr = g_strdup_printf("-undomem%u", priv->undo_memory);
+				args = g_slist_prepend(args, undostr);
+			}
 			break;
 		default:
 			;
@@ -730,6 +847,8 @@ chimara_if_run_game(ChimaraIF *self, const char *game_path, GError **error)
 		g_free(terpnumstr);
 	if(randomstr)
 		g_free(randomstr);
+	if(undostr)
+		g_free(undostr);
 	g_free(pluginpath);
 
 	/* Set current format and interpreter if plugin was started successfully */
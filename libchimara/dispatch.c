@@ -202,16 +202,18 @@ gidispatch_set_retained_registry(gidispatch_rock_t (*regi)(void *array, glui32 l
 
 /**
  * gidispatch_set_autorestore_registry:
- * @locatearr:
- * @restorearr:
+ * @locatearr: Function that returns the program's own key for a retained array.
+ * @restorearr: Function that creates a retained array again from its key.
  *
  * This function is also part of the Glk library, but it only exists on
  * libraries that support autorestore.
- * (Only iosglk, currently.)
+ * (Only iosglk, remglk, and Chimara, currently.)
  * Only call this if %GIDISPATCH_AUTORESTORE_REGISTRY is defined.
  *
  * > # Chimara #
- * > This function does nothing in Chimara.
+ * > Chimara uses these callbacks in glkunix_save_library_state() and
+ * > glkunix_update_from_library_state(), to save and restore the buffers of
+ * > pending line input requests and memory streams.
  *
  * Stability: Unstable
  */
@@ -220,4 +222,7 @@ gidispatch_set_autorestore_registry(
     long (*locatearr)(void *array, glui32 len, char *typecode, gidispatch_rock_t objrock, int *elemsizeref),
     gidispatch_rock_t (*restorearr)(long bufkey, glui32 len, char *typecode, void **arrayref))
 {
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	glk_data->locate_arr = locatearr;
+	glk_data->restore_arr = restorearr;
 }
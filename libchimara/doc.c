@@ -1322,6 +1322,14 @@
  * program can accept.
  * The library will sort these out of the command line and pass them on to your
  * code.
+ *
+ * <note><title>Chimara</title><para>
+ *   Chimara also looks for an optional function `glkunix_reset_code()`, which
+ *   takes no arguments and must put all of the program's static state back to
+ *   how it was when the plugin was first loaded. If it is present and
+ *   #ChimaraGlk:persistent-plugin is set, running the same plugin again calls
+ *   it instead of reloading the plugin.
+ * </para></note>
  */
 
 /**
@@ -1336,6 +1344,31 @@
  * Glk library functions which are convenient for this purpose.
  */
 
+/**
+ * SECTION:glkext-autosave
+ * @short_description: Saving and restoring the library state
+ *
+ * This section describes an extension to the Unix startup interface that
+ * originated in RemGlk. It allows an interpreter to freeze a whole session to
+ * disk, not only its own virtual machine but also the Glk library's window
+ * tree, streams, file references, style hints, and pending input requests, and
+ * to resume it later without replaying the game.
+ *
+ * The interpreter writes the library state with glkunix_save_library_state(),
+ * passing a callback that adds its own extra state. To resume, it reads the
+ * state with glkunix_load_library_state(), restores its virtual machine, and
+ * then calls glkunix_update_from_library_state() to replace the library's
+ * objects with the saved ones. Objects are matched up between the library and
+ * the interpreter by their update tags.
+ *
+ * Check for %GLKUNIX_AUTOSAVE_FEATURES before using any of these functions.
+ *
+ * > # Chimara #
+ * > The contents of text windows are not saved; restored windows start out
+ * > empty. The library state is written to disk on a background thread, so
+ * > that saving every turn does not hold up the Glk program.
+ */
+
 /**
  * SECTION:glkext-garglk
  * @short_description: Gargoyle extensions to Glk
@@ -1,15 +1,122 @@
-#include <string.h>
-
 #include "chimara-glk-private.h"
 #include "event.h"
 #include "glk.h"
 #include "input.h"
-#include "magic.h"
 #include "strio.h"
+#include "trace.h"
 #include "window.h"
 
 extern GPrivate glk_data_key;
 
+/* Index in the ring buffer of the event at position @pos in the queue */
+static inline unsigned
+event_queue_index(EventQueue *queue, unsigned pos)
+{
+	return (queue->head + pos) % EVENT_QUEUE_MAX_LENGTH;
+}
+
+bool
+event_queue_is_full(EventQueue *queue)
+{
+	return queue->length == EVENT_QUEUE_MAX_LENGTH;
+}
+
+/* Adds @event to the back of the queue. A timer event is dropped if a timer
+ * event is already pending, because the Glk program cannot tell the difference.
+ * Likewise for an arrange event; if the pending arrange event is for a
+ * different window, it is widened to cover the whole window tree.
+ * Returns FALSE if the queue is full and the event was not coalesced. */
+bool
+event_queue_push(EventQueue *queue, const event_t *event)
+{
+	if(event->type == evtype_Timer || event->type == evtype_Arrange) {
+		for(unsigned pos = 0; pos < queue->length; pos++) {
+			event_t *pending = &queue->events[event_queue_index(queue, pos)];
+			if(pending->type != event->type)
+				continue;
+			if(pending->win != event->win)
+				pending->win = NULL;
+			return true;
+		}
+	}
+
+	if(event_queue_is_full(queue))
+		return false;
+	queue->events[event_queue_index(queue, queue->length)] = *event;
+	queue->length++;
+	return true;
+}
+
+/* Puts @event back at the front of the queue, to be retrieved next. Returns
+ * FALSE if the queue is full. */
+bool
+event_queue_push_front(EventQueue *queue, const event_t *event)
+{
+	if(event_queue_is_full(queue))
+		return false;
+	queue->head = (queue->head + EVENT_QUEUE_MAX_LENGTH - 1) % EVENT_QUEUE_MAX_LENGTH;
+	queue->events[queue->head] = *event;
+	queue->length++;
+	return true;
+}
+
+/* Removes the oldest event from the queue and copies it into @event. Returns
+ * FALSE if the queue is empty. */
+bool
+event_queue_pop(EventQueue *queue, event_t *event)
+{
+	if(queue->length == 0)
+		return false;
+	*event = queue->events[queue->head];
+	queue->head = event_queue_index(queue, 1);
+	queue->length--;
+	return true;
+}
+
+/* Removes the oldest event that is not a player input event from the queue,
+ * and copies it into @event. The order of the remaining events is preserved.
+ * Returns FALSE if there is no such event. */
+bool
+event_queue_pop_internal(EventQueue *queue, event_t *event)
+{
+	unsigned pos;
+	for(pos = 0; pos < queue->length; pos++) {
+		glui32 type = queue->events[event_queue_index(queue, pos)].type;
+		if(type != evtype_CharInput && type != evtype_LineInput && type != evtype_MouseInput && type != evtype_Hyperlink)
+			break;
+	}
+	if(pos == queue->length)
+		return false;
+
+	*event = queue->events[event_queue_index(queue, pos)];
+	/* Close the gap by moving the events before it back by one */
+	for(; pos > 0; pos--)
+		queue->events[event_queue_index(queue, pos)] = queue->events[event_queue_index(queue, pos - 1)];
+	queue->head = event_queue_index(queue, 1);
+	queue->length--;
+	return true;
+}
+
+void
+event_queue_clear(EventQueue *queue)
+{
+	queue->head = 0;
+	queue->length = 0;
+}
+
+/* Helper function: Put a forced input event back at the front of the event
+ * queue. */
+static void
+requeue_forced_event(ChimaraGlkPrivate *glk_data, const event_t *forced_event)
+{
+	g_mutex_lock(&glk_data->event_lock);
+	if(event_queue_push_front(&glk_data->event_queue, forced_event))
+		g_cond_signal(&glk_data->event_queue_not_empty);
+	else
+		glk_data->event_queue.dropped++;
+	g_mutex_unlock(&glk_data->event_lock);
+}
+
 /* Helper function: Wait for an event in the event queue. If it is a forced
  * input event, but no windows have an input request of that type, then wait
  * for the next event and put the forced input event back on top of the queue.
@@ -21,20 +128,27 @@ get_appropriate_event(event_t *event)
 
 	g_mutex_lock(&glk_data->event_lock);
 
-	event_t *retrieved_event = NULL;
+	event_t retrieved_event;
 
 	/* Wait for an event */
-	if( g_queue_is_empty(glk_data->event_queue) )
-		g_cond_wait(&glk_data->event_queue_not_empty, &glk_data->event_lock);
-
-	retrieved_event = g_queue_pop_tail(glk_data->event_queue);
+	if( !event_queue_pop(&glk_data->event_queue, &retrieved_event) ) {
+		gint64 start_time = g_get_monotonic_time();
+		TRACE(select__wait__begin);
+		do
+			g_cond_wait(&glk_data->event_queue_not_empty, &glk_data->event_lock);
+		while( !event_queue_pop(&glk_data->event_queue, &retrieved_event) );
+		TRACE1(select__wait__end, retrieved_event.type);
+		metrics_histogram_add(&glk_data->metrics.select_wait_usec, g_get_monotonic_time() - start_time);
+	} else {
+		metrics_histogram_add(&glk_data->metrics.select_wait_usec, 0);
+	}
 
 	/* Signal that the event queue is no longer full */
 	g_cond_signal(&glk_data->event_queue_not_full);
 
 	g_mutex_unlock(&glk_data->event_lock);
 
-	if(retrieved_event->type == evtype_ForcedCharInput)
+	if(retrieved_event.type == evtype_ForcedCharInput)
 	{
 		/* Check for forced character input in the queue */
 		winid_t win;
@@ -42,20 +156,14 @@ get_appropriate_event(event_t *event)
 			if(win->input_request_type == INPUT_REQUEST_CHARACTER || win->input_request_type == INPUT_REQUEST_CHARACTER_UNICODE)
 				break;
 		if(win)
-		{
 			force_char_input_from_queue(win, event);
-			g_free(retrieved_event);
-		}
 		else
 		{
 			get_appropriate_event(event);
-			g_mutex_lock(&glk_data->event_lock);
-			g_queue_push_tail(glk_data->event_queue, retrieved_event);
-			g_cond_signal(&glk_data->event_queue_not_empty);
-			g_mutex_unlock(&glk_data->event_lock);
+			requeue_forced_event(glk_data, &retrieved_event);
 		}
 	}
-	else if(retrieved_event->type == evtype_ForcedLineInput)
+	else if(retrieved_event.type == evtype_ForcedLineInput)
 	{
 		/* Check for forced line input in the queue */
 		winid_t win;
@@ -63,29 +171,15 @@ get_appropriate_event(event_t *event)
 			if(win->input_request_type == INPUT_REQUEST_LINE || win->input_request_type == INPUT_REQUEST_LINE_UNICODE)
 				break;
 		if(win)
-		{
 			force_line_input_from_queue(win, event);
-			g_free(retrieved_event);
-		}
 		else
 		{
 			get_appropriate_event(event);
-			g_mutex_lock(&glk_data->event_lock);
-			g_queue_push_tail(glk_data->event_queue, retrieved_event);
-			g_cond_signal(&glk_data->event_queue_not_empty);
-			g_mutex_unlock(&glk_data->event_lock);
+			requeue_forced_event(glk_data, &retrieved_event);
 		}
 	}
 	else
-	{
-		if(retrieved_event == NULL)
-		{
-			WARNING("Retrieved NULL event from non-empty event queue");
-			return;
-		}
-		memcpy(event, retrieved_event, sizeof(event_t));
-		g_free(retrieved_event);
-	}
+		*event = retrieved_event;
 }
 
 /**
@@ -106,6 +200,8 @@ glk_select(event_t *event)
 {
 	g_return_if_fail(event != NULL);
 
+	TRACE(select__begin);
+
 	/* Flush all window buffers */
 	winid_t win;
 	for(win = glk_window_iterate(NULL, NULL); win != NULL; win = glk_window_iterate(win, NULL))
@@ -118,6 +214,14 @@ glk_select(event_t *event)
 	/* Check for interrupt */
 	glk_tick();
 
+	glk_data->last_event_type = event->type;
+
+	/* The mouse request is used up when its event is delivered. Clear it here
+	rather than in the UI thread's signal handler, so that only the Glk thread
+	touches the flag */
+	if(event->type == evtype_MouseInput && event->win)
+		event->win->mouse_input_requested = FALSE;
+
 	/* If the event was a line input event, the library must release the buffer */
 	if(event->type == evtype_LineInput && glk_data->unregister_arr) 
 	{
@@ -129,6 +233,8 @@ glk_select(event_t *event)
 	
 	/* If an abort event was generated, the thread should have exited by now */
 	g_assert(event->type != evtype_Abort);
+
+	TRACE4(select__end, event->type, event->win, event->val1, event->val2);
 }
 
 /**
@@ -200,25 +306,18 @@ glk_select_poll(event_t *event)
 	event->val1 = 0;
 	event->val2 = 0;
 
+	/* Send graphics windows' pending drawing to the screen, without waiting for
+	it; games that animate with glk_select_poll() never call glk_select() */
+	winid_t win;
+	for(win = glk_window_iterate(NULL, NULL); win != NULL; win = glk_window_iterate(win, NULL)) {
+		if(win->type == wintype_Graphics)
+			queue_flush_window_buffer(win);
+	}
+
 	g_mutex_lock(&glk_data->event_lock);
 
-	if( !g_queue_is_empty(glk_data->event_queue) )
-	{
-		GList *link;
-		int count;
-		for(count = 0; (link = g_queue_peek_nth_link(glk_data->event_queue, count)) != NULL; count++)
-		{
-			glui32 type = ((event_t *)link->data)->type;
-			if(type != evtype_CharInput && type != evtype_LineInput && type != evtype_MouseInput && type != evtype_Hyperlink)
-			{
-				memcpy(event, link->data, sizeof(event_t));
-				g_free(link->data);
-				g_queue_delete_link(glk_data->event_queue, link);
-				g_cond_signal(&glk_data->event_queue_not_full);
-				break;
-			}
-		}
-	}
+	if( event_queue_pop_internal(&glk_data->event_queue, event) )
+		g_cond_signal(&glk_data->event_queue_not_full);
 
 	g_mutex_unlock(&glk_data->event_lock);
 
@@ -1,8 +1,33 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stdbool.h>
+
+#include <glib.h>
+
+#include "glk.h"
+
 #define evtype_Abort (-1)
 #define evtype_ForcedCharInput (-2)
 #define evtype_ForcedLineInput (-3)
 
+#define EVENT_QUEUE_MAX_LENGTH 100
+
+/* Fixed-capacity ring buffer of events, oldest first. Events are stored inline,
+ so queueing an event does not allocate memory. Not thread-safe by itself;
+ ChimaraGlk guards it with event_lock. */
+typedef struct {
+	event_t events[EVENT_QUEUE_MAX_LENGTH];
+	unsigned head; /* Index of the oldest event */
+	unsigned length;
+	unsigned dropped; /* Number of events discarded because the queue was full */
+} EventQueue;
+
+G_GNUC_INTERNAL bool event_queue_is_full(EventQueue *queue);
+G_GNUC_INTERNAL bool event_queue_push(EventQueue *queue, const event_t *event);
+G_GNUC_INTERNAL bool event_queue_push_front(EventQueue *queue, const event_t *event);
+G_GNUC_INTERNAL bool event_queue_pop(EventQueue *queue, event_t *event);
+G_GNUC_INTERNAL bool event_queue_pop_internal(EventQueue *queue, event_t *event);
+G_GNUC_INTERNAL void event_queue_clear(EventQueue *queue);
+
 #endif
@@ -25,6 +25,7 @@ fileref_new(char *filename, char *basename, glui32 rock, glui32 usage, glui32 or
 	frefid_t f = g_slice_new0(struct glk_fileref_struct);
 	f->magic = MAGIC_FILEREF;
 	f->rock = rock;
+	f->updatetag = ++glk_data->last_updatetag;
 	if(glk_data->register_obj)
 		f->disprock = (*glk_data->register_obj)(f, gidisp_Class_Fileref);
 	
@@ -11,6 +11,7 @@ struct glk_fileref_struct
 	/*< private >*/
 	glui32 magic, rock;
 	gidispatch_rock_t disprock;
+	glui32 updatetag; /* identifies the fileref in autosave files */
 	/* Pointer to the list node in the global fileref list that contains this
 	fileref */
 	GList* fileref_list;
@@ -9,6 +9,7 @@
 
 #include "glk.h"
 #include "gi_blorb.h"
+#include "trace.h"
 
 #ifndef NULL
 #define NULL 0
@@ -450,11 +451,13 @@ giblorb_err_t giblorb_load_chunk_by_number(giblorb_map_t *map,
                 if (!dat)
                     return giblorb_err_Alloc;
                 
+                TRACE3(blorb__chunk__load__begin, chunknum, chu->type, chu->len);
                 glk_stream_set_position(map->file, chu->datpos, 
                     seekmode_Start);
                 
                 readlen = glk_get_buffer_stream(map->file, dat, 
                     chu->len);
+                TRACE2(blorb__chunk__load__end, chunknum, readlen);
                 if (readlen != chu->len)
                     return giblorb_err_Read;
                 
@@ -11,6 +11,7 @@
 
 #include "glk.h"
 #include "gi_dispa.h"
+#include "trace.h"
 
 #ifndef NULL
 #define NULL 0
@@ -673,6 +674,8 @@ char *gidispatch_prototype(glui32 funcnum)
 
 void gidispatch_call(glui32 funcnum, glui32 numargs, gluniversal_t *arglist)
 {
+    TRACE2(dispatch__call__entry, funcnum, numargs);
+
     switch (funcnum) {
         case 0x0001: /* exit */
             glk_exit();
@@ -1501,6 +1504,8 @@ void gidispatch_call(glui32 funcnum, glui32 numargs, gluniversal_t *arglist)
             /* do nothing */
             break;
     }
+
+    TRACE1(dispatch__call__return, funcnum);
 }
 
 #ifdef GI_DISPA_GAME_ID_AVAILABLE
@@ -49,11 +49,74 @@ extern glkunix_argumentlist_t glkunix_arguments[];
 
 extern int glkunix_startup_code(glkunix_startup_t *data);
 
+/* Chimara extension: optional; if a plugin exports this, it is called instead
+    of reloading the plugin when the same plugin is run again. It must put all
+    of the plugin's static state back to how it was when first loaded. */
+extern void glkunix_reset_code(void);
+
 extern void glkunix_set_base_file(char *filename);
 extern strid_t glkunix_stream_open_pathname_gen(char *pathname,
     glui32 writemode, glui32 textmode, glui32 rock);
 extern strid_t glkunix_stream_open_pathname(char *pathname, glui32 textmode, 
     glui32 rock);
 
+/* Autosave and autorestore, as in RemGlk: the library can save its own state
+    (windows, streams, filerefs, style hints, and pending input requests) so
+    that the program can serialize its state alongside and later resume where
+    it left off. */
+
+#include <stddef.h>
+#include "gi_dispa.h"
+
+#define GLKUNIX_AUTOSAVE_FEATURES (1)
+
+typedef struct glk_library_state_struct *glkunix_library_state_t;
+typedef struct glkunix_serialize_context_struct *glkunix_serialize_context_t;
+typedef struct glkunix_unserialize_context_struct *glkunix_unserialize_context_t;
+typedef int (*glkunix_serialize_object_f)(glkunix_serialize_context_t, void *);
+typedef int (*glkunix_unserialize_object_f)(glkunix_unserialize_context_t, void *);
+
+extern glui32 glkunix_get_last_event_type(void);
+
+extern glui32 glkunix_window_get_updatetag(winid_t win);
+extern winid_t glkunix_window_find_by_updatetag(glui32 tag);
+extern void glkunix_window_set_dispatch_rock(winid_t win,
+    gidispatch_rock_t rock);
+extern glui32 glkunix_stream_get_updatetag(strid_t str);
+extern strid_t glkunix_stream_find_by_updatetag(glui32 tag);
+extern void glkunix_stream_set_dispatch_rock(strid_t str,
+    gidispatch_rock_t rock);
+extern glui32 glkunix_fileref_get_updatetag(frefid_t fref);
+extern frefid_t glkunix_fileref_find_by_updatetag(glui32 tag);
+extern void glkunix_fileref_set_dispatch_rock(frefid_t fref,
+    gidispatch_rock_t rock);
+
+extern glui32 glkunix_save_library_state(strid_t file, strid_t omitstream,
+    glkunix_serialize_object_f extra_state_func, void *extra_state_rock);
+extern glkunix_library_state_t glkunix_load_library_state(strid_t file,
+    glkunix_unserialize_object_f extra_state_func, void *extra_state_rock);
+extern glui32 glkunix_update_from_library_state(
+    glkunix_library_state_t state);
+extern void glkunix_library_state_free(glkunix_library_state_t state);
+
+extern void glkunix_serialize_uint32(glkunix_serialize_context_t ctx,
+    char *key, glui32 val);
+extern void glkunix_serialize_object(glkunix_serialize_context_t ctx,
+    char *key, glkunix_serialize_object_f func, void *rock);
+extern void glkunix_serialize_object_list(glkunix_serialize_context_t ctx,
+    char *key, glkunix_serialize_object_f func, int count, size_t size,
+    void *array);
+extern int glkunix_unserialize_uint32(glkunix_unserialize_context_t ctx,
+    char *key, glui32 *res);
+extern int glkunix_unserialize_struct(glkunix_unserialize_context_t ctx,
+    char *key, glkunix_unserialize_context_t *subctx);
+extern int glkunix_unserialize_list(glkunix_unserialize_context_t ctx,
+    char *key, glkunix_unserialize_context_t *subctx, int *count);
+extern int glkunix_unserialize_list_entry(glkunix_unserialize_context_t ctx,
+    int pos, glkunix_unserialize_context_t *subctx);
+extern int glkunix_unserialize_object_list_entries(
+    glkunix_unserialize_context_t ctx, glkunix_unserialize_object_f func,
+    int count, size_t size, void *array);
+
 #endif /* GT_START_H */
 
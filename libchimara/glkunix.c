@@ -23,24 +23,25 @@ extern GPrivate glk_data_key;
  * inherently non-portable; it should not and cannot be called from inside 
  * glk_main().
  *
+ * > # Chimara #
+ * > Chimara also allows this function to be called from glk_main(), because
+ * > interpreters use it there to write and read their autosave files. See
+ * > glkunix_save_library_state().
+ *
  * Returns: A new stream, or %NULL if the file operation failed.
  */
 strid_t
 glkunix_stream_open_pathname_gen(char *pathname, glui32 writemode, glui32 textmode, glui32 rock)
 {
-	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
-
-	if(!glk_data->in_startup)
-		ILLEGAL("glkunix_stream_open_pathname_gen() may only be called from "
-				"glkunix_startup_code().");
-
 	g_return_val_if_fail(pathname, NULL);
 	g_return_val_if_fail(strlen(pathname) > 0, NULL);
 
 	frefid_t fileref = fileref_new(pathname, NULL, rock,
 		textmode? fileusage_TextMode : fileusage_BinaryMode,
 		writemode? filemode_Write : filemode_Read);
-	return file_stream_new(fileref, writemode? filemode_Write : filemode_Read, rock, FALSE);
+	strid_t str = file_stream_new(fileref, writemode? filemode_Write : filemode_Read, rock, FALSE);
+	glk_fileref_destroy(fileref);
+	return str;
 }
 
 /**
@@ -69,7 +70,9 @@ glkunix_stream_open_pathname(char *pathname, glui32 textmode, glui32 rock)
 	g_return_val_if_fail(strlen(pathname) > 0, NULL);
 
 	frefid_t fileref = fileref_new(pathname, NULL, rock, textmode? fileusage_TextMode : fileusage_BinaryMode, filemode_Read);
-	return file_stream_new(fileref, filemode_Read, rock, FALSE);
+	strid_t str = file_stream_new(fileref, filemode_Read, rock, FALSE);
+	glk_fileref_destroy(fileref);
+	return str;
 }
 
 /**
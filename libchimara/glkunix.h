@@ -7,4 +7,6 @@
 
 G_GNUC_INTERNAL gboolean parse_command_line(glkunix_argumentlist_t glkunix_arguments[], int argc, char *argv[], glkunix_startup_t *data);
 
+G_GNUC_INTERNAL void autosave_wait_for_writes(void);
+
 #endif
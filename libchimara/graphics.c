@@ -6,11 +6,16 @@
 #include "graphics.h"
 #include "magic.h"
 #include "resource.h"
+#include "strio.h"
+#include "trace.h"
 #include "ui-message.h"
 #include "window.h"
 
 #define BUFFER_SIZE (1024)
 #define IMAGE_CACHE_MAX_NUM 10
+/* Number of drawing operations after which a graphics window's batch is sent
+ * to the UI thread even if the program has not asked for input yet */
+#define GRAPHICS_BATCH_MAX_LENGTH 4096
 
 extern GPrivate glk_data_key;
 static void on_size_prepared(GdkPixbufLoader *loader, gint width, gint height, struct image_info *info);
@@ -119,7 +124,9 @@ load_image_in_cache(glui32 image, gint width, gint height)
 			WARNING("Error loading resource from alternative location");
 			return NULL;
 		}
+		TRACE3(image__decode__begin, image, width, height);
 		info = load_image_from_file(filename, image, width, height);
+		TRACE2(image__decode__end, image, info != NULL);
 		g_free(filename);
 	} else {
 		giblorb_result_t resource;
@@ -129,7 +136,10 @@ load_image_in_cache(glui32 image, gint width, gint height)
 				WARNING_S("Error loading resource", giblorb_get_error_message(blorb_error));
 			return NULL;
 		}
+		g_atomic_int_inc(&glk_data->metrics.blorb_chunk_loads);
+		TRACE3(image__decode__begin, image, width, height);
 		info = load_image_from_blorb(resource, image, width, height);
+		TRACE2(image__decode__end, image, info != NULL);
 	}
 
 	if(info == NULL)
@@ -174,9 +184,8 @@ on_pixbuf_closed(GdkPixbufLoader *loader, gpointer data)
 }
 
 static struct image_info*
-image_cache_find(struct image_info* to_find)
+image_cache_lookup(ChimaraGlkPrivate *glk_data, struct image_info* to_find)
 {
-	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
 	GSList *link = glk_data->image_cache;
 
 	/* Empty cache */
@@ -210,6 +219,69 @@ image_cache_find(struct image_info* to_find)
 	return match;
 }
 
+static struct image_info*
+image_cache_find(struct image_info* to_find)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	struct image_info *found = image_cache_lookup(glk_data, to_find);
+	if(found)
+		g_atomic_int_inc(&glk_data->metrics.image_cache_hits);
+	else
+		g_atomic_int_inc(&glk_data->metrics.image_cache_misses);
+	return found;
+}
+
+static void
+clear_graphics_op(struct graphics_op *op)
+{
+	g_clear_object(&op->pixbuf);
+}
+
+/* Internal function: creates an empty batch of drawing operations for a
+ * graphics window */
+static GArray *
+graphics_batch_new(void)
+{
+	GArray *batch = g_array_sized_new(FALSE, FALSE, sizeof(struct graphics_op), 64);
+	g_array_set_clear_func(batch, (GDestroyNotify)clear_graphics_op);
+	return batch;
+}
+
+/* Internal function: adds @op to the batch of drawing operations of the
+ * graphics window @win. The batch is sent to the UI thread as one message when
+ * the window buffers are flushed, such as in glk_select(). */
+static void
+queue_graphics_op(winid_t win, struct graphics_op *op)
+{
+	if(win->graphics_batch == NULL)
+		win->graphics_batch = graphics_batch_new();
+	g_array_append_vals(win->graphics_batch, op, 1);
+
+	if(win->graphics_batch->len >= GRAPHICS_BATCH_MAX_LENGTH)
+		queue_flush_window_buffer(win);
+}
+
+/* Internal function: draws @pixbuf in @win, which is either a graphics window
+ * or a text buffer window. */
+static void
+draw_pixbuf(winid_t win, GdkPixbuf *pixbuf, glsi32 val1, glsi32 val2)
+{
+	if(win->type == wintype_Graphics) {
+		struct graphics_op op = {
+			.type = GRAPHICS_OP_DRAW_IMAGE,
+			.x = val1,
+			.y = val2,
+			.pixbuf = g_object_ref(pixbuf),
+		};
+		queue_graphics_op(win, &op);
+	} else {
+		UiMessage *msg = ui_message_new(UI_MESSAGE_BUFFER_DRAW_IMAGE, win);
+		msg->ptrval = pixbuf;
+		msg->uintval1 = val1;
+		ui_message_queue(msg);
+	}
+}
+
 /**
  * glk_image_get_info:
  * @image: An image resource number.
@@ -305,18 +377,7 @@ glk_image_draw(winid_t win, glui32 image, glsi32 val1, glsi32 val2)
 			return FALSE;
 	}
 
-	UiMessage *msg;
-	if(win->type == wintype_Graphics) {
-		msg = ui_message_new(UI_MESSAGE_GRAPHICS_DRAW_IMAGE, win);
-		msg->ptrval = info->pixbuf;
-		msg->x = val1;
-		msg->y = val2;
-	} else {
-		msg = ui_message_new(UI_MESSAGE_BUFFER_DRAW_IMAGE, win);
-		msg->ptrval = info->pixbuf;
-		msg->uintval1 = val1;
-	}
-	ui_message_queue(msg);
+	draw_pixbuf(win, info->pixbuf, val1, val2);
 
 	/* There is currently no way for the drawing not to succeed, so we don't
 	have to wait for an answer from the UI thread */
@@ -386,18 +447,7 @@ glk_image_draw_scaled(winid_t win, glui32 image, glsi32 val1, glsi32 val2, glui3
 		info = scaled_info;
 	}
 
-	UiMessage *msg;
-	if(win->type == wintype_Graphics) {
-		msg = ui_message_new(UI_MESSAGE_GRAPHICS_DRAW_IMAGE, win);
-		msg->ptrval = info->pixbuf;
-		msg->x = val1;
-		msg->y = val2;
-	} else {
-		msg = ui_message_new(UI_MESSAGE_BUFFER_DRAW_IMAGE, win);
-		msg->ptrval = info->pixbuf;
-		msg->uintval1 = val1;
-	}
-	ui_message_queue(msg);
+	draw_pixbuf(win, info->pixbuf, val1, val2);
 
 	/* There is currently no way for the drawing not to succeed, so we don't
 	have to wait for an answer from the UI thread */
@@ -455,13 +505,18 @@ glk_window_fill_rect(winid_t win, glui32 color, glsi32 left, glsi32 top, glui32
 	VALID_WINDOW(win, return);
 	g_return_if_fail(win->type == wintype_Graphics);
 
-	UiMessage *msg = ui_message_new(UI_MESSAGE_GRAPHICS_FILL_RECT, win);
-	msg->uintval1 = color;
-	msg->x = left;
-	msg->y = top;
-	msg->uintval2 = width;
-	msg->uintval2 = height;
-	ui_message_queue(msg);
+	if(width == 0 || height == 0)
+		return;
+
+	struct graphics_op op = {
+		.type = GRAPHICS_OP_FILL_RECT,
+		.x = left,
+		.y = top,
+		.width = width,
+		.height = height,
+		.color = color,
+	};
+	queue_graphics_op(win, &op);
 }
 
 /**
@@ -14,4 +14,19 @@ struct image_info {
 	gboolean scaled;
 };
 
+enum graphics_op_type {
+	GRAPHICS_OP_FILL_RECT,
+	GRAPHICS_OP_DRAW_IMAGE
+};
+
+/* A drawing operation on a graphics window, waiting to be sent to the UI thread
+ * together with the other operations of the same batch */
+struct graphics_op {
+	enum graphics_op_type type;
+	int32_t x, y;
+	uint32_t width, height;  /* fill_rect only */
+	uint32_t color;          /* fill_rect only */
+	GdkPixbuf *pixbuf;       /* draw_image only; owns a reference */
+};
+
 #endif
@@ -0,0 +1,115 @@
+#include <string.h>
+
+#include <glib.h>
+
+#include "metrics.h"
+#include "ui-message.h"
+
+/* Internal function: initialize @metrics, when the widget is created. */
+void
+metrics_init(ChimaraMetrics *metrics)
+{
+	memset(metrics, 0, sizeof(ChimaraMetrics));
+	g_mutex_init(&metrics->ui_round_trip_usec.lock);
+	g_mutex_init(&metrics->flush_bytes.lock);
+	g_mutex_init(&metrics->select_wait_usec.lock);
+}
+
+/* Internal function: free the resources held by @metrics, when the widget is
+ finalized. */
+void
+metrics_clear(ChimaraMetrics *metrics)
+{
+	g_mutex_clear(&metrics->ui_round_trip_usec.lock);
+	g_mutex_clear(&metrics->flush_bytes.lock);
+	g_mutex_clear(&metrics->select_wait_usec.lock);
+}
+
+/* Helper function: zero all the counters in @histogram. */
+static void
+histogram_reset(MetricsHistogram *histogram)
+{
+	g_mutex_lock(&histogram->lock);
+	histogram->count = 0;
+	histogram->sum = 0;
+	memset(histogram->buckets, 0, sizeof(histogram->buckets));
+	g_mutex_unlock(&histogram->lock);
+}
+
+/* Internal function: zero all the metrics, when a new Glk program starts. Must
+ not be called while the Glk thread is running. */
+void
+metrics_reset(ChimaraMetrics *metrics)
+{
+	memset(metrics->ui_messages, 0, sizeof(metrics->ui_messages));
+	histogram_reset(&metrics->ui_round_trip_usec);
+	histogram_reset(&metrics->flush_bytes);
+	histogram_reset(&metrics->select_wait_usec);
+	metrics->image_cache_hits = 0;
+	metrics->image_cache_misses = 0;
+	metrics->blorb_chunk_loads = 0;
+}
+
+/* Internal function: record @value in @histogram. */
+void
+metrics_histogram_add(MetricsHistogram *histogram, guint64 value)
+{
+	unsigned bucket = 0;
+	while(value >> bucket && bucket < METRICS_HISTOGRAM_BUCKETS - 1)
+		bucket++;
+
+	g_mutex_lock(&histogram->lock);
+	histogram->buckets[bucket]++;
+	histogram->sum += value;
+	histogram->count++;
+	g_mutex_unlock(&histogram->lock);
+}
+
+/* Helper function: snapshot of @histogram as a dictionary with the count, the
+ sum, and an array of bucket counts. Trailing empty buckets are left out. */
+static GVariant *
+histogram_to_variant(MetricsHistogram *histogram)
+{
+	guint64 buckets[METRICS_HISTOGRAM_BUCKETS];
+	g_mutex_lock(&histogram->lock);
+	guint64 count = histogram->count;
+	guint64 sum = histogram->sum;
+	memcpy(buckets, histogram->buckets, sizeof(buckets));
+	g_mutex_unlock(&histogram->lock);
+
+	size_t num_buckets = 0;
+	for(size_t ix = 0; ix < METRICS_HISTOGRAM_BUCKETS; ix++) {
+		if(buckets[ix] != 0)
+			num_buckets = ix + 1;
+	}
+
+	GVariantDict dict;
+	g_variant_dict_init(&dict, NULL);
+	g_variant_dict_insert(&dict, "count", "t", count);
+	g_variant_dict_insert(&dict, "sum", "t", sum);
+	g_variant_dict_insert_value(&dict, "buckets",
+		g_variant_new_fixed_array(G_VARIANT_TYPE_UINT64, buckets, num_buckets, sizeof(guint64)));
+	return g_variant_dict_end(&dict);
+}
+
+/* Internal function: add a snapshot of @metrics to @dict. See
+ chimara_glk_get_metrics() for the keys. */
+void
+metrics_add_to_dict(ChimaraMetrics *metrics, GVariantDict *dict)
+{
+	GVariantBuilder messages;
+	g_variant_builder_init(&messages, G_VARIANT_TYPE("a{su}"));
+	for(UiMessageType type = 0; type <= UI_MESSAGE_SHUTDOWN; type++) {
+		unsigned count = g_atomic_int_get(&metrics->ui_messages[type]);
+		if(count != 0)
+			g_variant_builder_add(&messages, "{su}", ui_message_type_name(type), count);
+	}
+	g_variant_dict_insert_value(dict, "ui-messages", g_variant_builder_end(&messages));
+
+	g_variant_dict_insert_value(dict, "ui-round-trip-usec", histogram_to_variant(&metrics->ui_round_trip_usec));
+	g_variant_dict_insert_value(dict, "flush-bytes", histogram_to_variant(&metrics->flush_bytes));
+	g_variant_dict_insert_value(dict, "select-wait-usec", histogram_to_variant(&metrics->select_wait_usec));
+	g_variant_dict_insert(dict, "image-cache-hits", "u", (guint32) g_atomic_int_get(&metrics->image_cache_hits));
+	g_variant_dict_insert(dict, "image-cache-misses", "u", (guint32) g_atomic_int_get(&metrics->image_cache_misses));
+	g_variant_dict_insert(dict, "blorb-chunk-loads", "u", (guint32) g_atomic_int_get(&metrics->blorb_chunk_loads));
+}
@@ -0,0 +1,46 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <glib.h>
+
+#include "ui-message.h"
+
+/* Histogram bucket 0 counts values of 0, bucket n counts values from 2^(n-1)
+ up to 2^n - 1, and the last bucket counts everything larger than that */
+#define METRICS_HISTOGRAM_BUCKETS 32
+
+/* Histogram with power-of-two buckets. The counters are 64 bits wide even on
+ 32-bit platforms, so they are protected by a lock rather than updated
+ atomically; they are read from the UI thread while the Glk thread is writing
+ them. */
+typedef struct {
+	GMutex lock;
+	guint64 count;
+	guint64 sum;
+	guint64 buckets[METRICS_HISTOGRAM_BUCKETS];
+} MetricsHistogram;
+
+/* Runtime metrics of the Glk program currently running, see
+ chimara_glk_get_metrics(). Reset when a new program is started. */
+typedef struct {
+	/* Number of messages sent to the UI thread, by type */
+	int ui_messages[UI_MESSAGE_SHUTDOWN + 1];
+	/* Time the Glk thread spent waiting for a response from the UI thread */
+	MetricsHistogram ui_round_trip_usec;
+	/* Number of bytes sent to the UI thread per window buffer flush */
+	MetricsHistogram flush_bytes;
+	/* Time glk_select() spent waiting for an event */
+	MetricsHistogram select_wait_usec;
+	int image_cache_hits;
+	int image_cache_misses;
+	/* Resources loaded from the Blorb resource map */
+	int blorb_chunk_loads;
+} ChimaraMetrics;
+
+G_GNUC_INTERNAL void metrics_init(ChimaraMetrics *metrics);
+G_GNUC_INTERNAL void metrics_clear(ChimaraMetrics *metrics);
+G_GNUC_INTERNAL void metrics_reset(ChimaraMetrics *metrics);
+G_GNUC_INTERNAL void metrics_histogram_add(MetricsHistogram *histogram, guint64 value);
+G_GNUC_INTERNAL void metrics_add_to_dict(ChimaraMetrics *metrics, GVariantDict *dict);
+
+#endif
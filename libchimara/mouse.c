@@ -17,6 +17,7 @@ glk_request_mouse_event(winid_t win)
 	g_return_if_fail(win != NULL);
 	g_return_if_fail(win->type == wintype_TextGrid || win->type == wintype_Graphics);
 
+	win->mouse_input_requested = TRUE;
 	g_signal_handler_unblock(win->widget, win->button_press_event_handler);
 }
 
@@ -33,5 +34,6 @@ glk_cancel_mouse_event(winid_t win)
 	g_return_if_fail(win != NULL);
 	g_return_if_fail(win->type == wintype_TextGrid || win->type == wintype_Graphics);
 
+	win->mouse_input_requested = FALSE;
 	g_signal_handler_block(win->widget, win->button_press_event_handler);
 }
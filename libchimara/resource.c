@@ -42,6 +42,42 @@ giblorb_set_resource_map(strid_t file)
 	glk_data->resource_map = newmap;
 	glk_data->resource_file = file;
 
+	/* Sound resource numbers now refer to different sounds */
+	g_mutex_lock(&glk_data->sound_types_lock);
+	g_hash_table_remove_all(glk_data->sound_types);
+	g_mutex_unlock(&glk_data->sound_types_lock);
+
+	return giblorb_err_None;
+}
+
+/**
+ * giblorb_unset_resource_map:
+ *
+ * This function tells the library to forget the current resource map, if
+ * there is one. The stream that the map was read from is not closed; the
+ * program is responsible for it again.
+ *
+ * This is not part of the Blorb spec. It comes from RemGlk, where interpreters
+ * use it to switch the resource map over to a stream that was restored by
+ * glkunix_update_from_library_state().
+ *
+ * Returns: a Blorb error code.
+ */
+giblorb_err_t
+giblorb_unset_resource_map(void)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+
+	if(glk_data->resource_map != NULL)
+		giblorb_destroy_map(glk_data->resource_map);
+	glk_data->resource_map = NULL;
+	glk_data->resource_file = NULL;
+
+	/* Sound resource numbers no longer refer to anything */
+	g_mutex_lock(&glk_data->sound_types_lock);
+	g_hash_table_remove_all(glk_data->sound_types);
+	g_mutex_unlock(&glk_data->sound_types_lock);
+
 	return giblorb_err_None;
 }
 
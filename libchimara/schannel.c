@@ -15,22 +15,19 @@
 
 #define VOLUME_TIMER_RESOLUTION 1.0 /* In milliseconds */
 #define OGG_MIMETYPE "audio/ogg"
+/* How long glk_schannel_play_multi() waits for all the sounds to preroll */
+#define PLAY_MULTI_PREROLL_TIMEOUT GST_SECOND
+/* Time between scheduling a synchronized start and the sounds starting, to
+ give every pipeline time to go to PLAYING */
+#define PLAY_MULTI_START_DELAY (20 * GST_MSECOND)
 
 extern GPrivate glk_data_key;
 
 #if HAVE_SOUND
-/* Stop any currently playing sound on this channel, and remove any
- format-specific GStreamer elements from the channel. */
+/* Remove the format-specific GStreamer elements from the channel. */
 static void
-clean_up_after_playing_sound(schanid_t chan)
+discard_decoder(schanid_t chan)
 {
-	if(!gst_element_set_state(chan->pipeline, GST_STATE_NULL))
-		WARNING("Could not set GstElement state to NULL");
-	if(chan->source)
-	{
-		gst_bin_remove(GST_BIN(chan->pipeline), chan->source);
-		chan->source = NULL;
-	}
 	if(chan->demux)
 	{
 		gst_bin_remove(GST_BIN(chan->pipeline), chan->demux);
@@ -41,6 +38,65 @@ clean_up_after_playing_sound(schanid_t chan)
 		gst_bin_remove(GST_BIN(chan->pipeline), chan->decode);
 		chan->decode = NULL;
 	}
+	g_clear_pointer(&chan->decoder_type, g_free);
+}
+
+/* glk_schannel_play_multi() takes over the base time of the pipelines it
+ starts, which turns off the pipeline's own running time bookkeeping. Turn it
+ back on before the pipeline is paused, seeks, or is stopped, so that the
+ running time is accounted for correctly afterwards. */
+static void
+restore_running_time(schanid_t chan)
+{
+	if(gst_element_get_start_time(chan->pipeline) == GST_CLOCK_TIME_NONE)
+		gst_element_set_start_time(chan->pipeline, 0);
+}
+
+/* Stop any currently playing sound on this channel. The source and decoder
+ elements stay in the pipeline, so that the next sound can reuse them. */
+static void
+clean_up_after_playing_sound(schanid_t chan)
+{
+	/* Otherwise the next sound would run against the base time that
+	 glk_schannel_play_multi() pinned for this one */
+	restore_running_time(chan);
+	if(!gst_element_set_state(chan->pipeline, GST_STATE_NULL))
+		WARNING("Could not set GstElement state to NULL");
+}
+
+/* Stop the channel after an error, and remove all the elements that were
+ created for the sound, since they may be in a bad state. */
+static void
+clean_up_after_error(schanid_t chan)
+{
+	clean_up_after_playing_sound(chan);
+	if(chan->source)
+	{
+		gst_bin_remove(GST_BIN(chan->pipeline), chan->source);
+		chan->source = NULL;
+	}
+	discard_decoder(chan);
+}
+
+/* Remember the media type of sound resource @snd, so that playing it again
+ does not have to detect the type. May be called from any thread. */
+static void
+remember_sound_type(ChimaraGlkPrivate *glk_data, glui32 snd, const char *type)
+{
+	g_mutex_lock(&glk_data->sound_types_lock);
+	g_hash_table_replace(glk_data->sound_types, GUINT_TO_POINTER(snd), g_strdup(type));
+	g_mutex_unlock(&glk_data->sound_types_lock);
+}
+
+/* Look up the media type of sound resource @snd, if it is known. The caller
+ owns the returned string. */
+static char *
+lookup_sound_type(ChimaraGlkPrivate *glk_data, glui32 snd)
+{
+	g_mutex_lock(&glk_data->sound_types_lock);
+	char *retval = g_strdup(g_hash_table_lookup(glk_data->sound_types, GUINT_TO_POINTER(snd)));
+	g_mutex_unlock(&glk_data->sound_types_lock);
+	return retval;
 }
 
 /* This signal is thrown whenever the GStreamer pipeline generates a message.
@@ -60,7 +116,7 @@ on_pipeline_message(GstBus *bus, GstMessage *message, schanid_t s)
 		IO_WARNING("GStreamer error", err->message, debug_message);
 		g_error_free(err);
 		g_free(debug_message);
-		clean_up_after_playing_sound(s);
+		clean_up_after_error(s);
 	}
 		break;
 	case GST_MESSAGE_WARNING:
@@ -84,9 +140,10 @@ on_pipeline_message(GstBus *bus, GstMessage *message, schanid_t s)
 		if(s->repeats != (glui32)-1)
 			s->repeats--;
 		if(s->repeats > 0) {
+			restore_running_time(s);
 			if(!gst_element_seek_simple(s->pipeline, GST_FORMAT_TIME, GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT, 0)) {
 				WARNING("Could not execute GStreamer seek");
-				clean_up_after_playing_sound(s);
+				clean_up_after_error(s);
 			}
 		} else {
 			clean_up_after_playing_sound(s);
@@ -122,6 +179,14 @@ static void
 on_type_found(GstElement *typefind, guint probability, GstCaps *caps, schanid_t s)
 {
 	gchar *type = gst_caps_to_string(caps);
+	remember_sound_type(s->glk_data, s->resource, type);
+
+	/* The elements from the previous sound are still linked up, if it had the
+	 same type */
+	if(s->decoder_type != NULL && strcmp(type, s->decoder_type) == 0)
+		goto finally;
+	discard_decoder(s);
+
 	if(strcmp(type, OGG_MIMETYPE) == 0) {
 		s->demux = gst_element_factory_make("oggdemux", NULL);
 		s->decode = gst_element_factory_make("vorbisdec", NULL);
@@ -163,6 +228,7 @@ on_type_found(GstElement *typefind, guint probability, GstCaps *caps, schanid_t
 		}
 	} else {
 		WARNING_S("Unexpected audio type in blorb", type);
+		goto finally;
 	}
 
 	/* This is necessary in case this handler occurs in the middle of a state
@@ -171,6 +237,8 @@ on_type_found(GstElement *typefind, guint probability, GstCaps *caps, schanid_t
 	if(s->demux != NULL)
 		gst_element_sync_state_with_parent(s->demux);
 
+	s->decoder_type = g_strdup(type);
+
 finally:
 	g_free(type);
 }
@@ -208,10 +276,147 @@ load_resource_into_giostream(glui32 snd)
 				WARNING_S("Error loading resource", giblorb_get_error_message(result));
 			return NULL;
 		}
+		g_atomic_int_inc(&glk_data->metrics.blorb_chunk_loads);
 		retval = g_memory_input_stream_new_from_data(resource.data.ptr, resource.length, NULL);
 	}
 	return retval;
 }
+
+/* Get the channel ready to play sound resource @snd, reusing the elements from
+ the previous sound where possible. If the type of the sound is already known,
+ the typefinder is told about it so that it can skip detection. */
+static gboolean
+prepare_sound(schanid_t chan, glui32 snd)
+{
+	GInputStream *stream = load_resource_into_giostream(snd);
+	if(stream == NULL)
+		return FALSE;
+
+	if(chan->source == NULL) {
+		chan->source = gst_element_factory_make("giostreamsrc", NULL);
+		if(chan->source == NULL) {
+			WARNING("Could not create 'giostreamsrc' GStreamer element");
+			g_object_unref(stream);
+			return FALSE;
+		}
+		gst_bin_add(GST_BIN(chan->pipeline), chan->source);
+		if(!gst_element_link(chan->source, chan->typefind)) {
+			WARNING("Could not link GStreamer elements");
+			g_object_unref(stream);
+			clean_up_after_error(chan);
+			return FALSE;
+		}
+	}
+	g_object_set(chan->source, "stream", stream, NULL);
+	g_object_unref(stream); /* Now owned by GStreamer element */
+
+	GstCaps *caps = NULL;
+	char *type = lookup_sound_type(chan->glk_data, snd);
+	if(type != NULL) {
+		caps = gst_caps_from_string(type);
+		g_free(type);
+	}
+	g_object_set(chan->typefind, "force-caps", caps, NULL);
+	if(caps != NULL)
+		gst_caps_unref(caps);
+
+	chan->resource = snd;
+	return TRUE;
+}
+
+/* Callback for the typefinder in detect_sound_type(); runs in a GStreamer
+ streaming thread */
+static void
+on_load_hint_type_found(GstElement *typefind, guint probability, GstCaps *caps, GstElement *pipeline)
+{
+	ChimaraGlkPrivate *glk_data = g_object_get_data(G_OBJECT(pipeline), "glk-data");
+	glui32 snd = GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(pipeline), "resource"));
+	gchar *type = gst_caps_to_string(caps);
+	remember_sound_type(glk_data, snd, type);
+	g_free(type);
+}
+
+/* Shut down the pipeline from detect_sound_type() once it has prerolled or
+ failed; by then the typefinder has reported the type, if it found one. Runs in
+ the main thread. */
+static void
+on_load_hint_message(GstBus *bus, GstMessage *message, GstElement *pipeline)
+{
+	switch(GST_MESSAGE_TYPE(message)) {
+	case GST_MESSAGE_ASYNC_DONE:
+	case GST_MESSAGE_ERROR:
+	case GST_MESSAGE_EOS:
+		break;
+	default:
+		return;
+	}
+
+	g_signal_handlers_disconnect_by_func(bus, on_load_hint_message, pipeline);
+	gst_bus_remove_signal_watch(bus);
+	gst_element_set_state(pipeline, GST_STATE_NULL);
+	gst_object_unref(pipeline);
+}
+
+/* Start running sound resource @snd through a throwaway pipeline that does
+ nothing but detect its type, so that playing it later can skip that step.
+ Returns without waiting for the result; if the sound is played before the type
+ is known, the channel's own typefinder detects it as usual. */
+static void
+detect_sound_type(ChimaraGlkPrivate *glk_data, glui32 snd)
+{
+	char *type = lookup_sound_type(glk_data, snd);
+	if(type != NULL) {
+		g_free(type);
+		return;
+	}
+
+	GInputStream *stream = load_resource_into_giostream(snd);
+	if(stream == NULL)
+		return;
+
+	GstElement *pipeline = gst_pipeline_new(NULL);
+	GstElement *source = gst_element_factory_make("giostreamsrc", NULL);
+	GstElement *typefind = gst_element_factory_make("typefind", NULL);
+	GstElement *sink = gst_element_factory_make("fakesink", NULL);
+	if(!source || !typefind || !sink) {
+		WARNING("Could not create one or more GStreamer elements");
+		g_clear_object(&source);
+		g_clear_object(&typefind);
+		g_clear_object(&sink);
+		goto fail;
+	}
+	g_object_set(source, "stream", stream, NULL);
+	g_object_unref(stream); /* Now owned by GStreamer element */
+	stream = NULL;
+	/* The typefinder writes into glk_data, so keep the widget alive until the
+	 pipeline is gone */
+	g_object_set_data_full(G_OBJECT(pipeline), "glk", g_object_ref(glk_data->self), g_object_unref);
+	g_object_set_data(G_OBJECT(pipeline), "glk-data", glk_data);
+	g_object_set_data(G_OBJECT(pipeline), "resource", GUINT_TO_POINTER(snd));
+	g_signal_connect(typefind, "have-type", G_CALLBACK(on_load_hint_type_found), pipeline);
+
+	gst_bin_add_many(GST_BIN(pipeline), source, typefind, sink, NULL);
+	if(!gst_element_link_many(source, typefind, sink, NULL)) {
+		WARNING("Could not link GStreamer elements");
+		goto fail;
+	}
+
+	GstBus *bus = gst_pipeline_get_bus(GST_PIPELINE(pipeline));
+	gst_bus_add_signal_watch(bus);
+	g_signal_connect(bus, "message", G_CALLBACK(on_load_hint_message), pipeline);
+	gst_object_unref(bus);
+
+	/* The type is found before the pipeline finishes prerolling. If the state
+	 change fails, the element that failed posts an error, and
+	 on_load_hint_message() cleans up, so the pipeline is not touched here
+	 after this. */
+	gst_element_set_state(pipeline, GST_STATE_PAUSED);
+	return;
+
+fail:
+	g_clear_object(&stream);
+	gst_object_unref(pipeline);
+}
 #endif  /* HAVE_SOUND */
 
 /**
@@ -280,12 +485,19 @@ glk_schannel_create_ext(glui32 rock, glui32 volume)
 
 	/* Add a pointer to the ChimaraGlk widget, for convenience */
 	s->glk = glk_data->self;
+	s->glk_data = glk_data;
 
 	/* Create a GStreamer pipeline for the sound channel */
 	gchar *pipeline_name = g_strdup_printf("pipeline-%p", s);
 	s->pipeline = gst_pipeline_new(pipeline_name);
 	g_free(pipeline_name);
 
+	/* All channels run on the same clock, so that they can be started in sync
+	 by glk_schannel_play_multi() */
+	GstClock *clock = gst_system_clock_obtain();
+	gst_pipeline_use_clock(GST_PIPELINE(s->pipeline), clock);
+	gst_object_unref(clock);
+
 	/* Watch for messages from the pipeline */
 	GstBus *bus = gst_pipeline_get_bus(GST_PIPELINE(s->pipeline));
 	gst_bus_add_signal_watch(bus);
@@ -355,6 +567,7 @@ glk_schannel_destroy(schanid_t chan)
 	/* This also frees all the objects inside the pipeline */
 	if(chan->pipeline)
 		gst_object_unref(chan->pipeline);
+	g_free(chan->decoder_type);
 	
 	chan->magic = MAGIC_FREE;
 	g_slice_free(struct glk_schannel_struct, chan);
@@ -496,28 +709,16 @@ glk_schannel_play_ext(schanid_t chan, glui32 snd, glui32 repeats, glui32 notify)
 		return 1;
 	}
 
-	GInputStream *stream = load_resource_into_giostream(snd);
-	if(stream == NULL)
-		return 0;
-
-	chan->source = gst_element_factory_make("giostreamsrc", NULL);
-	g_object_set(chan->source, "stream", stream, NULL);
-	g_object_unref(stream); /* Now owned by GStreamer element */
-	gst_bin_add(GST_BIN(chan->pipeline), chan->source);
-	if(!gst_element_link(chan->source, chan->typefind)) {
-		WARNING("Could not link GStreamer elements");
-		clean_up_after_playing_sound(chan);
+	if(!prepare_sound(chan, snd))
 		return 0;
-	}
 
 	chan->repeats = repeats;
-	chan->resource = snd;
 	chan->notify = notify;
 	
 	/* Play the sound; unless the channel is paused, then pause it instead */
 	if(!gst_element_set_state(chan->pipeline, chan->paused? GST_STATE_PAUSED : GST_STATE_PLAYING)) {
 		WARNING_S("Could not set GstElement state to", chan->paused? "PAUSED" : "PLAYING");
-		clean_up_after_playing_sound(chan);
+		clean_up_after_error(chan);
 		return 0;
 	}
 	return 1;
@@ -583,41 +784,56 @@ glk_schannel_play_multi(schanid_t *chanarray, glui32 chancount, glui32 *sndarray
 		/* Stop the previous sound */
 		clean_up_after_playing_sound(chanarray[count]);
 
-		GInputStream *stream = load_resource_into_giostream(sndarray[count]);
-		if(stream == NULL) {
+		if(!prepare_sound(chanarray[count], sndarray[count])) {
 			skiparray[count] = TRUE;
 			continue;
 		}
 
-		chanarray[count]->source = gst_element_factory_make("giostreamsrc", NULL);
-		g_object_set(chanarray[count]->source, "stream", stream, NULL);
-		g_object_unref(stream); /* Now owned by GStreamer element */
-		gst_bin_add(GST_BIN(chanarray[count]->pipeline), chanarray[count]->source);
-		if(!gst_element_link(chanarray[count]->source, chanarray[count]->typefind)) {
-			WARNING("Could not link GStreamer elements");
-			clean_up_after_playing_sound(chanarray[count]);
-		}
-
 		chanarray[count]->repeats = 1;
-		chanarray[count]->resource = sndarray[count];
 		chanarray[count]->notify = notify;
 	}
 
-	/* Start all the sounds as close to each other as possible. */
-	/* FIXME: Is there a way to start them exactly at the same time? */
+	/* Preroll all the sounds, so that none of them has to wait for data once
+	 they are started. Paused channels stay in this state. */
 	glui32 successes = 0;
 	for(count = 0; count < chancount; count++) {
 		if(skiparray[count])
 			continue;
-		/* Play the sound; unless the channel is paused, then pause it instead */
-		if(!gst_element_set_state(chanarray[count]->pipeline, chanarray[count]->paused? GST_STATE_PAUSED : GST_STATE_PLAYING)) {
-			WARNING_S("Could not set GstElement state to", chanarray[count]->paused? "PAUSED" : "PLAYING");
+		if(!gst_element_set_state(chanarray[count]->pipeline, GST_STATE_PAUSED)) {
+			WARNING("Could not set GstElement state to PAUSED");
 			skiparray[count] = TRUE;
-			clean_up_after_playing_sound(chanarray[count]);
+			clean_up_after_error(chanarray[count]);
 			continue;
 		}
 		successes++;
 	}
+	for(count = 0; count < chancount; count++) {
+		if(skiparray[count] || chanarray[count]->paused)
+			continue;
+		if(gst_element_get_state(chanarray[count]->pipeline, NULL, NULL, PLAY_MULTI_PREROLL_TIMEOUT) == GST_STATE_CHANGE_FAILURE) {
+			WARNING("Could not preroll sound");
+			skiparray[count] = TRUE;
+			clean_up_after_error(chanarray[count]);
+			successes--;
+		}
+	}
+
+	/* Start all the sounds at the same moment on the shared clock, by giving
+	 them the same base time instead of letting each pipeline pick its own */
+	GstClock *clock = gst_system_clock_obtain();
+	GstClockTime base_time = gst_clock_get_time(clock) + PLAY_MULTI_START_DELAY;
+	gst_object_unref(clock);
+	for(count = 0; count < chancount; count++) {
+		if(skiparray[count] || chanarray[count]->paused)
+			continue;
+		gst_element_set_start_time(chanarray[count]->pipeline, GST_CLOCK_TIME_NONE);
+		gst_element_set_base_time(chanarray[count]->pipeline, base_time);
+		if(!gst_element_set_state(chanarray[count]->pipeline, GST_STATE_PLAYING)) {
+			WARNING("Could not set GstElement state to PLAYING");
+			clean_up_after_error(chanarray[count]);
+			successes--;
+		}
+	}
 	g_free(skiparray);
 	return successes;
 #else
@@ -673,6 +889,7 @@ glk_schannel_pause(schanid_t chan)
 	if(state != GST_STATE_PLAYING)
 		return; /* Silently do nothing if no sound is playing */
 
+	restore_running_time(chan);
 	if(!gst_element_set_state(chan->pipeline, GST_STATE_PAUSED)) {
 		WARNING("Could not set GstElement state to PAUSED");
 		return;
@@ -871,6 +1088,11 @@ glk_schannel_set_volume_ext(schanid_t chan, glui32 vol, glui32 duration, glui32
  * @flag is zero, the library may release memory or other resources associated
  * with the sound. Calling this function is always optional, and it has no
  * effect on what the library actually plays.
+ *
+ * > # Chimara #
+ * > Chimara loads the sound into memory and starts detecting its format in
+ * > the background, so that playing it does not have to wait for format
+ * > detection.
  */
 void 
 glk_sound_load_hint(glui32 snd, glui32 flag)
@@ -893,6 +1115,8 @@ glk_sound_load_hint(glui32 snd, glui32 flag)
 				WARNING_S("Error loading resource", giblorb_get_error_message(result));
 			return;
 		}
+		g_atomic_int_inc(&glk_data->metrics.blorb_chunk_loads);
+		detect_sound_type(glk_data, snd);
 	} else {
 		/* Get the Blorb chunk number by loading the resource with
 		 method_DontLoad, then unload that chunk - has no effect if the chunk
@@ -20,6 +20,8 @@ struct glk_schannel_struct
 	GList *schannel_list;
 	/* Pointer to the GTK widget this sound channel belongs to, for convenience */
 	ChimaraGlk *glk;
+	/* Pointer to the widget's private data, for the sound type cache */
+	struct _ChimaraGlkPrivate *glk_data;
 
 	/* Resource number and notification ID of last played sound */
 	glui32 resource, notify;
@@ -37,6 +39,9 @@ struct glk_schannel_struct
 #if HAVE_SOUND
 	/* Each sound channel is represented as a GStreamer pipeline.  */
 	GstElement *pipeline, *source, *typefind, *demux, *decode, *convert, *filter, *sink;
+	/* Media type that the demuxer and decoder were built for. They are kept in
+	 the pipeline between sounds and reused if the next sound has this type. */
+	char *decoder_type;
 #endif
 };
 
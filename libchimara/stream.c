@@ -5,6 +5,7 @@
 
 #include "chimara-glk-private.h"
 #include "fileref.h"
+#include "glkunix.h"
 #include "magic.h"
 #include "resource.h"
 #include "stream.h"
@@ -13,6 +14,19 @@
 
 extern GPrivate glk_data_key;
 
+/* Output to file streams is collected in each stream's write buffer, and
+handed to a writer thread in blocks of at least this size */
+#define FILE_STREAM_BLOCK_SIZE 8192
+
+struct file_stream_block {
+	strid_t str;
+	GByteArray *data;
+};
+
+static GThreadPool *writer_pool = NULL;
+static GMutex writer_lock;
+static GCond block_written;
+
 /* Internal function: create a stream with a specified rock value */
 strid_t
 stream_new_common(glui32 rock)
@@ -22,6 +36,7 @@ stream_new_common(glui32 rock)
 	strid_t str = g_slice_new0(struct glk_stream_struct);
 	str->magic = MAGIC_STREAM;
 	str->rock = rock;
+	str->updatetag = ++glk_data->last_updatetag;
 	if(glk_data->register_obj)
 		str->disprock = (*glk_data->register_obj)(str, gidisp_Class_Stream);
 		
@@ -343,6 +358,91 @@ glk_stream_open_memory_uni(glui32 *buf, glui32 buflen, glui32 fmode, glui32 rock
 	return str;
 }
 
+/* Internal function: write one block of a file stream's output, on the writer
+ thread. There is only one writer thread, so blocks are written in the order
+ they were handed over. */
+static void
+write_file_stream_block(struct file_stream_block *block, gpointer unused)
+{
+	strid_t str = block->str;
+	int error = 0;
+	if(fwrite(block->data->data, 1, block->data->len, str->file_pointer) < block->data->len)
+		error = errno;
+	g_byte_array_unref(block->data);
+	g_slice_free(struct file_stream_block, block);
+
+	g_mutex_lock(&writer_lock);
+	if(error != 0 && str->write_error == 0)
+		str->write_error = error;
+	str->pending_blocks--;
+	g_cond_broadcast(&block_written);
+	g_mutex_unlock(&writer_lock);
+}
+
+/* Internal function: hand whatever is in @str's write buffer to the writer
+ thread. */
+static void
+hand_over_write_buffer(strid_t str)
+{
+	if(str->write_buffer == NULL || str->write_buffer->len == 0)
+		return;
+
+	struct file_stream_block *block = g_slice_new(struct file_stream_block);
+	block->str = str;
+	block->data = str->write_buffer;
+	str->write_buffer = NULL;
+
+	g_mutex_lock(&writer_lock);
+	if(writer_pool == NULL)
+		writer_pool = g_thread_pool_new((GFunc)write_file_stream_block, NULL, 1, FALSE, NULL);
+	str->pending_blocks++;
+	g_mutex_unlock(&writer_lock);
+	g_thread_pool_push(writer_pool, block, NULL);
+}
+
+/* Internal function: reserve room for @maxlen bytes of encoded output at the
+ end of file stream @str's write buffer. Encode the output directly into the
+ returned space and then call file_stream_end_write(). */
+gchar *
+file_stream_begin_write(strid_t str, gsize maxlen)
+{
+	if(str->write_buffer == NULL)
+		str->write_buffer = g_byte_array_sized_new(MAX(FILE_STREAM_BLOCK_SIZE, maxlen));
+	guint start = str->write_buffer->len;
+	g_byte_array_set_size(str->write_buffer, start + maxlen);
+	return (gchar *)str->write_buffer->data + start;
+}
+
+/* Internal function: finish writing to the space returned by
+ file_stream_begin_write(); @end points just past the last byte written. Hands
+ the write buffer to the writer thread once it has filled up. */
+void
+file_stream_end_write(strid_t str, const gchar *end)
+{
+	g_byte_array_set_size(str->write_buffer, end - (gchar *)str->write_buffer->data);
+	if(str->write_buffer->len >= FILE_STREAM_BLOCK_SIZE)
+		hand_over_write_buffer(str);
+}
+
+/* Internal function: make sure all output written to file stream @str has
+ reached its file pointer. Call this before anything else that uses the file
+ pointer, such as reading, seeking, or closing. */
+void
+file_stream_sync(strid_t str)
+{
+	hand_over_write_buffer(str);
+
+	g_mutex_lock(&writer_lock);
+	while(str->pending_blocks > 0)
+		g_cond_wait(&block_written, &writer_lock);
+	int error = str->write_error;
+	str->write_error = 0;
+	g_mutex_unlock(&writer_lock);
+
+	if(error != 0)
+		IO_WARNING( "Error writing to file", str->filename, g_strerror(error) );
+}
+
 /* Internal function: create a stream using the given parameters. */
 strid_t
 file_stream_new(frefid_t fileref, glui32 fmode, glui32 rock, gboolean unicode)
@@ -360,6 +460,9 @@ file_stream_new(frefid_t fileref, glui32 fmode, glui32 rock, gboolean unicode)
 			modestr = binary? "rb" : "r";
 			break;
 		case filemode_Write:
+			/* Don't truncate a file that a library state is still being
+			written to */
+			autosave_wait_for_writes();
 			modestr = binary? "wb" : "w";
 			break;
 		case filemode_WriteAppend:
@@ -418,6 +521,57 @@ file_stream_new(frefid_t fileref, glui32 fmode, glui32 rock, gboolean unicode)
 	return str;
 }
 
+/* Internal function: open a file stream again when restoring the library
+ state. Unlike file_stream_new(), this never truncates the file or asks for
+ confirmation, and puts the file mark back at @position. */
+strid_t
+file_stream_reopen(const char *pathname, glui32 fmode, gboolean binary, gboolean unicode, long position, glui32 rock)
+{
+	gchar *filename = g_filename_to_utf8(pathname, -1, NULL, NULL, NULL);
+	if(filename == NULL)
+		filename = g_strdup("Unknown file name"); /* fail silently */
+
+	const gchar *modestr;
+	if(fmode == filemode_Read) {
+		if(!g_file_test(pathname, G_FILE_TEST_EXISTS)) {
+			g_free(filename);
+			return NULL;
+		}
+		modestr = binary? "rb" : "r";
+	} else {
+		/* Create the file again if it has disappeared */
+		FILE *fp = g_fopen(pathname, binary? "ab" : "a");
+		if(fp == NULL || fclose(fp) != 0) {
+			IO_WARNING( "Error opening file", filename, g_strerror(errno) );
+			g_free(filename);
+			return NULL;
+		}
+		modestr = binary? "r+b" : "r+";
+	}
+
+	FILE *fp = g_fopen(pathname, modestr);
+	if(fp == NULL) {
+		IO_WARNING( "Error opening file", filename, g_strerror(errno) );
+		g_free(filename);
+		return NULL;
+	}
+	if(fseek(fp, position, SEEK_SET) != 0) {
+		IO_WARNING( "Error seeking in file", filename, g_strerror(errno) );
+		fclose(fp);
+		g_free(filename);
+		return NULL;
+	}
+
+	strid_t str = stream_new_common(rock);
+	str->file_mode = fmode;
+	str->type = STREAM_TYPE_FILE;
+	str->file_pointer = fp;
+	str->binary = binary;
+	str->unicode = unicode;
+	str->filename = filename;
+	return str;
+}
+
 /**
  * glk_stream_open_file:
  * @fileref: Indicates the file which will be opened.
@@ -573,6 +727,8 @@ glk_stream_open_resource(glui32 filenum, glui32 rock)
 		}
 		return NULL;
 	}
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	g_atomic_int_inc(&glk_data->metrics.blorb_chunk_loads);
 
 	/* We'll use the in-memory copy of the chunk data as the basis for
 	our new stream. It's important to not call chunk_unload() until
@@ -603,6 +759,7 @@ glk_stream_open_resource(glui32 filenum, glui32 rock)
 	str->type = STREAM_TYPE_RESOURCE;
 	str->file_mode = filemode_Read;
 	str->binary = isbinary;
+	str->resource_number = filenum;
 
 	if (res.data.ptr && res.length) {
 		str->buffer = res.data.ptr;
@@ -690,6 +847,9 @@ glk_stream_close(strid_t str, stream_result_t *result)
 			break;
 		
 		case STREAM_TYPE_FILE:
+			file_stream_sync(str);
+			if(str->write_buffer)
+				g_byte_array_unref(str->write_buffer);
 			if(fclose(str->file_pointer) != 0)
 				IO_WARNING( "Failed to close file", str->filename, g_strerror(errno) );
 			g_free(str->filename);
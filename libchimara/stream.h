@@ -21,6 +21,7 @@ struct glk_stream_struct
 	/*< private >*/
 	glui32 magic, rock;
 	gidispatch_rock_t disprock;
+	glui32 updatetag; /* identifies the stream in autosave files */
 	/* Pointer to the list node in the global stream list that contains this
 	stream */
 	GList* stream_list;
@@ -43,15 +44,24 @@ struct glk_stream_struct
 	glui32 buflen;
 	/* Specific to memory streams */
 	gidispatch_rock_t buffer_rock;
+	/* Specific to resource streams */
+	glui32 resource_number;
 	/* Specific to file streams */
 	FILE *file_pointer;
 	gchar *filename; /* Displayable filename in UTF-8 for error handling */
 	glui32 lastop; /* 0, filemode_Write, or filemode_Read */
+	GByteArray *write_buffer; /* Encoded output not yet handed to the writer thread */
+	unsigned pending_blocks; /* Blocks the writer thread hasn't written yet */
+	int write_error; /* errno of the first failed background write, or 0 */
 
 	gboolean hyperlink_mode; /* When turned on, text written to the stream will be a hyperlink */
 };
 
 G_GNUC_INTERNAL strid_t file_stream_new(frefid_t fileref, glui32 fmode, glui32 rock, gboolean unicode);
+G_GNUC_INTERNAL strid_t file_stream_reopen(const char *pathname, glui32 fmode, gboolean binary, gboolean unicode, long position, glui32 rock);
+G_GNUC_INTERNAL gchar *file_stream_begin_write(strid_t str, gsize maxlen);
+G_GNUC_INTERNAL void file_stream_end_write(strid_t str, const gchar *end);
+G_GNUC_INTERNAL void file_stream_sync(strid_t str);
 G_GNUC_INTERNAL strid_t stream_new_common(glui32 rock);
 G_GNUC_INTERNAL void stream_close_common(strid_t str, stream_result_t *result);
 
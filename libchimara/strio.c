@@ -5,17 +5,23 @@
 #include <gtk/gtk.h>
 
 #include "charset.h"
+#include "chimara-glk-private.h"
 #include "magic.h"
 #include "stream.h"
 #include "ui-message.h"
 #include "window.h"
 
+extern GPrivate glk_data_key;
+
 /* Internal function: ensure that an fseek() is called on a file pointer in
  between reading and writing operations, and vice versa. This will only come up
- for ReadWrite or WriteAppend files. */
+ for ReadWrite or WriteAppend files. Before reading, also make sure any
+ buffered output has been written. */
 static void
 ensure_file_operation(strid_t str, glui32 op)
 {
+	if(op == filemode_Read && str->lastop == filemode_Write)
+		file_stream_sync(str);
 	if(str->lastop != 0 && str->lastop != op)
 	{
 		long pos = ftell(str->file_pointer);
@@ -47,10 +53,21 @@ write_utf8_to_window_buffer(winid_t win, gchar *s)
 	g_string_append(win->buffer, s);
 }
 
-/* Internal function: flush a window's text buffer to the screen. */
+/* Internal function: flush a window's text buffer to the screen, or send a
+graphics window's pending drawing operations to the UI thread. */
 static UiMessage *
 flush_window_buffer_internal(winid_t win)
 {
+	if(win->type == wintype_Graphics) {
+		if(win->graphics_batch == NULL)
+			return NULL;
+
+		UiMessage *msg = ui_message_new(UI_MESSAGE_GRAPHICS_BATCH, win);
+		msg->ptrval = win->graphics_batch;
+		win->graphics_batch = NULL;
+		return msg;
+	}
+
 	g_debug("%s", win->buffer->str);
 
 	if(win->type != wintype_TextBuffer && win->type != wintype_TextGrid)
@@ -59,6 +76,9 @@ flush_window_buffer_internal(winid_t win)
 	if(win->buffer->len == 0)
 		return NULL;
 
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	metrics_histogram_add(&glk_data->metrics.flush_bytes, win->buffer->len);
+
 	UiMessage *msg = ui_message_new(UI_MESSAGE_PRINT_STRING, win);
 	msg->strval = g_strdup(win->buffer->str);
 	g_string_truncate(win->buffer, 0);
@@ -88,6 +108,15 @@ flush_window_buffer(winid_t win)
 		ui_message_queue_and_await(msg);
 }
 
+/* Internal function: return the number of characters left between the mark of
+memory stream @str and the end of its buffer. The mark can be past the end of
+the buffer after glk_stream_set_position(), so don't just subtract. */
+static glui32
+memory_stream_space(strid_t str)
+{
+	return (str->mark < str->buflen)? str->buflen - str->mark : 0;
+}
+
 /* Internal function: write a Latin-1 buffer with length to a stream. */
 static void
 write_buffer_to_stream(strid_t str, gchar *buf, glui32 len)
@@ -154,13 +183,13 @@ write_buffer_to_stream(strid_t str, gchar *buf, glui32 len)
 		case STREAM_TYPE_MEMORY:
 			if(str->unicode && str->ubuffer)
 			{
-				int foo = 0;
-				while(str->mark < str->buflen && foo < len)
-					str->ubuffer[str->mark++] = (unsigned char)buf[foo++];
+				glui32 copycount = MIN(len, memory_stream_space(str));
+				convert_latin1_to_ucs4_buffer(buf, copycount, str->ubuffer + str->mark);
+				str->mark += copycount;
 			}
 			if(!str->unicode && str->buffer)
 			{
-				int copycount = MIN(len, str->buflen - str->mark);
+				glui32 copycount = MIN(len, memory_stream_space(str));
 				memmove(str->buffer + str->mark, buf, copycount);
 				str->mark += copycount;
 			}
@@ -173,33 +202,29 @@ write_buffer_to_stream(strid_t str, gchar *buf, glui32 len)
 			break;
 			
 		case STREAM_TYPE_FILE:
-			if(str->binary) 
+		{
+			ensure_file_operation(str, filemode_Write);
+			gchar *out;
+			if(str->binary && str->unicode)
 			{
-				if(str->unicode) 
-				{
-					gchar *writebuffer = convert_latin1_to_ucs4be_string(buf, len);
-					ensure_file_operation(str, filemode_Write);
-					fwrite(writebuffer, sizeof(gchar), len * 4, str->file_pointer);
-					g_free(writebuffer);
-				} 
-				else /* Regular file */
-				{
-					ensure_file_operation(str, filemode_Write);
-					fwrite(buf, sizeof(gchar), len, str->file_pointer);
-				}
+				out = file_stream_begin_write(str, len * 4);
+				out += convert_latin1_to_ucs4be_buffer(buf, len, out);
+			}
+			else if(str->binary) /* Regular file */
+			{
+				out = file_stream_begin_write(str, len);
+				memcpy(out, buf, len);
+				out += len;
 			}
 			else /* Text mode is the same for Unicode and regular files */
 			{
-				gchar *utf8 = convert_latin1_to_utf8(buf, len);
-				if(utf8 != NULL)
-				{
-					ensure_file_operation(str, filemode_Write);
-					g_fprintf(str->file_pointer, "%s", utf8);
-					g_free(utf8);
-				}
+				out = file_stream_begin_write(str, len * 2);
+				out += convert_latin1_to_utf8_buffer(buf, len, out);
 			}
-			
+			file_stream_end_write(str, out);
+
 			str->write_count += len;
+		}
 			break;
 		case STREAM_TYPE_RESOURCE:
 			ILLEGAL("Writing to a resource stream is illegal.");
@@ -251,16 +276,15 @@ write_buffer_to_stream_uni(strid_t str, glui32 *buf, glui32 len)
 		case STREAM_TYPE_MEMORY:
 			if(str->unicode && str->ubuffer)
 			{
-				int copycount = MIN(len, str->buflen - str->mark);
+				glui32 copycount = MIN(len, memory_stream_space(str));
 				memmove(str->ubuffer + str->mark, buf, copycount * sizeof(glui32));
 				str->mark += copycount;
 			}
 			if(!str->unicode && str->buffer)
 			{
-				gchar *latin1 = convert_ucs4_to_latin1_binary(buf, len);
-				int copycount = MIN(len, str->buflen - str->mark);
-				memmove(str->buffer + str->mark, latin1, copycount);
-				g_free(latin1);
+				/* Only convert as much as fits, straight into the stream's buffer */
+				glui32 copycount = MIN(len, memory_stream_space(str));
+				convert_ucs4_to_latin1_binary_buffer(buf, copycount, str->buffer + str->mark);
 				str->mark += copycount;
 			}
 
@@ -272,35 +296,28 @@ write_buffer_to_stream_uni(strid_t str, glui32 *buf, glui32 len)
 			break;
 			
 		case STREAM_TYPE_FILE:
-			if(str->binary) 
+		{
+			ensure_file_operation(str, filemode_Write);
+			gchar *out;
+			if(str->binary && str->unicode)
 			{
-				if(str->unicode) 
-				{
-					gchar *writebuffer = convert_ucs4_to_ucs4be_string(buf, len);
-					ensure_file_operation(str, filemode_Write);
-					fwrite(writebuffer, sizeof(gchar), len * 4, str->file_pointer);
-					g_free(writebuffer);
-				} 
-				else /* Regular file */
-				{
-					gchar *latin1 = convert_ucs4_to_latin1_binary(buf, len);
-					ensure_file_operation(str, filemode_Write);
-					fwrite(latin1, sizeof(gchar), len, str->file_pointer);
-					g_free(latin1);
-				}
+				out = file_stream_begin_write(str, len * 4);
+				out += convert_ucs4_to_ucs4be_buffer(buf, len, out);
+			}
+			else if(str->binary) /* Regular file */
+			{
+				out = file_stream_begin_write(str, len);
+				out += convert_ucs4_to_latin1_binary_buffer(buf, len, out);
 			}
 			else /* Text mode is the same for Unicode and regular files */
 			{
-				gchar *utf8 = convert_ucs4_to_utf8(buf, len);
-				if(utf8 != NULL) 
-				{
-					ensure_file_operation(str, filemode_Write);
-					g_fprintf(str->file_pointer, "%s", utf8);
-					g_free(utf8);
-				}
+				out = file_stream_begin_write(str, len * 4);
+				out += convert_ucs4_to_utf8_buffer(buf, len, out);
 			}
-			
+			file_stream_end_write(str, out);
+
 			str->write_count += len;
+		}
 			break;
 		case STREAM_TYPE_RESOURCE:
 			ILLEGAL("Writing to a resource stream is illegal.");
@@ -492,7 +509,7 @@ read_utf8_char_from_buffer(strid_t str)
 	size_t foo;
 	gunichar charresult = (gunichar)-2;
 	char *buffer = str->buffer + str->mark;
-	size_t maxlen = str->buflen - str->mark;
+	size_t maxlen = memory_stream_space(str);
 
 	if(maxlen == 0)
 		return -1;
@@ -733,16 +750,17 @@ glk_get_buffer_stream(strid_t str, char *buf, glui32 len)
 			int copycount = 0;
 			if(str->unicode)
 			{
-				while(copycount < len && str->ubuffer && str->mark < str->buflen) 
+				if(str->ubuffer) /* if not, copycount stays 0 */
 				{
-					glui32 ch = str->ubuffer[str->mark++];
-					buf[copycount++] = (ch > 0xFF)? '?' : (char)ch;
+					copycount = MIN(len, memory_stream_space(str));
+					convert_ucs4_to_latin1_binary_buffer(str->ubuffer + str->mark, copycount, buf);
+					str->mark += copycount;
 				}
 			}
 			else
 			{
 				if(str->buffer) /* if not, copycount stays 0 */
-					copycount = MIN(len, str->buflen - str->mark);
+					copycount = MIN(len, memory_stream_space(str));
 				memmove(buf, str->buffer + str->mark, copycount);
 				str->mark += copycount;
 			}
@@ -851,16 +869,17 @@ glk_get_buffer_stream_uni(strid_t str, glui32 *buf, glui32 len)
 			if(str->unicode)
 			{
 				if(str->ubuffer) /* if not, copycount stays 0 */
-					copycount = MIN(len, str->buflen - str->mark);
+					copycount = MIN(len, memory_stream_space(str));
 				memmove(buf, str->ubuffer + str->mark, copycount * 4);
 				str->mark += copycount;
 			}
 			else
 			{
-				while(copycount < len && str->buffer && str->mark < str->buflen)
+				if(str->buffer) /* if not, copycount stays 0 */
 				{
-					unsigned char ch = str->buffer[str->mark++];
-					buf[copycount++] = ch;
+					copycount = MIN(len, memory_stream_space(str));
+					convert_latin1_to_ucs4_buffer(str->buffer + str->mark, copycount, buf);
+					str->mark += copycount;
 				}
 			}
 
@@ -1014,7 +1033,7 @@ glk_get_line_stream(strid_t str, char *buf, glui32 len)
 			else
 			{
 				if(str->buffer) /* if not, copycount stays 0 */
-					copycount = MIN(len - 1, str->buflen - str->mark);
+					copycount = MIN(len - 1, memory_stream_space(str));
 				char *endptr = memccpy(buf, str->buffer + str->mark, '\n', copycount);
 				if(endptr) /* newline was found */
 					copycount = endptr - buf; /* Real copy count */
@@ -1323,6 +1342,7 @@ glk_stream_get_position(strid_t str)
 		case STREAM_TYPE_RESOURCE:
 			return str->mark;
 		case STREAM_TYPE_FILE:
+			file_stream_sync(str);
 			return ftell(str->file_pointer);
 		case STREAM_TYPE_WINDOW:
 			return 0;
@@ -1395,6 +1415,7 @@ glk_stream_set_position(strid_t str, glsi32 pos, glui32 seekmode)
 					g_return_if_reached();
 					return;
 			}
+			file_stream_sync(str);
 			if(fseek(str->file_pointer, pos, whence) == -1)
 				WARNING("Seek failed on file stream");
 			str->lastop = 0; /* Either reading or writing is legal after fseek() */
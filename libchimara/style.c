@@ -336,6 +336,35 @@ style_accept_style_hint(GScanner *scanner, GtkTextTag *current_tag)
 	return TRUE;
 }
 
+/* Internal function: forgets all results of glk_style_measure(), because the
+ * styles have changed. Call from the Glk thread. */
+static void
+invalidate_style_measure_cache(void)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	memset(glk_data->style_measure_valid, 0, sizeof(glk_data->style_measure_valid));
+}
+
+/* Internal function: remembers a style hint that the Glk program set or
+ * cleared, so that it can be autosaved. */
+static void
+record_stylehint(glui32 wintype, glui32 styl, glui32 hint, glsi32 val, gboolean set)
+{
+	if(styl >= style_NUMSTYLES || hint >= stylehint_NUMHINTS)
+		return;
+
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	for(int index = 0; index < 2; index++) {
+		if(wintype != wintype_AllTypes && wintype != (index == 0? wintype_TextBuffer : wintype_TextGrid))
+			continue;
+		glk_data->stylehints[index][styl][hint] = val;
+		if(set)
+			glk_data->stylehints_set[index][styl] |= 1 << hint;
+		else
+			glk_data->stylehints_set[index][styl] &= ~(1 << hint);
+	}
+}
+
 /**
  * glk_stylehint_set:
  * @wintype: The window type to set a style hint on, or %wintype_AllTypes.
@@ -365,6 +394,8 @@ glk_stylehint_set(glui32 wintype, glui32 styl, glui32 hint, glsi32 val)
 	msg->uintval3 = hint;
 	msg->intval = val;
 	ui_message_queue(msg);
+	invalidate_style_measure_cache();
+	record_stylehint(wintype, styl, hint, val, TRUE);
 }
 
 /**
@@ -394,6 +425,8 @@ glk_stylehint_clear(glui32 wintype, glui32 styl, glui32 hint)
 	msg->uintval2 = styl;
 	msg->uintval3 = hint;
 	ui_message_queue(msg);
+	invalidate_style_measure_cache();
+	record_stylehint(wintype, styl, hint, 0, FALSE);
 }
 
 /**
@@ -501,10 +534,35 @@ glk_style_measure(winid_t win, glui32 styl, glui32 hint, glui32 *result)
 	spec where more CSS-like styling is implemented. See for more information:
 	http://ifwiki.org/index.php/New_Glk_styles */
 
-	UiMessage *msg = ui_message_new(UI_MESSAGE_MEASURE_STYLE, win);
-	msg->uintval1 = styl;
-	msg->uintval2 = hint;
-	gint64 response = ui_message_queue_and_await(msg);
+	if(win->type != wintype_TextBuffer && win->type != wintype_TextGrid)
+		return FALSE;
+
+	/* The result only depends on the window type, and only changes when the
+	styles do, so each one is asked of the UI thread once */
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	int generation = g_atomic_int_get(&glk_data->styles_generation);
+	if(glk_data->style_measure_generation != generation) {
+		invalidate_style_measure_cache();
+		glk_data->style_measure_generation = generation;
+	}
+
+	gboolean cacheable = styl < style_NUMSTYLES && hint < stylehint_NUMHINTS;
+	int index = win->type == wintype_TextBuffer? 0 : 1;
+	gint64 response;
+	if(cacheable && (glk_data->style_measure_valid[index][styl] & (1 << hint))) {
+		response = glk_data->style_measure_cache[index][styl][hint];
+	} else {
+		UiMessage *msg = ui_message_new(UI_MESSAGE_MEASURE_STYLE, win);
+		msg->uintval1 = styl;
+		msg->uintval2 = hint;
+		response = ui_message_queue_and_await(msg);
+
+		if(cacheable) {
+			glk_data->style_measure_cache[index][styl][hint] = response;
+			glk_data->style_measure_valid[index][styl] |= 1 << hint;
+		}
+	}
+
 	if(response & ((gint64)1 << 32))
 		return FALSE;
 	if(result)
@@ -65,6 +65,7 @@ glk_request_timer_events(glui32 millisecs)
 		g_source_remove(glk_data->timer_id);
 		glk_data->timer_id = 0;
 	}
+	glk_data->timer_interval = millisecs;
 
 	if(millisecs == 0)
 		return;
@@ -0,0 +1,30 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "config.h"
+
+/* Static tracepoints under the provider name "chimara", which can be attached
+ to with bpftrace, perf, or SystemTap. When not traced, each one costs a single
+ nop instruction. See tests/dtrace/readme.txt for the list of probes. */
+
+#if HAVE_SDT
+
+#include <sys/sdt.h>
+
+#define TRACE(name) DTRACE_PROBE(chimara, name)
+#define TRACE1(name, a1) DTRACE_PROBE1(chimara, name, a1)
+#define TRACE2(name, a1, a2) DTRACE_PROBE2(chimara, name, a1, a2)
+#define TRACE3(name, a1, a2, a3) DTRACE_PROBE3(chimara, name, a1, a2, a3)
+#define TRACE4(name, a1, a2, a3, a4) DTRACE_PROBE4(chimara, name, a1, a2, a3, a4)
+
+#else
+
+#define TRACE(name)
+#define TRACE1(name, a1)
+#define TRACE2(name, a1, a2)
+#define TRACE3(name, a1, a2, a3)
+#define TRACE4(name, a1, a2, a3, a4)
+
+#endif /* HAVE_SDT */
+
+#endif /* TRACE_H */
@@ -2,6 +2,7 @@
 
 #include <string.h>
 
+#include <gio/gio.h>
 #include <glib/gi18n-lib.h>
 #include <gtk/gtk.h>
 
@@ -16,6 +17,151 @@
 #include "ui-window.h"
 #include "window.h"
 
+/* Text buffers are allowed to grow this fraction past the scrollback limit
+before the excess is archived, so that archiving is not done on every print */
+#define SCROLLBACK_SLACK_DIVISOR 8
+/* How close to the top of the window the user must scroll to page in text */
+#define SCROLLBACK_FUZZINESS 1.0
+
+/* Text that has scrolled out of a text buffer window's scrollback limit. It is
+ * kept in GTK's rich text serialization format, so styles survive, and
+ * compressed. It is attached to the GtkTextBuffer so that it is only ever
+ * touched and freed in the UI thread. */
+typedef struct {
+	GQueue *chunks;  /* type: GBytes, oldest first */
+	GdkAtom serialize_format;
+	GdkAtom deserialize_format;
+	/* Set while archived text is paged in, until the user is back at the end */
+	gboolean browsing;
+} ScrollbackArchive;
+
+static void
+scrollback_archive_free(ScrollbackArchive *archive)
+{
+	g_queue_free_full(archive->chunks, (GDestroyNotify)g_bytes_unref);
+	g_slice_free(ScrollbackArchive, archive);
+}
+
+static ScrollbackArchive *
+get_scrollback_archive(GtkTextBuffer *buffer)
+{
+	ScrollbackArchive *archive = g_object_get_data(G_OBJECT(buffer), "chimara-scrollback-archive");
+	if (archive != NULL)
+		return archive;
+
+	archive = g_slice_new0(ScrollbackArchive);
+	archive->chunks = g_queue_new();
+	archive->serialize_format = gtk_text_buffer_register_serialize_tagset(buffer, NULL);
+	archive->deserialize_format = gtk_text_buffer_register_deserialize_tagset(buffer, NULL);
+	gtk_text_buffer_deserialize_set_can_create_tags(buffer, archive->deserialize_format, TRUE);
+	g_object_set_data_full(G_OBJECT(buffer), "chimara-scrollback-archive", archive,
+		(GDestroyNotify)scrollback_archive_free);
+	return archive;
+}
+
+/* Helper function: run @data through @converter, returning the result or NULL
+ * on error. */
+static GBytes *
+convert_bytes(GConverter *converter, const void *data, size_t len)
+{
+	g_autoptr(GOutputStream) mem = g_memory_output_stream_new_resizable();
+	g_autoptr(GOutputStream) out = g_converter_output_stream_new(mem, converter);
+	g_autoptr(GError) error = NULL;
+
+	if (!g_output_stream_write_all(out, data, len, NULL, NULL, &error) ||
+		!g_output_stream_close(out, NULL, &error)) {
+		WARNING_S("Error converting scrollback", error->message);
+		return NULL;
+	}
+	return g_memory_output_stream_steal_as_bytes(G_MEMORY_OUTPUT_STREAM(mem));
+}
+
+/* Internal function: if @buffer has grown past the scrollback limit, move the
+ * oldest lines into the archive. */
+static void
+trim_scrollback(ChimaraGlk *glk, GtkTextBuffer *buffer)
+{
+	unsigned limit = chimara_glk_get_scrollback_lines(glk);
+	if (limit == 0)
+		return;
+	int lines = gtk_text_buffer_get_line_count(buffer);
+	if ((unsigned)lines <= limit + limit / SCROLLBACK_SLACK_DIVISOR)
+		return;
+
+	ScrollbackArchive *archive = get_scrollback_archive(buffer);
+	if (archive->browsing)
+		return;
+
+	GtkTextIter start, end;
+	gtk_text_buffer_get_start_iter(buffer, &start);
+	gtk_text_buffer_get_iter_at_line(buffer, &end, lines - limit);
+
+	/* Never archive text the user has not read yet */
+	if (chimara_glk_get_interactive(glk)) {
+		GtkTextIter pager;
+		gtk_text_buffer_get_iter_at_mark(buffer, &pager, gtk_text_buffer_get_mark(buffer, "pager_position"));
+		if (gtk_text_iter_compare(&pager, &end) < 0) {
+			end = pager;
+			gtk_text_iter_set_line_offset(&end, 0);
+		}
+	}
+	if (gtk_text_iter_equal(&start, &end))
+		return;
+
+	size_t len;
+	g_autofree guint8 *data = gtk_text_buffer_serialize(buffer, buffer, archive->serialize_format, &start, &end, &len);
+	g_autoptr(GZlibCompressor) compressor = g_zlib_compressor_new(G_ZLIB_COMPRESSOR_FORMAT_RAW, -1);
+	GBytes *chunk = convert_bytes(G_CONVERTER(compressor), data, len);
+	if (chunk != NULL)
+		g_queue_push_tail(archive->chunks, chunk);
+
+	gtk_text_buffer_delete(buffer, &start, &end);
+}
+
+/* Internal function: Callback for signal value-changed on a text buffer
+ * window's vertical adjustment. Pages the most recently archived text back in
+ * when the user scrolls to the top. */
+static void
+after_scrollback_adjustment_changed(GtkAdjustment *adj, winid_t win)
+{
+	GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(win->widget));
+	ScrollbackArchive *archive = g_object_get_data(G_OBJECT(buffer), "chimara-scrollback-archive");
+	if (archive == NULL)
+		return;
+
+	double value = gtk_adjustment_get_value(adj);
+	if (value + SCROLLBACK_FUZZINESS >= gtk_adjustment_get_upper(adj) - gtk_adjustment_get_page_size(adj)) {
+		archive->browsing = FALSE;
+		return;
+	}
+	if (value > gtk_adjustment_get_lower(adj) + SCROLLBACK_FUZZINESS || g_queue_is_empty(archive->chunks))
+		return;
+
+	g_autoptr(GBytes) chunk = g_queue_pop_tail(archive->chunks);
+	g_autoptr(GZlibDecompressor) decompressor = g_zlib_decompressor_new(G_ZLIB_COMPRESSOR_FORMAT_RAW);
+	size_t compressed_len;
+	const void *compressed = g_bytes_get_data(chunk, &compressed_len);
+	g_autoptr(GBytes) data = convert_bytes(G_CONVERTER(decompressor), compressed, compressed_len);
+	if (data == NULL)
+		return;
+
+	archive->browsing = TRUE;
+
+	/* Keep the text that was at the top of the window in view */
+	GtkTextIter start;
+	gtk_text_buffer_get_start_iter(buffer, &start);
+	GtkTextMark *old_start = gtk_text_buffer_create_mark(buffer, NULL, &start, FALSE);
+
+	size_t len;
+	const guint8 *text = g_bytes_get_data(data, &len);
+	g_autoptr(GError) error = NULL;
+	if (!gtk_text_buffer_deserialize(buffer, buffer, archive->deserialize_format, &start, text, len, &error))
+		WARNING_S("Error restoring scrollback", error->message);
+
+	gtk_text_view_scroll_to_mark(GTK_TEXT_VIEW(win->widget), old_start, 0.0, TRUE, 0.0, 0.0);
+	gtk_text_buffer_delete_mark(buffer, old_start);
+}
+
 /* Internal function: Callback for signal key-press-event on a text buffer
  * window. Used in character input. Blocked when not in use. */
 static gboolean
@@ -240,6 +386,7 @@ ui_buffer_create(winid_t win, ChimaraGlk *glk)
 	win->pager_keypress_handler = g_signal_connect( win->widget, "key-press-event", G_CALLBACK(pager_on_key_press_event), win );
 	g_signal_handler_block(win->widget, win->pager_keypress_handler);
 	win->pager_adjustment_handler = g_signal_connect_after(win->vadjustment, "value-changed", G_CALLBACK(pager_after_adjustment_changed), win);
+	win->scrollback_adjustment_handler = g_signal_connect_after(win->vadjustment, "value-changed", G_CALLBACK(after_scrollback_adjustment_changed), win);
 	g_signal_connect(win->pager, "clicked", G_CALLBACK(pager_on_clicked), win);
 
 	/* Char and line input */
@@ -285,6 +432,7 @@ ui_buffer_print_string(winid_t win, const char *text)
 
 	ChimaraGlk *glk = CHIMARA_GLK(gtk_widget_get_ancestor(win->widget, CHIMARA_TYPE_GLK));
 	g_assert(glk);
+	trim_scrollback(glk, buffer);
 	g_signal_emit_by_name(glk, "text-buffer-output", win->rock, win->librock, text);
 }
 
@@ -297,6 +445,9 @@ ui_buffer_clear(winid_t win)
 	GtkTextIter start, end;
 	gtk_text_buffer_get_bounds(screen, &start, &end);
 	gtk_text_buffer_delete(screen, &start, &end);
+
+	/* Archived text is cleared along with the rest */
+	g_object_set_data(G_OBJECT(screen), "chimara-scrollback-archive", NULL);
 }
 
 /* Request either latin-1 or unicode line input, in a text buffer window @win. */
@@ -5,6 +5,7 @@
 #include "chimara-glk-private.h"
 #include "event.h"
 #include "glk.h"
+#include "graphics.h"
 #include "ui-window.h"
 #include "window.h"
 
@@ -105,17 +106,22 @@ ui_graphics_create(winid_t win)
 	g_signal_connect(win->widget, "draw", G_CALLBACK(on_graphics_draw), win);
 }
 
-/* Draws a rectangle of color @color at coordinates @x, @y, with the given
- * @width and @height, on the graphics window @win. */
-void
-ui_graphics_fill_rect(winid_t win, unsigned color, int left, int top, unsigned width, unsigned height)
+/* Internal function: adds the part of the rectangle at @x, @y with the given
+ * @width and @height that lies within the backing store of @win to @damage. */
+static void
+add_damage(winid_t win, cairo_region_t *damage, int64_t x, int64_t y, int64_t width, int64_t height)
 {
-	cairo_t *cr = cairo_create(win->backing_store);
-	glkcairo_set_source_glkcolor(cr, color);
-	cairo_rectangle(cr, (double)left, (double)top, (double)width, (double)height);
-	cairo_fill(cr);
-	gtk_widget_queue_draw(win->widget);
-	cairo_destroy(cr);
+	int64_t surface_width = cairo_image_surface_get_width(win->backing_store);
+	int64_t surface_height = cairo_image_surface_get_height(win->backing_store);
+	int64_t left = CLAMP(x, 0, surface_width);
+	int64_t top = CLAMP(y, 0, surface_height);
+	int64_t right = CLAMP(x + width, 0, surface_width);
+	int64_t bottom = CLAMP(y + height, 0, surface_height);
+	if(right <= left || bottom <= top)
+		return;
+
+	cairo_rectangle_int_t rect = { left, top, right - left, bottom - top };
+	cairo_region_union_rectangle(damage, &rect);
 }
 
 /* Clears the graphics window @win.
@@ -123,22 +129,57 @@ ui_graphics_fill_rect(winid_t win, unsigned color, int left, int top, unsigned w
 void
 ui_graphics_clear(winid_t win)
 {
-	GtkAllocation allocation;
-	gtk_widget_get_allocation(win->widget, &allocation);
-	ui_graphics_fill_rect(win, win->background_color, 0, 0, allocation.width, allocation.height);
+	/* No backing store until the window is realized, which never happens in
+	 headless mode */
+	if(win->backing_store == NULL)
+		return;
+
+	cairo_t *cr = cairo_create(win->backing_store);
+	glkcairo_set_source_glkcolor(cr, win->background_color);
+	cairo_paint(cr);
+	cairo_destroy(cr);
+	gtk_widget_queue_draw(win->widget);
 }
 
-/* Draws an image, stored in @pixbuf, at coordinates @x, @y, on the graphics
- * window @win.
- * Called as a result of glk_image_draw(). */
+/* Performs the drawing operations in @ops, an array of struct graphics_op, on
+ * the backing store of the graphics window @win, in order. Only the parts of
+ * the window that were drawn on are redrawn on the screen.
+ * Called as a result of glk_window_fill_rect(), glk_window_erase_rect(),
+ * glk_image_draw(), and glk_image_draw_scaled(), when the window is flushed. */
 void
-ui_graphics_draw_image(winid_t win, GdkPixbuf *pixbuf, unsigned x, unsigned y)
+ui_graphics_draw_batch(winid_t win, GArray *ops)
 {
+	if(win->backing_store == NULL)
+		return;
+
 	cairo_t *cr = cairo_create(win->backing_store);
-	gdk_cairo_set_source_pixbuf(cr, pixbuf, x, y);
-	cairo_paint(cr);
+	cairo_region_t *damage = cairo_region_create();
+
+	for(unsigned count = 0; count < ops->len; count++) {
+		struct graphics_op *op = &g_array_index(ops, struct graphics_op, count);
+		switch(op->type) {
+		case GRAPHICS_OP_FILL_RECT:
+			glkcairo_set_source_glkcolor(cr, op->color);
+			cairo_rectangle(cr, (double)op->x, (double)op->y, (double)op->width, (double)op->height);
+			cairo_fill(cr);
+			add_damage(win, damage, op->x, op->y, op->width, op->height);
+			break;
+		case GRAPHICS_OP_DRAW_IMAGE:
+		{
+			int width = gdk_pixbuf_get_width(op->pixbuf);
+			int height = gdk_pixbuf_get_height(op->pixbuf);
+			gdk_cairo_set_source_pixbuf(cr, op->pixbuf, op->x, op->y);
+			cairo_rectangle(cr, (double)op->x, (double)op->y, (double)width, (double)height);
+			cairo_fill(cr);
+			add_damage(win, damage, op->x, op->y, width, height);
+		}
+			break;
+		}
+	}
+
 	cairo_destroy(cr);
 
 	/* Update the screen */
-	gtk_widget_queue_draw(win->widget);
+	gtk_widget_queue_draw_region(win->widget, damage);
+	cairo_region_destroy(damage);
 }
@@ -83,17 +83,50 @@ ui_grid_create(winid_t win, ChimaraGlk *glk)
 	g_signal_handler_block(win->widget, win->button_press_event_handler);
 }
 
-/* Prints @text at the current cursor position in the text grid */
+/* Reallocates the shadow copy of the grid's contents for a grid of @columns by
+ * @rows characters. All cells are marked as needing to be redrawn, since the
+ * buffer's contents are rearranged when the window is resized. */
+void
+ui_grid_resize_cells(winid_t win, glui32 columns, glui32 rows)
+{
+	size_t ncells = (size_t)columns * rows;
+	win->grid_chars = g_renew(gunichar, win->grid_chars, ncells);
+	win->grid_tags = g_renew(GtkTextTag *, win->grid_tags, ncells);
+	memset(win->grid_tags, 0, ncells * sizeof(GtkTextTag *));
+	win->grid_columns = columns;
+	win->grid_rows = rows;
+}
+
+/* Internal function: marks @count cells starting at @row, @col as needing to
+ * be redrawn the next time something is printed over them. Used when the
+ * buffer is changed other than by printing, such as by line input. */
+static void
+invalidate_cells(winid_t win, int row, int col, int count)
+{
+	if(row < 0 || (glui32)row >= win->grid_rows || (glui32)col >= win->grid_columns)
+		return;
+	count = MIN((glui32)count, win->grid_columns - col);
+	memset(win->grid_tags + row * win->grid_columns + col, 0, count * sizeof(GtkTextTag *));
+}
+
+/* Prints @text at the current cursor position in the text grid.
+ * Each row is compared with the shadow copy of the grid, and only the span
+ * between the first and last cells that actually change is rewritten, so that
+ * redrawing a status line with mostly the same contents is cheap. */
 void
 ui_grid_print_string(winid_t win, const char *text)
 {
 	GtkTextBuffer *buffer = gtk_text_view_get_buffer( GTK_TEXT_VIEW(win->widget) );
 	GtkTextMark *cursor = gtk_text_buffer_get_mark(buffer, "cursor_position");
-	/* Number of characters to insert */
-	long length = strlen(text);
-	long chars_left = length;
 	GtkTextIter start, insert;
-	int start_offset;
+
+	glong length;
+	gunichar *chars = g_utf8_to_ucs4_fast(text, -1, &length);
+	glong chars_left = length;
+
+	/* Text printed as a hyperlink also carries the link's own tag, so it is
+	 * never considered to be the same as what is already there */
+	GtkTextTag *tag = win->window_stream->hyperlink_mode? NULL : ui_style_get_composite_tag(win);
 
 	/* Get cursor position */
 	gtk_text_buffer_get_iter_at_mark(buffer, &insert, cursor);
@@ -101,21 +134,53 @@ ui_grid_print_string(winid_t win, const char *text)
 	g_mutex_lock(&win->lock);
 
 	while(chars_left > 0 && !gtk_text_iter_is_end(&insert)) {
+		int row = gtk_text_iter_get_line(&insert);
+		int col = gtk_text_iter_get_line_offset(&insert);
+		const gunichar *segment = chars + (length - chars_left);
 		/* Spaces available on this line */
-		int available_space = win->width - gtk_text_iter_get_line_offset(&insert);
-
-		GtkTextIter end = insert;
-		if(chars_left <= available_space)
-			gtk_text_iter_forward_chars(&end, chars_left);
-		else
-			gtk_text_iter_forward_to_line_end(&end);
-
-		gtk_text_buffer_delete(buffer, &insert, &end);
+		int available_space = win->width - col;
+		int count = MAX(MIN(chars_left, available_space), 0);
+
+		gboolean shadowed = (glui32)row < win->grid_rows && (glui32)(col + count) <= win->grid_columns;
+		gunichar *cell_chars = shadowed? win->grid_chars + row * win->grid_columns + col : NULL;
+		GtkTextTag **cell_tags = shadowed? win->grid_tags + row * win->grid_columns + col : NULL;
+
+		/* Find the span of cells that change */
+		int first = 0, last = count - 1;
+		if(shadowed && tag != NULL) {
+			while(first < count && cell_tags[first] == tag && cell_chars[first] == segment[first])
+				first++;
+			while(last > first && cell_tags[last] == tag && cell_chars[last] == segment[last])
+				last--;
+		}
 
-		start_offset = gtk_text_iter_get_offset(&insert);
-		gtk_text_buffer_insert(buffer, &insert, text + (length - chars_left), MIN(chars_left, available_space));
-		gtk_text_buffer_get_iter_at_offset(buffer, &start, start_offset);
-		ui_style_apply(win, &start, &insert);
+		if(first < count) {
+			GtkTextIter end;
+			gtk_text_iter_forward_chars(&insert, first);
+			end = insert;
+			if(chars_left <= available_space || last < count - 1)
+				gtk_text_iter_forward_chars(&end, last - first + 1);
+			else
+				gtk_text_iter_forward_to_line_end(&end);
+
+			gtk_text_buffer_delete(buffer, &insert, &end);
+
+			int start_offset = gtk_text_iter_get_offset(&insert);
+			g_autofree char *utf8 = g_ucs4_to_utf8(segment + first, last - first + 1, NULL, NULL, NULL);
+			gtk_text_buffer_insert(buffer, &insert, utf8, -1);
+			gtk_text_buffer_get_iter_at_offset(buffer, &start, start_offset);
+			ui_style_apply(win, &start, &insert);
+
+			if(shadowed) {
+				for(int ix = first; ix <= last; ix++) {
+					cell_chars[ix] = segment[ix];
+					cell_tags[ix] = tag;
+				}
+			}
+			gtk_text_iter_forward_chars(&insert, count - last - 1);
+		} else {
+			gtk_text_iter_forward_chars(&insert, count);
+		}
 
 		chars_left -= available_space;
 
@@ -125,6 +190,8 @@ ui_grid_print_string(winid_t win, const char *text)
 
 	g_mutex_unlock(&win->lock);
 
+	g_free(chars);
+
 	gtk_text_buffer_move_mark(buffer, cursor, &insert);
 }
 
@@ -134,6 +201,8 @@ ui_grid_print_string(winid_t win, const char *text)
 void
 ui_grid_clear(winid_t win)
 {
+	GtkTextTag *tag = win->window_stream->hyperlink_mode? NULL : ui_style_get_composite_tag(win);
+
 	/* Manually put newlines at the end of each row of characters in the buffer;
 	manual newlines make resizing the window's grid easier. */
 	g_mutex_lock(&win->lock);
@@ -143,6 +212,13 @@ ui_grid_clear(winid_t win)
 	for(count = 0; count < win->height; count++)
 		blanklines[count] = blanks;
 	blanklines[win->height] = NULL;
+
+	if(win->grid_columns != win->width || win->grid_rows != win->height)
+		ui_grid_resize_cells(win, win->width, win->height);
+	for(size_t cell = 0; cell < (size_t)win->grid_columns * win->grid_rows; cell++) {
+		win->grid_chars[cell] = ' ';
+		win->grid_tags[cell] = tag;
+	}
 	g_mutex_unlock(&win->lock);
 	char *text = g_strjoinv("\n", blanklines);
 	g_free(blanklines); /* not g_strfreev() */
@@ -220,6 +296,8 @@ ui_grid_finish_line_input(winid_t win, gboolean emit_signal)
 	gtk_text_buffer_delete(buffer, &start, &end);
 	win->input_anchor = NULL;
 
+	invalidate_cells(win, gtk_text_iter_get_line(&start), gtk_text_iter_get_line_offset(&start), win->input_length);
+
 	gchar *spaces = g_strnfill(win->input_length - g_utf8_strlen(text, -1), ' ');
 	gchar *text_to_insert = g_strconcat(text, spaces, NULL);
 	g_free(spaces);
@@ -331,6 +409,7 @@ ui_grid_request_line_event(winid_t win, unsigned maxlen, gboolean insert, const
 	}
 
 	/* Erase the text currently in the input field and replace it with a GtkEntry */
+	invalidate_cells(win, gtk_text_iter_get_line(&start_iter), cursorpos, win->input_length);
 	gtk_text_buffer_delete(buffer, &start_iter, &end_iter);
 	win->input_anchor = gtk_text_buffer_create_child_anchor(buffer, &start_iter);
 	win->input_entry = gtk_entry_new();
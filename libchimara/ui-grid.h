@@ -7,6 +7,7 @@
 #include "glk.h"
 
 G_GNUC_INTERNAL void ui_grid_create(winid_t win, ChimaraGlk *glk);
+G_GNUC_INTERNAL void ui_grid_resize_cells(winid_t win, glui32 columns, glui32 rows);
 G_GNUC_INTERNAL void ui_grid_print_string(winid_t win, const char *text);
 G_GNUC_INTERNAL void ui_grid_clear(winid_t win);
 G_GNUC_INTERNAL void ui_grid_move_cursor(winid_t win, unsigned xpos, unsigned ypos);
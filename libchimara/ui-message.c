@@ -3,7 +3,9 @@
 #include <gtk/gtk.h>
 
 #include "chimara-glk-private.h"
+#include "metrics.h"
 #include "strio.h"
+#include "trace.h"
 #include "ui-buffer.h"
 #include "ui-graphics.h"
 #include "ui-grid.h"
@@ -21,8 +23,6 @@ struct SyncArrangeCallbackData {
 	unsigned handler_id;
 };
 
-#ifdef DEBUG_MESSAGES
-
 static const char *desc[] = {
 	"print string",
 	"create window",
@@ -50,11 +50,20 @@ static const char *desc[] = {
 	"set hyperlink",
 	"request hyperlink input",
 	"cancel hyperlink input",
-	"graphics draw image",
-	"graphics fill rect",
+	"graphics batch",
 	"buffer draw image",
 	"shutdown"
 };
+G_STATIC_ASSERT(G_N_ELEMENTS(desc) == UI_MESSAGE_SHUTDOWN + 1);
+
+/* Returns a human-readable name for a message of @type. */
+const char *
+ui_message_type_name(UiMessageType type)
+{
+	return desc[type];
+}
+
+#ifdef DEBUG_MESSAGES
 
 static void
 debug_ui_message(UiMessage *msg, gboolean queueing)
@@ -114,12 +123,23 @@ ui_message_queue(UiMessage *msg)
 	else if (msg->type == UI_MESSAGE_CLEAR_WINDOW &&
 	    (msg->win->type == wintype_TextBuffer || msg->win->type == wintype_TextGrid))
 	    queue_flush_window_buffer(msg->win);
+	else if (msg->type == UI_MESSAGE_CLEAR_WINDOW && msg->win->type == wintype_Graphics)
+		/* Drawing that is about to be cleared away need not be done at all */
+		g_clear_pointer(&msg->win->graphics_batch, g_array_unref);
 
 #ifdef DEBUG_MESSAGES
 	debug_ui_message(msg, TRUE);
 #endif
 
 	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	g_atomic_int_inc(&glk_data->metrics.ui_messages[msg->type]);
+	TRACE3(ui__message__queue, msg, msg->type, msg->win);
+
+	/* Number each arrangement, so that ui_message_sync_arrange() can tell
+	whether the UI thread has caught up with it */
+	if (msg->type == UI_MESSAGE_ARRANGE || msg->type == UI_MESSAGE_ARRANGE_SILENTLY)
+		msg->uintval1 = ++glk_data->arranges_requested;
+
 	g_async_queue_push(glk_data->ui_message_queue, msg);
 }
 
@@ -132,6 +152,10 @@ queue_and_await_response(UiMessage *msg)
 	msg->response = NULL;
 	msg->is_waiting = true;
 
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	gint64 start_time = g_get_monotonic_time();
+	TRACE2(ui__message__await__begin, msg, msg->type);
+
 	ui_message_queue(msg);
 
 	g_mutex_lock(&msg->lock);
@@ -139,6 +163,10 @@ queue_and_await_response(UiMessage *msg)
 		g_cond_wait(&msg->sign, &msg->lock);
 	g_mutex_unlock(&msg->lock);
 
+	TRACE2(ui__message__await__end, msg, msg->type);
+
+	metrics_histogram_add(&glk_data->metrics.ui_round_trip_usec, g_get_monotonic_time() - start_time);
+
 	g_mutex_clear(&msg->lock);
 	g_cond_clear(&msg->sign);
 }
@@ -156,7 +184,7 @@ gint64
 ui_message_queue_and_await(UiMessage *msg)
 {
 	queue_and_await_response(msg);
-	int retval = g_variant_get_int64(msg->response);
+	gint64 retval = g_variant_get_int64(msg->response);
 	ui_message_free(msg);
 	return retval;
 }
@@ -178,6 +206,20 @@ ui_message_queue_and_await_string(UiMessage *msg)
 	return retval;
 }
 
+/* Waits until the UI thread has carried out all the window arrangements that
+ * the Glk thread has asked for, so that the window sizes are current.
+ * If it already has, this returns right away without a round trip to the UI
+ * thread.
+ * This function must be called from the Glk thread. */
+void
+ui_message_sync_arrange(void)
+{
+	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
+	if ((unsigned)g_atomic_int_get(&glk_data->arranges_completed) == glk_data->arranges_requested)
+		return;
+	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+}
+
 /* Sends an answer back to the Glk thread in response to @msg, in the form of a
  * 64-bit signed integer @response.
  * (See ui_message_queue_and_await().)
@@ -239,6 +281,9 @@ ui_message_perform(ChimaraGlk *glk, UiMessage *msg)
 	 * this function. Otherwise, the other thread will free it after the
 	 * response has been received. */
 	bool should_free = !msg->is_waiting;
+	/* The message may not be accessed anymore once a response is sent */
+	UiMessageType type = msg->type;
+	TRACE3(ui__message__perform, msg, type, msg->win);
 
 	switch(msg->type) {
 	case UI_MESSAGE_PRINT_STRING:
@@ -253,10 +298,10 @@ ui_message_perform(ChimaraGlk *glk, UiMessage *msg)
 		gtk_widget_unparent(GTK_WIDGET(msg->ptrval));
 		break;
 	case UI_MESSAGE_ARRANGE:
-		chimara_glk_queue_arrange(glk, FALSE);
+		chimara_glk_queue_arrange(glk, FALSE, msg->uintval1);
 		break;
 	case UI_MESSAGE_ARRANGE_SILENTLY:
-		chimara_glk_queue_arrange(glk, TRUE);
+		chimara_glk_queue_arrange(glk, TRUE, msg->uintval1);
 		break;
 	case UI_MESSAGE_SYNC_ARRANGE:
 		if (!chimara_glk_needs_rearrange(glk)) {
@@ -330,11 +375,10 @@ ui_message_perform(ChimaraGlk *glk, UiMessage *msg)
 	case UI_MESSAGE_CANCEL_HYPERLINK_INPUT:
 		ui_textwin_cancel_hyperlink_input(msg->win);
 		break;
-	case UI_MESSAGE_GRAPHICS_DRAW_IMAGE:
-		ui_graphics_draw_image(msg->win, GDK_PIXBUF(msg->ptrval), msg->x, msg->y);
-		break;
-	case UI_MESSAGE_GRAPHICS_FILL_RECT:
-		ui_graphics_fill_rect(msg->win, msg->uintval1, msg->x, msg->y, msg->uintval2, msg->uintval3);
+	case UI_MESSAGE_GRAPHICS_BATCH:
+		ui_graphics_draw_batch(msg->win, msg->ptrval);
+		g_array_unref(msg->ptrval);
+		ui_message_respond(msg, 1);
 		break;
 	case UI_MESSAGE_BUFFER_DRAW_IMAGE:
 		ui_buffer_draw_image(msg->win, GDK_PIXBUF(msg->ptrval), msg->uintval1);
@@ -345,6 +389,8 @@ ui_message_perform(ChimaraGlk *glk, UiMessage *msg)
 		break;
 	}
 
+	TRACE2(ui__message__perform__done, msg, type);
+
 	if (should_free)
 		ui_message_free(msg);
 }
@@ -25,15 +25,19 @@ typedef enum {
 	UI_MESSAGE_UNPARENT_WIDGET,
 	/* ARRANGE: Calls for a rearrange of all windows.
 	 * @win: ignored.
+	 * @uintval1: number of the arrangement, filled in by ui_message_queue().
 	 */
 	UI_MESSAGE_ARRANGE,
 	/* ARRANGE_SILENTLY: Same as ARRANGE but does not send the Glk program an
 	 * arrange event.
 	 * @win: ignored.
+	 * @uintval1: number of the arrangement, filled in by ui_message_queue().
 	 */
 	UI_MESSAGE_ARRANGE_SILENTLY,
 	/* SYNC_ARRANGE: Waits for the window arrangement to become current.
 	 * It only makes sense to send this message with ui_message_queue_and_await.
+	 * Use ui_message_sync_arrange() instead, which skips the message if the
+	 * arrangement is already current.
 	 * @win: ignored.
 	 */
 	UI_MESSAGE_SYNC_ARRANGE,
@@ -146,22 +150,12 @@ typedef enum {
 	 * @win: text buffer or text grid window.
 	 */
 	UI_MESSAGE_CANCEL_HYPERLINK_INPUT,
-	/* GRAPHICS_DRAW_IMAGE:
+	/* GRAPHICS_BATCH: (sent when flushing a graphics window's buffer)
 	 * @win: graphics window.
-	 * @ptrval: GdkPixbuf, msg takes ownership and transfers to UI thread.
-	 * @x: x coordinate
-	 * @y: y coordinate
+	 * @ptrval: GArray of struct graphics_op, msg takes ownership and transfers
+	 * to UI thread.
 	 */
-	UI_MESSAGE_GRAPHICS_DRAW_IMAGE,
-	/* GRAPHICS_FILL_RECT:
-	 * @win: graphics window.
-	 * @uintval1: color
-	 * @uintval2: width in pixels
-	 * @uintval3: height in pixels
-	 * @x: x coordinate of left
-	 * @y: y coordinate of top
-	 */
-	UI_MESSAGE_GRAPHICS_FILL_RECT,
+	UI_MESSAGE_GRAPHICS_BATCH,
 	/* BUFFER_DRAW_IMAGE: (flushes window buffer first)
 	 * @win: text buffer window.
 	 * @uintval1: alignment
@@ -192,11 +186,13 @@ typedef struct {
 	bool is_waiting : 1;
 } UiMessage;
 
+G_GNUC_INTERNAL const char *ui_message_type_name(UiMessageType type);
 G_GNUC_INTERNAL UiMessage *ui_message_new(UiMessageType type, winid_t win);
 G_GNUC_INTERNAL void ui_message_free(UiMessage *msg);
 G_GNUC_INTERNAL void ui_message_queue(UiMessage *msg);
 G_GNUC_INTERNAL gint64 ui_message_queue_and_await(UiMessage *msg);
 G_GNUC_INTERNAL char *ui_message_queue_and_await_string(UiMessage *msg);
+G_GNUC_INTERNAL void ui_message_sync_arrange(void);
 G_GNUC_INTERNAL void ui_message_perform(ChimaraGlk *glk, UiMessage *msg);
 
 #endif /* UI_MESSAGE_H */
@@ -31,14 +31,22 @@ ui_calculate_zero_character_size(GtkWidget *widget, PangoFontDescription *font,
 	g_object_unref(zero);
 }
 
+/* Helper function: the window that @glk is in, to make dialogs transient for,
+ * or NULL if @glk is not in a window, as in headless mode. */
+static GtkWindow *
+get_parent_window(ChimaraGlk *glk)
+{
+	GtkWidget *toplevel = gtk_widget_get_toplevel(GTK_WIDGET(glk));
+	return gtk_widget_is_toplevel(toplevel)? GTK_WINDOW(toplevel) : NULL;
+}
+
 /* Internal ChimaraGlk method: prompt whether to overwrite the file
  * @display_name.
  * Returns the GTK_RESPONSE constant given by the dialog. */
 int
 ui_confirm_file_overwrite(ChimaraGlk *glk, const char *display_name)
 {
-	GtkWidget *toplevel = gtk_widget_get_toplevel(GTK_WIDGET(glk));
-	GtkWidget *dialog = gtk_message_dialog_new(GTK_WINDOW(toplevel), 0,
+	GtkWidget *dialog = gtk_message_dialog_new(get_parent_window(glk), 0,
 		GTK_MESSAGE_QUESTION, GTK_BUTTONS_YES_NO,
 		"File '%s' already exists. Overwrite?", display_name);
 	int response = gtk_dialog_run(GTK_DIALOG(dialog));
@@ -51,7 +59,7 @@ ui_confirm_file_overwrite(ChimaraGlk *glk, const char *display_name)
 char *
 ui_prompt_for_file(ChimaraGlk *glk, unsigned usage, unsigned fmode, const char *current_dir)
 {
-	GtkWindow *toplevel = GTK_WINDOW( gtk_widget_get_toplevel( GTK_WIDGET(glk) ) );
+	GtkWindow *toplevel = get_parent_window(glk);
 	GtkWidget *chooser;
 
 	switch(fmode) {
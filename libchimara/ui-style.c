@@ -1,4 +1,5 @@
 #include <math.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <gtk/gtk.h>
@@ -366,6 +367,7 @@ ui_window_measure_style(winid_t win, ChimaraGlk *glk, unsigned styl, unsigned hi
 	case wintype_TextGrid:
 		tag = chimara_glk_get_glk_tag(glk, CHIMARA_GLK_TEXT_GRID, chimara_glk_get_glk_tag_name(styl));
 		result = ui_style_query_tag(glk, tag, win->type, hint);
+		break;
 	default:
 		return (int64_t)1 << 32;
 	}
@@ -519,41 +521,188 @@ ui_style_get_window_colors(winid_t win, GdkRGBA **foreground, GdkRGBA **backgrou
 	}
 }
 
-/* Apply styles to a segment of text in a GtkTextBuffer, combining multiple
- * GtkTextTags.
- */
-void
-ui_style_apply(winid_t win, GtkTextIter *start, GtkTextIter *end)
+/* The combination of styles that text is printed in. The tag names point to
+ * static strings, and the tags are owned by the window's tag table. */
+typedef struct {
+	const char *style_tagname;
+	const char *glk_style_tagname;
+	GtkTextTag *zcolor;
+	GtkTextTag *zcolor_reversed;
+	gboolean hyperlink;
+} CompositeKey;
+
+static unsigned
+composite_key_hash(const CompositeKey *key)
 {
-	GtkTextBuffer *buffer = gtk_text_view_get_buffer( GTK_TEXT_VIEW(win->widget) );
-	GtkTextTagTable *tags = gtk_text_buffer_get_tag_table(buffer);
+	return g_direct_hash(key->style_tagname) ^ (g_direct_hash(key->glk_style_tagname) << 1)
+		^ g_direct_hash(key->zcolor) ^ (g_direct_hash(key->zcolor_reversed) << 2)
+		^ (unsigned)key->hyperlink;
+}
 
-	GtkTextTag *default_tag = gtk_text_tag_table_lookup(tags, "default");
-	GtkTextTag *style_tag = gtk_text_tag_table_lookup(tags, win->style_tagname);
-	GtkTextTag *glk_style_tag = gtk_text_tag_table_lookup(tags, win->glk_style_tagname);
+static gboolean
+composite_key_equal(const CompositeKey *a, const CompositeKey *b)
+{
+	return a->style_tagname == b->style_tagname
+		&& a->glk_style_tagname == b->glk_style_tagname
+		&& a->zcolor == b->zcolor
+		&& a->zcolor_reversed == b->zcolor_reversed
+		&& a->hyperlink == b->hyperlink;
+}
 
-	/* Player's style overrides */
-	gtk_text_buffer_apply_tag(buffer, style_tag, start, end);
+/* A GtkTextTag property that affects the appearance of text, and the
+ * "...-set" property that says whether a tag sets it */
+typedef struct {
+	const char *name;
+	const char *set_name;
+} TagProperty;
+
+/* Internal function: lists the properties that can be merged from one
+ * GtkTextTag into another. Properties without a "...-set" flag, such as
+ * "font-desc", are left out; their components are listed separately. */
+static GArray *
+get_mergeable_tag_properties(void)
+{
+	static gsize initialized = 0;
+	static GArray *retval = NULL;
+
+	if(g_once_init_enter(&initialized)) {
+		GObjectClass *klass = g_type_class_ref(GTK_TYPE_TEXT_TAG);
+		retval = g_array_new(FALSE, FALSE, sizeof(TagProperty));
+
+		unsigned nprops;
+		g_autofree GParamSpec **properties = g_object_class_list_properties(klass, &nprops);
+		for(unsigned count = 0; count < nprops; count++) {
+			GParamFlags flags = properties[count]->flags;
+			if(flags & G_PARAM_CONSTRUCT_ONLY
+				|| flags & G_PARAM_DEPRECATED
+				|| !(flags & G_PARAM_READABLE)
+				|| !(flags & G_PARAM_WRITABLE))
+				continue;
+
+			const char *name = g_param_spec_get_name(properties[count]);
+			if(g_str_has_suffix(name, "-set"))
+				continue;
+
+			/* "foreground-rgba" is flagged by "foreground-set", and so on */
+			g_autofree char *set_name = g_strconcat(name, "-set", NULL);
+			if(!g_object_class_find_property(klass, set_name) && g_str_has_suffix(name, "-rgba")) {
+				g_free(set_name);
+				set_name = g_strdup_printf("%.*s-set", (int)(strlen(name) - strlen("-rgba")), name);
+			}
+			if(!g_object_class_find_property(klass, set_name))
+				continue;
 
-	/* Glk program's style overrides */
-	gtk_text_buffer_apply_tag(buffer, glk_style_tag, start, end);
+			TagProperty prop = { name, g_intern_string(set_name) };
+			g_array_append_val(retval, prop);
+		}
 
-	/* Default style */
-	gtk_text_buffer_apply_tag(buffer, default_tag, start, end);
+		g_type_class_unref(klass);
+		g_once_init_leave(&initialized, 1);
+	}
+	return retval;
+}
 
-	/* Link style overrides */
-	if(win->window_stream->hyperlink_mode) {
-		GtkTextTag *link_style_tag = gtk_text_tag_table_lookup(tags, "hyperlink");
-		GtkTextTag *link_tag = win->current_hyperlink->tag;
-		gtk_text_buffer_apply_tag(buffer, link_style_tag, start, end);
-		gtk_text_buffer_apply_tag(buffer, link_tag, start, end);
+/* Internal function: sets all the properties that @source sets on @dest too,
+ * overriding the values already there. */
+static void
+merge_tag_properties(GtkTextTag *dest, GtkTextTag *source)
+{
+	GArray *properties = get_mergeable_tag_properties();
+	for(unsigned count = 0; count < properties->len; count++) {
+		TagProperty *prop = &g_array_index(properties, TagProperty, count);
+
+		gboolean is_set;
+		g_object_get(source, prop->set_name, &is_set, NULL);
+		if(!is_set)
+			continue;
+
+		GValue value = G_VALUE_INIT;
+		g_object_get_property(G_OBJECT(source), prop->name, &value);
+		g_object_set_property(G_OBJECT(dest), prop->name, &value);
+		g_value_unset(&value);
 	}
+}
+
+static int
+compare_tag_priority(const void *a, const void *b)
+{
+	return gtk_text_tag_get_priority(*(GtkTextTag * const *)a) - gtk_text_tag_get_priority(*(GtkTextTag * const *)b);
+}
+
+/* Internal function: gets the tag that combines the styles that @win is
+ * currently printing in. The tag is created the first time that combination is
+ * used in @win. Its properties are those that the individual tags would have
+ * produced if they were all applied, so the higher priority tags win.
+ * A window's tags are copies that do not change when style hints or CSS are
+ * changed, so the composite tags never need to be rebuilt. */
+static GtkTextTag *
+get_composite_tag(winid_t win, GtkTextBuffer *buffer, gboolean hyperlink)
+{
+	GHashTable *composites = g_object_get_data(G_OBJECT(buffer), "chimara-composite-tags");
+	if(composites == NULL) {
+		composites = g_hash_table_new_full((GHashFunc)composite_key_hash, (GEqualFunc)composite_key_equal, g_free, NULL);
+		g_object_set_data_full(G_OBJECT(buffer), "chimara-composite-tags", composites, (GDestroyNotify)g_hash_table_destroy);
+	}
+
+	CompositeKey key = { win->style_tagname, win->glk_style_tagname, win->zcolor, win->zcolor_reversed, hyperlink };
+	GtkTextTag *composite = g_hash_table_lookup(composites, &key);
+	if(composite != NULL)
+		return composite;
+
+	/* Player's style, Glk program's style, default style, link style, and
+	 * Glk program's colors from garglk_set_zcolors() and
+	 * garglk_set_reversevideo() */
+	GtkTextTagTable *tags = gtk_text_buffer_get_tag_table(buffer);
+	GtkTextTag *candidates[] = {
+		gtk_text_tag_table_lookup(tags, win->style_tagname),
+		gtk_text_tag_table_lookup(tags, win->glk_style_tagname),
+		gtk_text_tag_table_lookup(tags, "default"),
+		hyperlink ? gtk_text_tag_table_lookup(tags, "hyperlink") : NULL,
+		win->zcolor,
+		win->zcolor_reversed
+	};
+	GtkTextTag *parts[G_N_ELEMENTS(candidates)];
+	unsigned nparts = 0;
+	for(unsigned count = 0; count < G_N_ELEMENTS(candidates); count++) {
+		if(candidates[count] != NULL)
+			parts[nparts++] = candidates[count];
+	}
+	qsort(parts, nparts, sizeof(GtkTextTag *), compare_tag_priority);
+
+	/* Named, so that archived scrollback can find it again */
+	g_autofree char *name = g_strdup_printf("chimara-composite-%u", g_hash_table_size(composites));
+	composite = gtk_text_buffer_create_tag(buffer, name, NULL);
+	for(unsigned count = 0; count < nparts; count++)
+		merge_tag_properties(composite, parts[count]);
+
+	CompositeKey *stored_key = g_new(CompositeKey, 1);
+	*stored_key = key;
+	g_hash_table_insert(composites, stored_key, composite);
+	return composite;
+}
+
+/* Gets the composite tag that ui_style_apply() would currently apply to text
+ * printed in @win, not counting the tag of the current hyperlink. */
+GtkTextTag *
+ui_style_get_composite_tag(winid_t win)
+{
+	GtkTextBuffer *buffer = gtk_text_view_get_buffer( GTK_TEXT_VIEW(win->widget) );
+	return get_composite_tag(win, buffer, win->window_stream->hyperlink_mode);
+}
+
+/* Apply styles to a segment of text in a GtkTextBuffer. All the styles are
+ * combined into one composite tag, so that only that tag, and the tag of the
+ * current hyperlink, if any, have to be applied.
+ */
+void
+ui_style_apply(winid_t win, GtkTextIter *start, GtkTextIter *end)
+{
+	GtkTextBuffer *buffer = gtk_text_view_get_buffer( GTK_TEXT_VIEW(win->widget) );
+	gboolean hyperlink = win->window_stream->hyperlink_mode;
 
-	/* Glk program's style overrides using garglk_set_zcolors() */
-	if(win->zcolor != NULL)
-		gtk_text_buffer_apply_tag(buffer, win->zcolor, start, end);
+	gtk_text_buffer_apply_tag(buffer, get_composite_tag(win, buffer, hyperlink), start, end);
 
-	/* Glk program's style overrides using garglk_set_reversevideo() */
-	if(win->zcolor_reversed != NULL)
-		gtk_text_buffer_apply_tag(buffer, win->zcolor_reversed, start, end);
+	/* The link tag carries no style, only the click handler */
+	if(hyperlink)
+		gtk_text_buffer_apply_tag(buffer, win->current_hyperlink->tag, start, end);
 }
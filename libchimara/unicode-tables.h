@@ -0,0 +1,3930 @@
+/* Generated by build-aux/gen_unicode_tables.py from Unicode 14.0.0. Do not edit. */
+
+#ifndef UNICODE_TABLES_H
+#define UNICODE_TABLES_H
+
+#define UNICODE_TABLES_SHIFT 6
+#define UNICODE_TABLES_MASK 0x3F
+
+/* Case mapping: a two-stage table gives the index of each character's record in
+ * case_records. Record 0 is the identity mapping. */
+#define CASE_MAX_EXPANSION 3
+#define CASE_LIMIT 0x1E980
+
+static const guint8 case_stage1[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0,
+	0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 21, 22, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 23, 24, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 25, 0, 0, 26, 27, 0,
+	28, 28, 29, 28, 30, 31, 32, 33, 0, 0, 0, 0,
+	34, 35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 28, 41,
+	42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 43, 44, 0, 45, 46, 47, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	52, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 54, 55, 56, 57,
+	0, 58, 59, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 60, 61, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 62, 63, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	65, 66,
+};
+
+static const guint16 case_stage2[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+	1, 1, 1, 1, 1, 1, 1, 4, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+	2, 2, 2, 5, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 8, 9, 6, 7, 6, 7, 6, 7,
+	0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 10, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+	13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6,
+	7, 0, 17, 18, 19, 6, 7, 16, 20, 21, 22, 23,
+	6, 7, 24, 0, 22, 25, 26, 27, 6, 7, 6, 7,
+	6, 7, 28, 6, 7, 28, 0, 0, 6, 7, 28, 6,
+	7, 29, 29, 6, 7, 6, 7, 30, 6, 7, 0, 0,
+	6, 7, 0, 31, 0, 0, 0, 0, 32, 33, 34, 32,
+	33, 34, 32, 33, 34, 6, 7, 6, 7, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 6, 7, 35, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 36, 32, 33, 34, 6, 7, 37, 38,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 39, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 0, 0, 0, 0, 40, 6, 7, 41, 42, 43,
+	43, 6, 7, 44, 45, 46, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 47, 48, 49, 50, 51, 0, 52, 52,
+	0, 53, 0, 54, 55, 0, 0, 0, 52, 56, 0, 57,
+	0, 58, 59, 0, 60, 61, 59, 62, 63, 0, 0, 61,
+	0, 64, 65, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+	0, 67, 0, 0, 68, 0, 69, 68, 0, 0, 0, 70,
+	68, 71, 72, 72, 73, 0, 0, 0, 0, 0, 74, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7,
+	0, 0, 6, 7, 0, 0, 0, 26, 26, 26, 0, 78,
+	0, 0, 0, 0, 0, 0, 79, 0, 80, 80, 80, 0,
+	81, 0, 82, 82, 83, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 84, 85, 85, 85,
+	86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 87, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 88, 89, 89, 90, 91, 92, 0, 0,
+	0, 93, 94, 95, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 96, 97, 98, 99, 100, 101, 0, 6,
+	7, 102, 6, 7, 0, 39, 39, 39, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 97, 97, 97, 97, 97, 97, 97, 97,
+	97, 97, 97, 97, 97, 97, 97, 97, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0,
+	0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 104, 6, 7, 6,
+	7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 105,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 108, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+	109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 0, 109,
+	0, 0, 0, 0, 0, 109, 0, 0, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+	110, 110, 110, 0, 0, 110, 110, 110, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+	90, 90, 90, 90, 90, 90, 0, 0, 95, 95, 95, 95,
+	95, 95, 0, 0, 112, 113, 114, 115, 115, 116, 117, 118,
+	119, 0, 0, 0, 0, 0, 0, 0, 120, 120, 120, 120,
+	120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+	120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+	120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+	120, 120, 120, 0, 0, 120, 120, 120, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 121, 0, 0, 0, 122, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 124, 125, 126, 127, 128, 129,
+	0, 0, 130, 0, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132,
+	132, 132, 132, 132, 131, 131, 131, 131, 131, 131, 0, 0,
+	132, 132, 132, 132, 132, 132, 0, 0, 131, 131, 131, 131,
+	131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132,
+	131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132,
+	132, 132, 132, 132, 131, 131, 131, 131, 131, 131, 0, 0,
+	132, 132, 132, 132, 132, 132, 0, 0, 133, 131, 134, 131,
+	135, 131, 136, 131, 0, 132, 0, 132, 0, 132, 0, 132,
+	131, 131, 131, 131, 131, 131, 131, 131, 132, 132, 132, 132,
+	132, 132, 132, 132, 137, 137, 138, 138, 138, 138, 139, 139,
+	140, 140, 141, 141, 142, 142, 0, 0, 143, 144, 145, 146,
+	147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+	159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170,
+	171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+	183, 184, 185, 186, 187, 188, 189, 190, 131, 131, 191, 192,
+	193, 0, 194, 195, 132, 132, 196, 196, 197, 0, 198, 0,
+	0, 0, 199, 200, 201, 0, 202, 203, 204, 204, 204, 204,
+	205, 0, 0, 0, 131, 131, 206, 83, 0, 0, 207, 208,
+	132, 132, 209, 209, 0, 0, 0, 0, 131, 131, 210, 86,
+	211, 98, 212, 213, 132, 132, 214, 214, 102, 0, 0, 0,
+	0, 0, 215, 216, 217, 0, 218, 219, 220, 220, 221, 221,
+	222, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 223, 0, 0, 0, 224, 225,
+	0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 228, 228, 228, 228, 228, 228, 228, 228,
+	228, 228, 228, 228, 228, 228, 228, 228, 229, 229, 229, 229,
+	229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+	0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+	231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+	231, 231, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+	6, 7, 232, 233, 234, 235, 236, 6, 7, 6, 7, 6,
+	7, 237, 238, 239, 240, 0, 6, 7, 0, 6, 7, 0,
+	0, 0, 0, 0, 0, 0, 241, 241, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+	0, 0, 0, 6, 7, 6, 7, 0, 0, 0, 6, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+	242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+	242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+	242, 242, 0, 242, 0, 0, 0, 0, 0, 242, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6, 7, 6, 7, 243, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 0, 0, 0, 6, 7, 244, 0, 0,
+	6, 7, 6, 7, 245, 0, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 246, 247, 248, 249, 246, 0, 250, 251, 252, 253,
+	6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+	6, 7, 6, 7, 254, 255, 256, 6, 7, 6, 7, 0,
+	0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 6, 7,
+	6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 257,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258, 258,
+	259, 260, 261, 262, 263, 264, 264, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 265, 266, 267, 268, 269,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+	270, 270, 270, 270, 271, 271, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 271, 271, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+	270, 270, 270, 270, 270, 270, 270, 270, 0, 0, 0, 0,
+	271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+	271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 272, 272, 272, 272, 272, 272, 272, 272,
+	272, 272, 272, 0, 272, 272, 272, 272, 272, 272, 272, 272,
+	272, 272, 272, 272, 272, 272, 272, 0, 272, 272, 272, 272,
+	272, 272, 272, 0, 272, 272, 0, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 0, 273, 273, 273, 273, 273,
+	273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 0, 273,
+	273, 273, 273, 273, 273, 273, 0, 273, 273, 0, 0, 0,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+	81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+	88, 88, 88, 88, 88, 88, 88, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+	274, 274, 274, 274, 274, 274, 275, 275, 275, 275, 275, 275,
+	275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+	275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275,
+	275, 275, 275, 275, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0,
+};
+
+static const CaseRecord case_records[] = {
+	{ { 0, 0, 0 }, { 0, 0, 0 } },
+	{ { 0, 32, 0 }, { 0, 0, 0 } },
+	{ { -32, 0, -32 }, { 0, 0, 0 } },
+	{ { 743, 0, 743 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 1, 0, 4 } },
+	{ { 121, 0, 121 }, { 0, 0, 0 } },
+	{ { 0, 1, 0 }, { 0, 0, 0 } },
+	{ { -1, 0, -1 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 0, 7, 0 } },
+	{ { -232, 0, -232 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 10, 0, 10 } },
+	{ { 0, -121, 0 }, { 0, 0, 0 } },
+	{ { -300, 0, -300 }, { 0, 0, 0 } },
+	{ { 195, 0, 195 }, { 0, 0, 0 } },
+	{ { 0, 210, 0 }, { 0, 0, 0 } },
+	{ { 0, 206, 0 }, { 0, 0, 0 } },
+	{ { 0, 205, 0 }, { 0, 0, 0 } },
+	{ { 0, 79, 0 }, { 0, 0, 0 } },
+	{ { 0, 202, 0 }, { 0, 0, 0 } },
+	{ { 0, 203, 0 }, { 0, 0, 0 } },
+	{ { 0, 207, 0 }, { 0, 0, 0 } },
+	{ { 97, 0, 97 }, { 0, 0, 0 } },
+	{ { 0, 211, 0 }, { 0, 0, 0 } },
+	{ { 0, 209, 0 }, { 0, 0, 0 } },
+	{ { 163, 0, 163 }, { 0, 0, 0 } },
+	{ { 0, 213, 0 }, { 0, 0, 0 } },
+	{ { 130, 0, 130 }, { 0, 0, 0 } },
+	{ { 0, 214, 0 }, { 0, 0, 0 } },
+	{ { 0, 218, 0 }, { 0, 0, 0 } },
+	{ { 0, 217, 0 }, { 0, 0, 0 } },
+	{ { 0, 219, 0 }, { 0, 0, 0 } },
+	{ { 56, 0, 56 }, { 0, 0, 0 } },
+	{ { 0, 2, 1 }, { 0, 0, 0 } },
+	{ { -1, 1, 0 }, { 0, 0, 0 } },
+	{ { -2, 0, -1 }, { 0, 0, 0 } },
+	{ { -79, 0, -79 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 13, 0, 13 } },
+	{ { 0, -97, 0 }, { 0, 0, 0 } },
+	{ { 0, -56, 0 }, { 0, 0, 0 } },
+	{ { 0, -130, 0 }, { 0, 0, 0 } },
+	{ { 0, 10795, 0 }, { 0, 0, 0 } },
+	{ { 0, -163, 0 }, { 0, 0, 0 } },
+	{ { 0, 10792, 0 }, { 0, 0, 0 } },
+	{ { 10815, 0, 10815 }, { 0, 0, 0 } },
+	{ { 0, -195, 0 }, { 0, 0, 0 } },
+	{ { 0, 69, 0 }, { 0, 0, 0 } },
+	{ { 0, 71, 0 }, { 0, 0, 0 } },
+	{ { 10783, 0, 10783 }, { 0, 0, 0 } },
+	{ { 10780, 0, 10780 }, { 0, 0, 0 } },
+	{ { 10782, 0, 10782 }, { 0, 0, 0 } },
+	{ { -210, 0, -210 }, { 0, 0, 0 } },
+	{ { -206, 0, -206 }, { 0, 0, 0 } },
+	{ { -205, 0, -205 }, { 0, 0, 0 } },
+	{ { -202, 0, -202 }, { 0, 0, 0 } },
+	{ { -203, 0, -203 }, { 0, 0, 0 } },
+	{ { 42319, 0, 42319 }, { 0, 0, 0 } },
+	{ { 42315, 0, 42315 }, { 0, 0, 0 } },
+	{ { -207, 0, -207 }, { 0, 0, 0 } },
+	{ { 42280, 0, 42280 }, { 0, 0, 0 } },
+	{ { 42308, 0, 42308 }, { 0, 0, 0 } },
+	{ { -209, 0, -209 }, { 0, 0, 0 } },
+	{ { -211, 0, -211 }, { 0, 0, 0 } },
+	{ { 10743, 0, 10743 }, { 0, 0, 0 } },
+	{ { 42305, 0, 42305 }, { 0, 0, 0 } },
+	{ { 10749, 0, 10749 }, { 0, 0, 0 } },
+	{ { -213, 0, -213 }, { 0, 0, 0 } },
+	{ { -214, 0, -214 }, { 0, 0, 0 } },
+	{ { 10727, 0, 10727 }, { 0, 0, 0 } },
+	{ { -218, 0, -218 }, { 0, 0, 0 } },
+	{ { 42307, 0, 42307 }, { 0, 0, 0 } },
+	{ { 42282, 0, 42282 }, { 0, 0, 0 } },
+	{ { -69, 0, -69 }, { 0, 0, 0 } },
+	{ { -217, 0, -217 }, { 0, 0, 0 } },
+	{ { -71, 0, -71 }, { 0, 0, 0 } },
+	{ { -219, 0, -219 }, { 0, 0, 0 } },
+	{ { 42261, 0, 42261 }, { 0, 0, 0 } },
+	{ { 42258, 0, 42258 }, { 0, 0, 0 } },
+	{ { 84, 0, 84 }, { 0, 0, 0 } },
+	{ { 0, 116, 0 }, { 0, 0, 0 } },
+	{ { 0, 38, 0 }, { 0, 0, 0 } },
+	{ { 0, 37, 0 }, { 0, 0, 0 } },
+	{ { 0, 64, 0 }, { 0, 0, 0 } },
+	{ { 0, 63, 0 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 16, 0, 16 } },
+	{ { -38, 0, -38 }, { 0, 0, 0 } },
+	{ { -37, 0, -37 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 20, 0, 20 } },
+	{ { -31, 0, -31 }, { 0, 0, 0 } },
+	{ { -64, 0, -64 }, { 0, 0, 0 } },
+	{ { -63, 0, -63 }, { 0, 0, 0 } },
+	{ { 0, 8, 0 }, { 0, 0, 0 } },
+	{ { -62, 0, -62 }, { 0, 0, 0 } },
+	{ { -57, 0, -57 }, { 0, 0, 0 } },
+	{ { -47, 0, -47 }, { 0, 0, 0 } },
+	{ { -54, 0, -54 }, { 0, 0, 0 } },
+	{ { -8, 0, -8 }, { 0, 0, 0 } },
+	{ { -86, 0, -86 }, { 0, 0, 0 } },
+	{ { -80, 0, -80 }, { 0, 0, 0 } },
+	{ { 7, 0, 7 }, { 0, 0, 0 } },
+	{ { -116, 0, -116 }, { 0, 0, 0 } },
+	{ { 0, -60, 0 }, { 0, 0, 0 } },
+	{ { -96, 0, -96 }, { 0, 0, 0 } },
+	{ { 0, -7, 0 }, { 0, 0, 0 } },
+	{ { 0, 80, 0 }, { 0, 0, 0 } },
+	{ { 0, 15, 0 }, { 0, 0, 0 } },
+	{ { -15, 0, -15 }, { 0, 0, 0 } },
+	{ { 0, 48, 0 }, { 0, 0, 0 } },
+	{ { -48, 0, -48 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 24, 0, 27 } },
+	{ { 0, 7264, 0 }, { 0, 0, 0 } },
+	{ { 3008, 0, 0 }, { 0, 0, 0 } },
+	{ { 0, 38864, 0 }, { 0, 0, 0 } },
+	{ { -6254, 0, -6254 }, { 0, 0, 0 } },
+	{ { -6253, 0, -6253 }, { 0, 0, 0 } },
+	{ { -6244, 0, -6244 }, { 0, 0, 0 } },
+	{ { -6242, 0, -6242 }, { 0, 0, 0 } },
+	{ { -6243, 0, -6243 }, { 0, 0, 0 } },
+	{ { -6236, 0, -6236 }, { 0, 0, 0 } },
+	{ { -6181, 0, -6181 }, { 0, 0, 0 } },
+	{ { 35266, 0, 35266 }, { 0, 0, 0 } },
+	{ { 0, -3008, 0 }, { 0, 0, 0 } },
+	{ { 35332, 0, 35332 }, { 0, 0, 0 } },
+	{ { 3814, 0, 3814 }, { 0, 0, 0 } },
+	{ { 35384, 0, 35384 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 30, 0, 30 } },
+	{ { 0, 0, 0 }, { 33, 0, 33 } },
+	{ { 0, 0, 0 }, { 36, 0, 36 } },
+	{ { 0, 0, 0 }, { 39, 0, 39 } },
+	{ { 0, 0, 0 }, { 42, 0, 42 } },
+	{ { -59, 0, -59 }, { 0, 0, 0 } },
+	{ { 0, -7615, 0 }, { 0, 0, 0 } },
+	{ { 8, 0, 8 }, { 0, 0, 0 } },
+	{ { 0, -8, 0 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 45, 0, 45 } },
+	{ { 0, 0, 0 }, { 48, 0, 48 } },
+	{ { 0, 0, 0 }, { 52, 0, 52 } },
+	{ { 0, 0, 0 }, { 56, 0, 56 } },
+	{ { 74, 0, 74 }, { 0, 0, 0 } },
+	{ { 86, 0, 86 }, { 0, 0, 0 } },
+	{ { 100, 0, 100 }, { 0, 0, 0 } },
+	{ { 128, 0, 128 }, { 0, 0, 0 } },
+	{ { 112, 0, 112 }, { 0, 0, 0 } },
+	{ { 126, 0, 126 }, { 0, 0, 0 } },
+	{ { 0, 0, 8 }, { 60, 0, 0 } },
+	{ { 0, 0, 8 }, { 63, 0, 0 } },
+	{ { 0, 0, 8 }, { 66, 0, 0 } },
+	{ { 0, 0, 8 }, { 69, 0, 0 } },
+	{ { 0, 0, 8 }, { 72, 0, 0 } },
+	{ { 0, 0, 8 }, { 75, 0, 0 } },
+	{ { 0, 0, 8 }, { 78, 0, 0 } },
+	{ { 0, 0, 8 }, { 81, 0, 0 } },
+	{ { 0, -8, 0 }, { 60, 0, 0 } },
+	{ { 0, -8, 0 }, { 63, 0, 0 } },
+	{ { 0, -8, 0 }, { 66, 0, 0 } },
+	{ { 0, -8, 0 }, { 69, 0, 0 } },
+	{ { 0, -8, 0 }, { 72, 0, 0 } },
+	{ { 0, -8, 0 }, { 75, 0, 0 } },
+	{ { 0, -8, 0 }, { 78, 0, 0 } },
+	{ { 0, -8, 0 }, { 81, 0, 0 } },
+	{ { 0, 0, 8 }, { 84, 0, 0 } },
+	{ { 0, 0, 8 }, { 87, 0, 0 } },
+	{ { 0, 0, 8 }, { 90, 0, 0 } },
+	{ { 0, 0, 8 }, { 93, 0, 0 } },
+	{ { 0, 0, 8 }, { 96, 0, 0 } },
+	{ { 0, 0, 8 }, { 99, 0, 0 } },
+	{ { 0, 0, 8 }, { 102, 0, 0 } },
+	{ { 0, 0, 8 }, { 105, 0, 0 } },
+	{ { 0, -8, 0 }, { 84, 0, 0 } },
+	{ { 0, -8, 0 }, { 87, 0, 0 } },
+	{ { 0, -8, 0 }, { 90, 0, 0 } },
+	{ { 0, -8, 0 }, { 93, 0, 0 } },
+	{ { 0, -8, 0 }, { 96, 0, 0 } },
+	{ { 0, -8, 0 }, { 99, 0, 0 } },
+	{ { 0, -8, 0 }, { 102, 0, 0 } },
+	{ { 0, -8, 0 }, { 105, 0, 0 } },
+	{ { 0, 0, 8 }, { 108, 0, 0 } },
+	{ { 0, 0, 8 }, { 111, 0, 0 } },
+	{ { 0, 0, 8 }, { 114, 0, 0 } },
+	{ { 0, 0, 8 }, { 117, 0, 0 } },
+	{ { 0, 0, 8 }, { 120, 0, 0 } },
+	{ { 0, 0, 8 }, { 123, 0, 0 } },
+	{ { 0, 0, 8 }, { 126, 0, 0 } },
+	{ { 0, 0, 8 }, { 129, 0, 0 } },
+	{ { 0, -8, 0 }, { 108, 0, 0 } },
+	{ { 0, -8, 0 }, { 111, 0, 0 } },
+	{ { 0, -8, 0 }, { 114, 0, 0 } },
+	{ { 0, -8, 0 }, { 117, 0, 0 } },
+	{ { 0, -8, 0 }, { 120, 0, 0 } },
+	{ { 0, -8, 0 }, { 123, 0, 0 } },
+	{ { 0, -8, 0 }, { 126, 0, 0 } },
+	{ { 0, -8, 0 }, { 129, 0, 0 } },
+	{ { 0, 0, 0 }, { 132, 0, 135 } },
+	{ { 0, 0, 9 }, { 138, 0, 0 } },
+	{ { 0, 0, 0 }, { 141, 0, 144 } },
+	{ { 0, 0, 0 }, { 147, 0, 147 } },
+	{ { 0, 0, 0 }, { 150, 0, 154 } },
+	{ { 0, -74, 0 }, { 0, 0, 0 } },
+	{ { 0, -9, 0 }, { 138, 0, 0 } },
+	{ { -7205, 0, -7205 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 158, 0, 161 } },
+	{ { 0, 0, 9 }, { 164, 0, 0 } },
+	{ { 0, 0, 0 }, { 167, 0, 170 } },
+	{ { 0, 0, 0 }, { 173, 0, 173 } },
+	{ { 0, 0, 0 }, { 176, 0, 180 } },
+	{ { 0, -86, 0 }, { 0, 0, 0 } },
+	{ { 0, -9, 0 }, { 164, 0, 0 } },
+	{ { 0, 0, 0 }, { 184, 0, 184 } },
+	{ { 0, 0, 0 }, { 188, 0, 188 } },
+	{ { 0, 0, 0 }, { 191, 0, 191 } },
+	{ { 0, -100, 0 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 195, 0, 195 } },
+	{ { 0, 0, 0 }, { 199, 0, 199 } },
+	{ { 0, 0, 0 }, { 202, 0, 202 } },
+	{ { 0, 0, 0 }, { 205, 0, 205 } },
+	{ { 0, -112, 0 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 209, 0, 212 } },
+	{ { 0, 0, 9 }, { 215, 0, 0 } },
+	{ { 0, 0, 0 }, { 218, 0, 221 } },
+	{ { 0, 0, 0 }, { 224, 0, 224 } },
+	{ { 0, 0, 0 }, { 227, 0, 231 } },
+	{ { 0, -128, 0 }, { 0, 0, 0 } },
+	{ { 0, -126, 0 }, { 0, 0, 0 } },
+	{ { 0, -9, 0 }, { 215, 0, 0 } },
+	{ { 0, -7517, 0 }, { 0, 0, 0 } },
+	{ { 0, -8383, 0 }, { 0, 0, 0 } },
+	{ { 0, -8262, 0 }, { 0, 0, 0 } },
+	{ { 0, 28, 0 }, { 0, 0, 0 } },
+	{ { -28, 0, -28 }, { 0, 0, 0 } },
+	{ { 0, 16, 0 }, { 0, 0, 0 } },
+	{ { -16, 0, -16 }, { 0, 0, 0 } },
+	{ { 0, 26, 0 }, { 0, 0, 0 } },
+	{ { -26, 0, -26 }, { 0, 0, 0 } },
+	{ { 0, -10743, 0 }, { 0, 0, 0 } },
+	{ { 0, -3814, 0 }, { 0, 0, 0 } },
+	{ { 0, -10727, 0 }, { 0, 0, 0 } },
+	{ { -10795, 0, -10795 }, { 0, 0, 0 } },
+	{ { -10792, 0, -10792 }, { 0, 0, 0 } },
+	{ { 0, -10780, 0 }, { 0, 0, 0 } },
+	{ { 0, -10749, 0 }, { 0, 0, 0 } },
+	{ { 0, -10783, 0 }, { 0, 0, 0 } },
+	{ { 0, -10782, 0 }, { 0, 0, 0 } },
+	{ { 0, -10815, 0 }, { 0, 0, 0 } },
+	{ { -7264, 0, -7264 }, { 0, 0, 0 } },
+	{ { 0, -35332, 0 }, { 0, 0, 0 } },
+	{ { 0, -42280, 0 }, { 0, 0, 0 } },
+	{ { 48, 0, 48 }, { 0, 0, 0 } },
+	{ { 0, -42308, 0 }, { 0, 0, 0 } },
+	{ { 0, -42319, 0 }, { 0, 0, 0 } },
+	{ { 0, -42315, 0 }, { 0, 0, 0 } },
+	{ { 0, -42305, 0 }, { 0, 0, 0 } },
+	{ { 0, -42258, 0 }, { 0, 0, 0 } },
+	{ { 0, -42282, 0 }, { 0, 0, 0 } },
+	{ { 0, -42261, 0 }, { 0, 0, 0 } },
+	{ { 0, 928, 0 }, { 0, 0, 0 } },
+	{ { 0, -48, 0 }, { 0, 0, 0 } },
+	{ { 0, -42307, 0 }, { 0, 0, 0 } },
+	{ { 0, -35384, 0 }, { 0, 0, 0 } },
+	{ { -928, 0, -928 }, { 0, 0, 0 } },
+	{ { -38864, 0, -38864 }, { 0, 0, 0 } },
+	{ { 0, 0, 0 }, { 235, 0, 238 } },
+	{ { 0, 0, 0 }, { 241, 0, 244 } },
+	{ { 0, 0, 0 }, { 247, 0, 250 } },
+	{ { 0, 0, 0 }, { 253, 0, 257 } },
+	{ { 0, 0, 0 }, { 261, 0, 265 } },
+	{ { 0, 0, 0 }, { 269, 0, 272 } },
+	{ { 0, 0, 0 }, { 275, 0, 278 } },
+	{ { 0, 0, 0 }, { 281, 0, 284 } },
+	{ { 0, 0, 0 }, { 287, 0, 290 } },
+	{ { 0, 0, 0 }, { 293, 0, 296 } },
+	{ { 0, 0, 0 }, { 299, 0, 302 } },
+	{ { 0, 40, 0 }, { 0, 0, 0 } },
+	{ { -40, 0, -40 }, { 0, 0, 0 } },
+	{ { 0, 39, 0 }, { 0, 0, 0 } },
+	{ { -39, 0, -39 }, { 0, 0, 0 } },
+	{ { 0, 34, 0 }, { 0, 0, 0 } },
+	{ { -34, 0, -34 }, { 0, 0, 0 } },
+};
+
+static const glui32 case_special[] = {
+	0x0000, 0x0002, 0x0053, 0x0053, 0x0002, 0x0053, 0x0073, 0x0002,
+	0x0069, 0x0307, 0x0002, 0x02BC, 0x004E, 0x0002, 0x004A, 0x030C,
+	0x0003, 0x0399, 0x0308, 0x0301, 0x0003, 0x03A5, 0x0308, 0x0301,
+	0x0002, 0x0535, 0x0552, 0x0002, 0x0535, 0x0582, 0x0002, 0x0048,
+	0x0331, 0x0002, 0x0054, 0x0308, 0x0002, 0x0057, 0x030A, 0x0002,
+	0x0059, 0x030A, 0x0002, 0x0041, 0x02BE, 0x0002, 0x03A5, 0x0313,
+	0x0003, 0x03A5, 0x0313, 0x0300, 0x0003, 0x03A5, 0x0313, 0x0301,
+	0x0003, 0x03A5, 0x0313, 0x0342, 0x0002, 0x1F08, 0x0399, 0x0002,
+	0x1F09, 0x0399, 0x0002, 0x1F0A, 0x0399, 0x0002, 0x1F0B, 0x0399,
+	0x0002, 0x1F0C, 0x0399, 0x0002, 0x1F0D, 0x0399, 0x0002, 0x1F0E,
+	0x0399, 0x0002, 0x1F0F, 0x0399, 0x0002, 0x1F28, 0x0399, 0x0002,
+	0x1F29, 0x0399, 0x0002, 0x1F2A, 0x0399, 0x0002, 0x1F2B, 0x0399,
+	0x0002, 0x1F2C, 0x0399, 0x0002, 0x1F2D, 0x0399, 0x0002, 0x1F2E,
+	0x0399, 0x0002, 0x1F2F, 0x0399, 0x0002, 0x1F68, 0x0399, 0x0002,
+	0x1F69, 0x0399, 0x0002, 0x1F6A, 0x0399, 0x0002, 0x1F6B, 0x0399,
+	0x0002, 0x1F6C, 0x0399, 0x0002, 0x1F6D, 0x0399, 0x0002, 0x1F6E,
+	0x0399, 0x0002, 0x1F6F, 0x0399, 0x0002, 0x1FBA, 0x0399, 0x0002,
+	0x1FBA, 0x0345, 0x0002, 0x0391, 0x0399, 0x0002, 0x0386, 0x0399,
+	0x0002, 0x0386, 0x0345, 0x0002, 0x0391, 0x0342, 0x0003, 0x0391,
+	0x0342, 0x0399, 0x0003, 0x0391, 0x0342, 0x0345, 0x0002, 0x1FCA,
+	0x0399, 0x0002, 0x1FCA, 0x0345, 0x0002, 0x0397, 0x0399, 0x0002,
+	0x0389, 0x0399, 0x0002, 0x0389, 0x0345, 0x0002, 0x0397, 0x0342,
+	0x0003, 0x0397, 0x0342, 0x0399, 0x0003, 0x0397, 0x0342, 0x0345,
+	0x0003, 0x0399, 0x0308, 0x0300, 0x0002, 0x0399, 0x0342, 0x0003,
+	0x0399, 0x0308, 0x0342, 0x0003, 0x03A5, 0x0308, 0x0300, 0x0002,
+	0x03A1, 0x0313, 0x0002, 0x03A5, 0x0342, 0x0003, 0x03A5, 0x0308,
+	0x0342, 0x0002, 0x1FFA, 0x0399, 0x0002, 0x1FFA, 0x0345, 0x0002,
+	0x03A9, 0x0399, 0x0002, 0x038F, 0x0399, 0x0002, 0x038F, 0x0345,
+	0x0002, 0x03A9, 0x0342, 0x0003, 0x03A9, 0x0342, 0x0399, 0x0003,
+	0x03A9, 0x0342, 0x0345, 0x0002, 0x0046, 0x0046, 0x0002, 0x0046,
+	0x0066, 0x0002, 0x0046, 0x0049, 0x0002, 0x0046, 0x0069, 0x0002,
+	0x0046, 0x004C, 0x0002, 0x0046, 0x006C, 0x0003, 0x0046, 0x0046,
+	0x0049, 0x0003, 0x0046, 0x0066, 0x0069, 0x0003, 0x0046, 0x0046,
+	0x004C, 0x0003, 0x0046, 0x0066, 0x006C, 0x0002, 0x0053, 0x0054,
+	0x0002, 0x0053, 0x0074, 0x0002, 0x0544, 0x0546, 0x0002, 0x0544,
+	0x0576, 0x0002, 0x0544, 0x0535, 0x0002, 0x0544, 0x0565, 0x0002,
+	0x0544, 0x053B, 0x0002, 0x0544, 0x056B, 0x0002, 0x054E, 0x0546,
+	0x0002, 0x054E, 0x0576, 0x0002, 0x0544, 0x053D, 0x0002, 0x0544,
+	0x056D,
+};
+
+/* Canonical normalization. norm_decomp gives the offset into norm_decomp_data of
+ * each character's full canonical decomposition, stored as a length followed
+ * by the characters; offset 0 means the character does not decompose. Hangul
+ * syllables are handled algorithmically. */
+#define NFD_QUICK_LIMIT 0x00C0
+#define NFC_QUICK_LIMIT 0x0300
+#define NORM_MAX_DECOMPOSITION 4
+
+#define NORM_CCC_LIMIT 0x1E980
+
+static const guint8 norm_ccc_stage1[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 2, 0, 0, 0, 0, 3, 0, 0, 0, 4, 5,
+	6, 7, 0, 8, 9, 10, 0, 11, 12, 13, 14, 15,
+	16, 17, 16, 18, 16, 19, 16, 19, 16, 19, 0, 19,
+	16, 20, 16, 19, 21, 19, 0, 22, 23, 24, 25, 26,
+	27, 28, 29, 30, 31, 0, 32, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 35,
+	0, 0, 36, 0, 37, 0, 0, 0, 38, 39, 40, 41,
+	42, 43, 44, 45, 46, 0, 0, 47, 0, 0, 0, 48,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+	0, 51, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0,
+	53, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 55, 56, 57, 0, 0, 0, 0,
+	58, 0, 0, 59, 60, 61, 62, 63, 0, 0, 64, 65,
+	0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69,
+	0, 0, 0, 70, 0, 71, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 73,
+	0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0,
+	0, 0, 75, 0, 0, 76, 77, 0, 0, 78, 79, 0,
+	80, 62, 0, 81, 82, 0, 0, 83, 84, 85, 0, 0,
+	0, 86, 0, 87, 0, 0, 51, 88, 51, 0, 89, 0,
+	90, 0, 0, 0, 79, 0, 0, 0, 91, 92, 0, 93,
+	94, 95, 96, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+	0, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99,
+	100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 103, 104, 0, 0, 105, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	106, 0, 0, 0, 100, 0, 0, 0, 0, 0, 107, 108,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 109,
+	0, 110,
+};
+
+static const guint8 norm_ccc_stage2[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 232, 220, 220, 220, 220, 232, 216, 220, 220, 220, 220,
+	220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220,
+	220, 220, 220, 220, 220, 220, 220, 220, 1, 1, 1, 1,
+	1, 220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230,
+	230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+	230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230,
+	233, 234, 234, 233, 234, 234, 233, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 230, 230,
+	230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+	230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230,
+	230, 222, 228, 230, 10, 11, 12, 13, 14, 15, 16, 17,
+	18, 19, 19, 20, 21, 22, 0, 23, 0, 24, 25, 0,
+	230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+	30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34, 230,
+	230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230,
+	230, 0, 0, 230, 230, 230, 230, 220, 230, 0, 0, 230,
+	230, 0, 220, 230, 230, 220, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220,
+	220, 230, 220, 230, 230, 230, 220, 230, 220, 230, 220, 230,
+	220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 220, 230,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+	230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220,
+	230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+	230, 230, 230, 220, 220, 220, 220, 220, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 220,
+	230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+	27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230,
+	230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+	0, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+	0, 0, 0, 0, 0, 84, 91, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	118, 118, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 129, 130, 0, 132, 0, 0, 0,
+	0, 0, 130, 130, 130, 130, 0, 0, 130, 0, 230, 230,
+	9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 222, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230,
+	230, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220,
+	220, 220, 220, 230, 230, 220, 0, 220, 220, 230, 230, 220,
+	220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+	220, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230,
+	220, 220, 220, 220, 230, 0, 1, 1, 1, 1, 1, 1,
+	1, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0,
+	230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+	230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230,
+	230, 234, 214, 220, 202, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230,
+	233, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 1, 1,
+	230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+	0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1,
+	220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 218, 228, 232, 222, 224, 224, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 230, 0, 0, 0, 0, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0, 230,
+	230, 0, 0, 0, 0, 0, 230, 230, 0, 230, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 220,
+	220, 220, 220, 220, 220, 220, 230, 230, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 220, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0,
+	0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220,
+	230, 230, 230, 220, 230, 220, 220, 220, 220, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220,
+	230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 7, 0, 0, 0, 0, 0, 230, 230, 230, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+	7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230,
+	230, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+	0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 7,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 216, 216, 1, 1, 1, 0, 0,
+	0, 226, 216, 216, 216, 216, 216, 0, 0, 0, 0, 0,
+	0, 0, 0, 220, 220, 220, 220, 220, 220, 220, 220, 0,
+	0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0,
+	230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+	230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+	230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220,
+	220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#define NORM_DECOMP_LIMIT 0x2FA40
+
+static const guint8 norm_decomp_stage1[] = {
+	0, 0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 0,
+	0, 7, 8, 9, 10, 11, 0, 12, 0, 0, 0, 0,
+	13, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+	15, 16, 0, 17, 18, 19, 0, 0, 0, 20, 21, 22,
+	0, 23, 0, 24, 0, 25, 0, 26, 0, 0, 0, 0,
+	0, 27, 28, 0, 29, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	30, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 0, 0,
+	41, 0, 42, 43, 44, 45, 46, 47, 48, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 50, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0,
+	64, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0,
+	0, 0, 66, 0, 0, 0, 67, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 69, 70, 71, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 72, 73, 74, 75, 76, 77, 78, 79,
+	80,
+};
+
+static const guint16 norm_decomp_stage2[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 4, 7, 10, 13, 16, 0, 19,
+	22, 25, 28, 31, 34, 37, 40, 43, 0, 46, 49, 52,
+	55, 58, 61, 0, 0, 64, 67, 70, 73, 76, 0, 0,
+	79, 82, 85, 88, 91, 94, 0, 97, 100, 103, 106, 109,
+	112, 115, 118, 121, 0, 124, 127, 130, 133, 136, 139, 0,
+	0, 142, 145, 148, 151, 154, 0, 157, 160, 163, 166, 169,
+	172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205,
+	0, 0, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235,
+	238, 241, 244, 247, 250, 253, 256, 259, 262, 265, 0, 0,
+	268, 271, 274, 277, 280, 283, 286, 289, 292, 0, 0, 0,
+	295, 298, 301, 304, 0, 307, 310, 313, 316, 319, 322, 0,
+	0, 0, 0, 325, 328, 331, 334, 337, 340, 0, 0, 0,
+	343, 346, 349, 352, 355, 358, 0, 0, 361, 364, 367, 370,
+	373, 376, 379, 382, 385, 388, 391, 394, 397, 400, 403, 406,
+	409, 412, 0, 0, 415, 418, 421, 424, 427, 430, 433, 436,
+	439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472,
+	475, 478, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	484, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 490, 493, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 499, 502,
+	505, 508, 511, 514, 517, 520, 524, 528, 532, 536, 540, 544,
+	548, 0, 552, 556, 560, 564, 568, 571, 0, 0, 574, 577,
+	580, 583, 586, 589, 592, 596, 600, 603, 606, 0, 0, 0,
+	609, 612, 0, 0, 615, 618, 621, 625, 629, 632, 635, 638,
+	641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674,
+	677, 680, 683, 686, 689, 692, 695, 698, 701, 704, 707, 710,
+	713, 716, 719, 722, 0, 0, 725, 728, 0, 0, 0, 0,
+	0, 0, 731, 734, 737, 740, 743, 747, 751, 755, 759, 762,
+	765, 769, 773, 776, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 779, 781, 0, 783, 785, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 788, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 790, 0, 0, 0, 0, 0,
+	0, 792, 795, 798, 800, 803, 806, 0, 809, 0, 812, 815,
+	818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 822, 825, 828, 831, 834, 837, 840, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 847,
+	850, 853, 856, 0, 0, 0, 0, 859, 862, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 865, 868, 0, 871, 0, 0, 0, 874,
+	0, 0, 0, 0, 877, 880, 883, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	892, 895, 0, 898, 0, 0, 0, 901, 0, 0, 0, 0,
+	904, 907, 910, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 913, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 919, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 925, 928, 931, 934, 0, 0, 937, 940,
+	0, 0, 943, 946, 949, 952, 955, 958, 0, 0, 961, 964,
+	967, 970, 973, 976, 0, 0, 979, 982, 985, 988, 991, 994,
+	997, 1000, 1003, 1006, 1009, 1012, 0, 0, 1015, 1018, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1021, 1024, 1027, 1030, 1033, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1036, 0, 1039, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1045, 0, 0, 0, 0, 0, 0,
+	0, 1048, 0, 0, 1051, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1078, 1081, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1084, 1087, 0, 1090, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1093, 0, 0, 1096, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1099, 1102, 1105, 0, 0, 1108, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1111, 0, 0, 1114, 1117, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1120, 1123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1126, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1129, 1132, 1135, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1138, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1141, 0, 0, 0, 0, 0, 0, 1144, 1147, 0, 1150, 1153,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1157, 1160, 1163, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0,
+	1169, 1172, 1176, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1182, 0, 0, 0, 0, 1185, 0, 0, 0, 0, 1188,
+	0, 0, 0, 0, 1191, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1197, 0, 1200, 1203, 0, 1206, 0, 0, 0,
+	0, 0, 0, 0, 0, 1209, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1212,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 0, 0,
+	0, 0, 1218, 0, 0, 0, 0, 1221, 0, 0, 0, 0,
+	1224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1230, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1233, 0, 1236, 0, 1239, 0,
+	1242, 0, 1245, 0, 0, 0, 1248, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251,
+	0, 1254, 0, 0, 1257, 1260, 0, 1263, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1266, 1269, 1272, 1275,
+	1278, 1281, 1284, 1287, 1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+	1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340, 1344, 1347, 1350, 1353,
+	1356, 1360, 1364, 1367, 1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391,
+	1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416, 1420, 1423, 1426, 1429,
+	1432, 1435, 1438, 1441, 1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+	1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503,
+	1506, 1510, 1514, 1518, 1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547,
+	1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573, 1576, 1579, 1582, 1585,
+	1588, 1592, 1596, 1600, 1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+	1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654, 1658, 1662, 1666,
+	1670, 1673, 1676, 1679, 1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703,
+	1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727, 1730, 1733, 1736, 1739,
+	1742, 1745, 1748, 1751, 1754, 1757, 0, 1760, 0, 0, 0, 0,
+	1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787, 1791, 1795, 1799, 1803,
+	1807, 1811, 1815, 1819, 1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851,
+	1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877, 1881, 1885, 1889, 1893,
+	1897, 1901, 1905, 1909, 1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+	1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1981,
+	1985, 1989, 1993, 1997, 2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026,
+	2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057, 2061, 2065, 2069, 2072,
+	2075, 2078, 2081, 2084, 2087, 2090, 0, 0, 0, 0, 0, 0,
+	2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119, 2123, 2126, 2129, 2133,
+	2137, 2141, 2145, 2149, 2153, 2156, 2159, 2163, 2167, 2171, 0, 0,
+	2175, 2178, 2181, 2185, 2189, 2193, 0, 0, 2197, 2200, 2203, 2207,
+	2211, 2215, 2219, 2223, 2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+	2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283, 2287, 2290, 2293, 2297,
+	2301, 2305, 2309, 2313, 2317, 2320, 2323, 2327, 2331, 2335, 0, 0,
+	2339, 2342, 2345, 2349, 2353, 2357, 0, 0, 2361, 2364, 2367, 2371,
+	2375, 2379, 2383, 2387, 0, 2391, 0, 2394, 0, 2398, 0, 2402,
+	2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2439, 2442, 2446,
+	2450, 2454, 2458, 2462, 2466, 828, 2469, 831, 2472, 834, 2475, 837,
+	2478, 850, 2481, 853, 2484, 856, 0, 0, 2487, 2491, 2495, 2500,
+	2505, 2510, 2515, 2520, 2525, 2529, 2533, 2538, 2543, 2548, 2553, 2558,
+	2563, 2567, 2571, 2576, 2581, 2586, 2591, 2596, 2601, 2605, 2609, 2614,
+	2619, 2624, 2629, 2634, 2639, 2643, 2647, 2652, 2657, 2662, 2667, 2672,
+	2677, 2681, 2685, 2690, 2695, 2700, 2705, 2710, 2715, 2718, 2721, 2725,
+	2728, 0, 2732, 2735, 2739, 2742, 2745, 795, 2748, 0, 2751, 0,
+	0, 2753, 2756, 2760, 2763, 0, 2767, 2770, 2774, 800, 2777, 803,
+	2780, 2783, 2786, 2789, 2792, 2795, 2798, 818, 0, 0, 2802, 2805,
+	2809, 2812, 2815, 806, 0, 2818, 2821, 2824, 2827, 2830, 2833, 840,
+	2837, 2840, 2843, 2846, 2850, 2853, 2856, 812, 2859, 2862, 792, 2865,
+	0, 0, 2867, 2871, 2874, 0, 2878, 2881, 2885, 809, 2888, 815,
+	2891, 2894, 0, 0, 2896, 2898, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2900, 0,
+	0, 0, 2902, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2904, 2907, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2910, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2913, 2916, 2919, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2922, 0, 0, 0, 0, 2925, 0, 0, 2928, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2931, 0, 2934, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2937, 0, 0, 2940, 0, 0, 2943, 0, 2946, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2949, 0, 2952, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2955, 2958, 2961,
+	2964, 2967, 0, 0, 2970, 2973, 0, 0, 2976, 2979, 0, 0,
+	0, 0, 0, 0, 2982, 2985, 0, 0, 2988, 2991, 0, 0,
+	2994, 2997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3000, 3003, 3006, 3009, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3012, 3015, 3018, 3021, 0, 0, 0, 0,
+	0, 0, 3024, 3027, 3030, 3033, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3036, 3038, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3040, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3043, 0, 3046, 0,
+	3049, 0, 3052, 0, 3055, 0, 3058, 0, 3061, 0, 3064, 0,
+	3067, 0, 3070, 0, 3073, 0, 3076, 0, 0, 3079, 0, 3082,
+	0, 3085, 0, 0, 0, 0, 0, 0, 3088, 3091, 0, 3094,
+	3097, 0, 3100, 3103, 0, 3106, 3109, 0, 3112, 3115, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3118, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3121, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3124, 0, 3127, 0,
+	3130, 0, 3133, 0, 3136, 0, 3139, 0, 3142, 0, 3145, 0,
+	3148, 0, 3151, 0, 3154, 0, 3157, 0, 0, 3160, 0, 3163,
+	0, 3166, 0, 0, 0, 0, 0, 0, 3169, 3172, 0, 3175,
+	3178, 0, 3181, 3184, 0, 3187, 3190, 0, 3193, 3196, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3199, 0, 0, 3202,
+	3205, 3208, 3211, 0, 0, 0, 3214, 0, 3217, 3219, 3221, 3223,
+	3225, 3227, 3229, 3231, 3231, 3233, 3235, 3237, 3239, 3241, 3243, 3245,
+	3247, 3249, 3251, 3253, 3255, 3257, 3259, 3261, 3263, 3265, 3267, 3269,
+	3271, 3273, 3275, 3277, 3279, 3281, 3283, 3285, 3287, 3289, 3291, 3293,
+	3295, 3297, 3299, 3301, 3303, 3305, 3307, 3309, 3311, 3313, 3315, 3317,
+	3319, 3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335, 3337, 3339, 3341,
+	3343, 3345, 3347, 3349, 3351, 3353, 3355, 3357, 3359, 3361, 3363, 3365,
+	3367, 3369, 3371, 3373, 3375, 3377, 3379, 3381, 3383, 3385, 3387, 3389,
+	3391, 3393, 3395, 3397, 3255, 3399, 3401, 3403, 3405, 3407, 3409, 3411,
+	3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 3429, 3431, 3433, 3435,
+	3437, 3439, 3441, 3443, 3445, 3447, 3449, 3451, 3453, 3455, 3457, 3459,
+	3461, 3463, 3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479, 3481, 3483,
+	3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 3501, 3503, 3505, 3507,
+	3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527, 3529, 3531,
+	3533, 3435, 3535, 3537, 3539, 3541, 3543, 3545, 3547, 3549, 3403, 3551,
+	3553, 3555, 3557, 3559, 3561, 3563, 3565, 3567, 3569, 3571, 3573, 3575,
+	3577, 3579, 3581, 3583, 3585, 3587, 3589, 3255, 3591, 3593, 3595, 3597,
+	3599, 3601, 3603, 3605, 3607, 3609, 3611, 3613, 3615, 3617, 3619, 3621,
+	3623, 3625, 3627, 3629, 3631, 3633, 3635, 3637, 3639, 3641, 3643, 3407,
+	3645, 3647, 3649, 3651, 3653, 3655, 3657, 3659, 3661, 3663, 3665, 3667,
+	3669, 3671, 3673, 3675, 3677, 3679, 3681, 3683, 3685, 3687, 3689, 3691,
+	3693, 3695, 3697, 3699, 3701, 3703, 3705, 3707, 3709, 3711, 3713, 3715,
+	3717, 3719, 3721, 3723, 3725, 3727, 3729, 3731, 3733, 3735, 3737, 3739,
+	3741, 3743, 0, 0, 3745, 0, 3747, 0, 0, 3749, 3751, 3753,
+	3755, 3757, 3759, 3761, 3763, 3765, 3767, 0, 3769, 0, 3771, 0,
+	0, 3773, 3775, 0, 0, 0, 3777, 3779, 3781, 3783, 3785, 3787,
+	3789, 3791, 3793, 3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809, 3811,
+	3813, 3815, 3817, 3819, 3821, 3823, 3825, 3827, 3829, 3831, 3833, 3835,
+	3837, 3839, 3841, 3843, 3845, 3847, 3849, 3851, 3853, 3855, 3857, 3859,
+	3861, 3863, 3865, 3513, 3867, 3869, 3871, 3873, 3875, 3877, 3877, 3879,
+	3881, 3883, 3885, 3887, 3889, 3891, 3893, 3773, 3895, 3897, 3899, 3901,
+	3903, 3905, 0, 0, 3907, 3909, 3911, 3913, 3915, 3917, 3919, 3921,
+	3801, 3923, 3925, 3927, 3745, 3929, 3931, 3933, 3935, 3937, 3939, 3941,
+	3943, 3945, 3947, 3949, 3951, 3819, 3953, 3821, 3955, 3957, 3959, 3961,
+	3963, 3747, 3297, 3965, 3967, 3969, 3437, 3611, 3971, 3973, 3835, 3975,
+	3837, 3977, 3979, 3981, 3751, 3983, 3985, 3987, 3989, 3991, 3753, 3993,
+	3995, 3997, 3999, 4001, 4003, 3865, 4005, 4007, 3513, 4009, 3873, 4011,
+	4013, 4015, 4017, 4019, 3883, 4021, 3771, 4023, 3885, 3399, 4025, 3887,
+	4027, 3891, 4029, 4031, 4033, 4035, 4037, 3895, 3763, 4039, 3897, 4041,
+	3899, 4043, 3231, 4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059, 4061,
+	4063, 4065, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4067, 0, 4070,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4073, 4076,
+	4079, 4083, 4087, 4090, 4093, 4096, 4099, 4102, 4105, 4108, 4111, 0,
+	4114, 4117, 4120, 4123, 4126, 0, 4129, 0, 4132, 4135, 0, 4138,
+	4141, 0, 4144, 4147, 4150, 4153, 4156, 4159, 4162, 4165, 4168, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4171, 0, 4174, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4177, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4180, 4183, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4186, 4189, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4192,
+	4195, 0, 4198, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4201, 4204, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4207, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4210, 4213, 4216, 4220, 4224, 4228,
+	4232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4236, 4239, 4242, 4246, 4250, 4254, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4258, 4260, 4262, 4264, 4266, 3789, 4268, 4270, 4272, 4274, 3791, 4276,
+	4278, 4280, 3793, 4282, 4284, 4286, 4288, 4290, 4292, 4294, 4296, 4298,
+	4300, 4302, 4304, 3909, 4306, 4308, 4310, 4312, 4314, 4316, 4318, 4320,
+	4322, 3919, 3795, 3797, 3921, 4324, 4326, 3411, 4328, 3799, 4330, 4332,
+	4334, 4336, 4336, 4336, 4338, 4340, 4342, 4344, 4346, 4348, 4350, 4352,
+	4354, 4356, 4358, 4360, 4362, 4364, 4366, 4368, 4370, 4372, 4372, 3925,
+	4374, 4376, 4378, 4380, 3803, 4382, 4384, 4386, 3717, 4388, 4390, 4392,
+	4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414, 4416,
+	4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4438,
+	4440, 4442, 4444, 3403, 4446, 4448, 4450, 4452, 4454, 4456, 4458, 4460,
+	3813, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478, 4480, 4482,
+	4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500, 4502, 3295, 4504,
+	4506, 4508, 4508, 4510, 4512, 4512, 4514, 4516, 4518, 4520, 4522, 4524,
+	4526, 4528, 4530, 4532, 4534, 4536, 4538, 3815, 4540, 4542, 4544, 4546,
+	3949, 4546, 4548, 3819, 4550, 4552, 4554, 4556, 3821, 3241, 4558, 4560,
+	4562, 4564, 4566, 4568, 4570, 4572, 4574, 4576, 4578, 4580, 4582, 4584,
+	4586, 4588, 4590, 4592, 4594, 4596, 4598, 4600, 3823, 4602, 4604, 4606,
+	4608, 4610, 4612, 3827, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628,
+	3297, 3965, 4630, 4632, 4634, 4636, 4638, 4640, 4642, 4644, 3829, 4646,
+	4648, 4650, 4652, 4051, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668,
+	4670, 4672, 4674, 4676, 4678, 3437, 4680, 4682, 4684, 4686, 4688, 4690,
+	4692, 4694, 4696, 4698, 4700, 3831, 3611, 4702, 4704, 4706, 4708, 4710,
+	4712, 4714, 4716, 3973, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732,
+	3975, 4734, 4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754,
+	4756, 3979, 4758, 4760, 4762, 4764, 4766, 4768, 4770, 4772, 4774, 4776,
+	4778, 4778, 4780, 4782, 3983, 4784, 4786, 4788, 4790, 4792, 4794, 4796,
+	3409, 4798, 4800, 4802, 4804, 4806, 4808, 4810, 3995, 4812, 4814, 4816,
+	4818, 4820, 4822, 4822, 3997, 4055, 4824, 4826, 4828, 4830, 4832, 3333,
+	4001, 4834, 4836, 3853, 4838, 4840, 3761, 4842, 4844, 3861, 4846, 4848,
+	4850, 4852, 4852, 4854, 4856, 4858, 4860, 4862, 4864, 4866, 4868, 4870,
+	4872, 4874, 4876, 4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
+	4896, 4898, 4900, 4902, 4904, 4906, 3873, 4908, 4910, 4912, 4914, 4916,
+	4918, 4920, 4922, 4924, 4926, 4928, 4930, 4932, 4934, 4936, 4938, 4510,
+	4940, 4942, 4944, 4946, 4948, 4950, 4952, 4954, 4956, 4958, 4960, 4962,
+	3445, 4964, 4966, 4968, 4970, 4972, 4974, 3879, 4976, 4978, 4980, 4982,
+	4984, 4986, 4988, 4990, 4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006,
+	5008, 5010, 5012, 5014, 3323, 5016, 5018, 5020, 5022, 5024, 5026, 4015,
+	5028, 5030, 5032, 5034, 5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050,
+	5052, 5054, 5056, 5058, 5060, 5062, 5064, 5066, 4025, 4027, 5068, 5070,
+	5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086, 5088, 5090, 5092, 4029,
+	5094, 5096, 5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116,
+	5118, 5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140,
+	5142, 5144, 5146, 5148, 5150, 5152, 4041, 4041, 5154, 5156, 5158, 5160,
+	5162, 5164, 5166, 5168, 5170, 5172, 4043, 5174, 5176, 5178, 5180, 5182,
+	5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206,
+	5208, 5210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const glui32 norm_decomp_data[] = {
+	0x0000, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002,
+	0x0041, 0x0302, 0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308,
+	0x0002, 0x0041, 0x030A, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045,
+	0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002,
+	0x0045, 0x0308, 0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301,
+	0x0002, 0x0049, 0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x004E,
+	0x0303, 0x0002, 0x004F, 0x0300, 0x0002, 0x004F, 0x0301, 0x0002,
+	0x004F, 0x0302, 0x0002, 0x004F, 0x0303, 0x0002, 0x004F, 0x0308,
+	0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301, 0x0002, 0x0055,
+	0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002,
+	0x0061, 0x0300, 0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302,
+	0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061,
+	0x030A, 0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002,
+	0x0065, 0x0301, 0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308,
+	0x0002, 0x0069, 0x0300, 0x0002, 0x0069, 0x0301, 0x0002, 0x0069,
+	0x0302, 0x0002, 0x0069, 0x0308, 0x0002, 0x006E, 0x0303, 0x0002,
+	0x006F, 0x0300, 0x0002, 0x006F, 0x0301, 0x0002, 0x006F, 0x0302,
+	0x0002, 0x006F, 0x0303, 0x0002, 0x006F, 0x0308, 0x0002, 0x0075,
+	0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002,
+	0x0075, 0x0308, 0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308,
+	0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041,
+	0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002,
+	0x0061, 0x0328, 0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301,
+	0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302, 0x0002, 0x0043,
+	0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030C, 0x0002,
+	0x0063, 0x030C, 0x0002, 0x0044, 0x030C, 0x0002, 0x0064, 0x030C,
+	0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304, 0x0002, 0x0045,
+	0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002,
+	0x0065, 0x0307, 0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328,
+	0x0002, 0x0045, 0x030C, 0x0002, 0x0065, 0x030C, 0x0002, 0x0047,
+	0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002,
+	0x0067, 0x0306, 0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307,
+	0x0002, 0x0047, 0x0327, 0x0002, 0x0067, 0x0327, 0x0002, 0x0048,
+	0x0302, 0x0002, 0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002,
+	0x0069, 0x0303, 0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304,
+	0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306, 0x0002, 0x0049,
+	0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002,
+	0x004A, 0x0302, 0x0002, 0x006A, 0x0302, 0x0002, 0x004B, 0x0327,
+	0x0002, 0x006B, 0x0327, 0x0002, 0x004C, 0x0301, 0x0002, 0x006C,
+	0x0301, 0x0002, 0x004C, 0x0327, 0x0002, 0x006C, 0x0327, 0x0002,
+	0x004C, 0x030C, 0x0002, 0x006C, 0x030C, 0x0002, 0x004E, 0x0301,
+	0x0002, 0x006E, 0x0301, 0x0002, 0x004E, 0x0327, 0x0002, 0x006E,
+	0x0327, 0x0002, 0x004E, 0x030C, 0x0002, 0x006E, 0x030C, 0x0002,
+	0x004F, 0x0304, 0x0002, 0x006F, 0x0304, 0x0002, 0x004F, 0x0306,
+	0x0002, 0x006F, 0x0306, 0x0002, 0x004F, 0x030B, 0x0002, 0x006F,
+	0x030B, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301, 0x0002,
+	0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030C,
+	0x0002, 0x0072, 0x030C, 0x0002, 0x0053, 0x0301, 0x0002, 0x0073,
+	0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302, 0x0002,
+	0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053, 0x030C,
+	0x0002, 0x0073, 0x030C, 0x0002, 0x0054, 0x0327, 0x0002, 0x0074,
+	0x0327, 0x0002, 0x0054, 0x030C, 0x0002, 0x0074, 0x030C, 0x0002,
+	0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304,
+	0x0002, 0x0075, 0x0304, 0x0002, 0x0055, 0x0306, 0x0002, 0x0075,
+	0x0306, 0x0002, 0x0055, 0x030A, 0x0002, 0x0075, 0x030A, 0x0002,
+	0x0055, 0x030B, 0x0002, 0x0075, 0x030B, 0x0002, 0x0055, 0x0328,
+	0x0002, 0x0075, 0x0328, 0x0002, 0x0057, 0x0302, 0x0002, 0x0077,
+	0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302, 0x0002,
+	0x0059, 0x0308, 0x0002, 0x005A, 0x0301, 0x0002, 0x007A, 0x0301,
+	0x0002, 0x005A, 0x0307, 0x0002, 0x007A, 0x0307, 0x0002, 0x005A,
+	0x030C, 0x0002, 0x007A, 0x030C, 0x0002, 0x004F, 0x031B, 0x0002,
+	0x006F, 0x031B, 0x0002, 0x0055, 0x031B, 0x0002, 0x0075, 0x031B,
+	0x0002, 0x0041, 0x030C, 0x0002, 0x0061, 0x030C, 0x0002, 0x0049,
+	0x030C, 0x0002, 0x0069, 0x030C, 0x0002, 0x004F, 0x030C, 0x0002,
+	0x006F, 0x030C, 0x0002, 0x0055, 0x030C, 0x0002, 0x0075, 0x030C,
+	0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308, 0x0304,
+	0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301,
+	0x0003, 0x0055, 0x0308, 0x030C, 0x0003, 0x0075, 0x0308, 0x030C,
+	0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308, 0x0300,
+	0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304,
+	0x0003, 0x0041, 0x0307, 0x0304, 0x0003, 0x0061, 0x0307, 0x0304,
+	0x0002, 0x00C6, 0x0304, 0x0002, 0x00E6, 0x0304, 0x0002, 0x0047,
+	0x030C, 0x0002, 0x0067, 0x030C, 0x0002, 0x004B, 0x030C, 0x0002,
+	0x006B, 0x030C, 0x0002, 0x004F, 0x0328, 0x0002, 0x006F, 0x0328,
+	0x0003, 0x004F, 0x0328, 0x0304, 0x0003, 0x006F, 0x0328, 0x0304,
+	0x0002, 0x01B7, 0x030C, 0x0002, 0x0292, 0x030C, 0x0002, 0x006A,
+	0x030C, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002,
+	0x004E, 0x0300, 0x0002, 0x006E, 0x0300, 0x0003, 0x0041, 0x030A,
+	0x0301, 0x0003, 0x0061, 0x030A, 0x0301, 0x0002, 0x00C6, 0x0301,
+	0x0002, 0x00E6, 0x0301, 0x0002, 0x00D8, 0x0301, 0x0002, 0x00F8,
+	0x0301, 0x0002, 0x0041, 0x030F, 0x0002, 0x0061, 0x030F, 0x0002,
+	0x0041, 0x0311, 0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030F,
+	0x0002, 0x0065, 0x030F, 0x0002, 0x0045, 0x0311, 0x0002, 0x0065,
+	0x0311, 0x0002, 0x0049, 0x030F, 0x0002, 0x0069, 0x030F, 0x0002,
+	0x0049, 0x0311, 0x0002, 0x0069, 0x0311, 0x0002, 0x004F, 0x030F,
+	0x0002, 0x006F, 0x030F, 0x0002, 0x004F, 0x0311, 0x0002, 0x006F,
+	0x0311, 0x0002, 0x0052, 0x030F, 0x0002, 0x0072, 0x030F, 0x0002,
+	0x0052, 0x0311, 0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030F,
+	0x0002, 0x0075, 0x030F, 0x0002, 0x0055, 0x0311, 0x0002, 0x0075,
+	0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002,
+	0x0054, 0x0326, 0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030C,
+	0x0002, 0x0068, 0x030C, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061,
+	0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003,
+	0x004F, 0x0308, 0x0304, 0x0003, 0x006F, 0x0308, 0x0304, 0x0003,
+	0x004F, 0x0303, 0x0304, 0x0003, 0x006F, 0x0303, 0x0304, 0x0002,
+	0x004F, 0x0307, 0x0002, 0x006F, 0x0307, 0x0003, 0x004F, 0x0307,
+	0x0304, 0x0003, 0x006F, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304,
+	0x0002, 0x0079, 0x0304, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001,
+	0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02B9, 0x0001, 0x003B,
+	0x0002, 0x00A8, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00B7,
+	0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0301, 0x0002, 0x0399,
+	0x0301, 0x0002, 0x039F, 0x0301, 0x0002, 0x03A5, 0x0301, 0x0002,
+	0x03A9, 0x0301, 0x0003, 0x03B9, 0x0308, 0x0301, 0x0002, 0x0399,
+	0x0308, 0x0002, 0x03A5, 0x0308, 0x0002, 0x03B1, 0x0301, 0x0002,
+	0x03B5, 0x0301, 0x0002, 0x03B7, 0x0301, 0x0002, 0x03B9, 0x0301,
+	0x0003, 0x03C5, 0x0308, 0x0301, 0x0002, 0x03B9, 0x0308, 0x0002,
+	0x03C5, 0x0308, 0x0002, 0x03BF, 0x0301, 0x0002, 0x03C5, 0x0301,
+	0x0002, 0x03C9, 0x0301, 0x0002, 0x03D2, 0x0301, 0x0002, 0x03D2,
+	0x0308, 0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002,
+	0x0413, 0x0301, 0x0002, 0x0406, 0x0308, 0x0002, 0x041A, 0x0301,
+	0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418,
+	0x0306, 0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002,
+	0x0435, 0x0308, 0x0002, 0x0433, 0x0301, 0x0002, 0x0456, 0x0308,
+	0x0002, 0x043A, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443,
+	0x0306, 0x0002, 0x0474, 0x030F, 0x0002, 0x0475, 0x030F, 0x0002,
+	0x0416, 0x0306, 0x0002, 0x0436, 0x0306, 0x0002, 0x0410, 0x0306,
+	0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430,
+	0x0308, 0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002,
+	0x04D8, 0x0308, 0x0002, 0x04D9, 0x0308, 0x0002, 0x0416, 0x0308,
+	0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437,
+	0x0308, 0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002,
+	0x0418, 0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041E, 0x0308,
+	0x0002, 0x043E, 0x0308, 0x0002, 0x04E8, 0x0308, 0x0002, 0x04E9,
+	0x0308, 0x0002, 0x042D, 0x0308, 0x0002, 0x044D, 0x0308, 0x0002,
+	0x0423, 0x0304, 0x0002, 0x0443, 0x0304, 0x0002, 0x0423, 0x0308,
+	0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030B, 0x0002, 0x0443,
+	0x030B, 0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002,
+	0x042B, 0x0308, 0x0002, 0x044B, 0x0308, 0x0002, 0x0627, 0x0653,
+	0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654, 0x0002, 0x0627,
+	0x0655, 0x0002, 0x064A, 0x0654, 0x0002, 0x06D5, 0x0654, 0x0002,
+	0x06C1, 0x0654, 0x0002, 0x06D2, 0x0654, 0x0002, 0x0928, 0x093C,
+	0x0002, 0x0930, 0x093C, 0x0002, 0x0933, 0x093C, 0x0002, 0x0915,
+	0x093C, 0x0002, 0x0916, 0x093C, 0x0002, 0x0917, 0x093C, 0x0002,
+	0x091C, 0x093C, 0x0002, 0x0921, 0x093C, 0x0002, 0x0922, 0x093C,
+	0x0002, 0x092B, 0x093C, 0x0002, 0x092F, 0x093C, 0x0002, 0x09C7,
+	0x09BE, 0x0002, 0x09C7, 0x09D7, 0x0002, 0x09A1, 0x09BC, 0x0002,
+	0x09A2, 0x09BC, 0x0002, 0x09AF, 0x09BC, 0x0002, 0x0A32, 0x0A3C,
+	0x0002, 0x0A38, 0x0A3C, 0x0002, 0x0A16, 0x0A3C, 0x0002, 0x0A17,
+	0x0A3C, 0x0002, 0x0A1C, 0x0A3C, 0x0002, 0x0A2B, 0x0A3C, 0x0002,
+	0x0B47, 0x0B56, 0x0002, 0x0B47, 0x0B3E, 0x0002, 0x0B47, 0x0B57,
+	0x0002, 0x0B21, 0x0B3C, 0x0002, 0x0B22, 0x0B3C, 0x0002, 0x0B92,
+	0x0BD7, 0x0002, 0x0BC6, 0x0BBE, 0x0002, 0x0BC7, 0x0BBE, 0x0002,
+	0x0BC6, 0x0BD7, 0x0002, 0x0C46, 0x0C56, 0x0002, 0x0CBF, 0x0CD5,
+	0x0002, 0x0CC6, 0x0CD5, 0x0002, 0x0CC6, 0x0CD6, 0x0002, 0x0CC6,
+	0x0CC2, 0x0003, 0x0CC6, 0x0CC2, 0x0CD5, 0x0002, 0x0D46, 0x0D3E,
+	0x0002, 0x0D47, 0x0D3E, 0x0002, 0x0D46, 0x0D57, 0x0002, 0x0DD9,
+	0x0DCA, 0x0002, 0x0DD9, 0x0DCF, 0x0003, 0x0DD9, 0x0DCF, 0x0DCA,
+	0x0002, 0x0DD9, 0x0DDF, 0x0002, 0x0F42, 0x0FB7, 0x0002, 0x0F4C,
+	0x0FB7, 0x0002, 0x0F51, 0x0FB7, 0x0002, 0x0F56, 0x0FB7, 0x0002,
+	0x0F5B, 0x0FB7, 0x0002, 0x0F40, 0x0FB5, 0x0002, 0x0F71, 0x0F72,
+	0x0002, 0x0F71, 0x0F74, 0x0002, 0x0FB2, 0x0F80, 0x0002, 0x0FB3,
+	0x0F80, 0x0002, 0x0F71, 0x0F80, 0x0002, 0x0F92, 0x0FB7, 0x0002,
+	0x0F9C, 0x0FB7, 0x0002, 0x0FA1, 0x0FB7, 0x0002, 0x0FA6, 0x0FB7,
+	0x0002, 0x0FAB, 0x0FB7, 0x0002, 0x0F90, 0x0FB5, 0x0002, 0x1025,
+	0x102E, 0x0002, 0x1B05, 0x1B35, 0x0002, 0x1B07, 0x1B35, 0x0002,
+	0x1B09, 0x1B35, 0x0002, 0x1B0B, 0x1B35, 0x0002, 0x1B0D, 0x1B35,
+	0x0002, 0x1B11, 0x1B35, 0x0002, 0x1B3A, 0x1B35, 0x0002, 0x1B3C,
+	0x1B35, 0x0002, 0x1B3E, 0x1B35, 0x0002, 0x1B3F, 0x1B35, 0x0002,
+	0x1B42, 0x1B35, 0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325,
+	0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042,
+	0x0323, 0x0002, 0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002,
+	0x0062, 0x0331, 0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063,
+	0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307,
+	0x0002, 0x0044, 0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044,
+	0x0331, 0x0002, 0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002,
+	0x0064, 0x0327, 0x0002, 0x0044, 0x032D, 0x0002, 0x0064, 0x032D,
+	0x0003, 0x0045, 0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300,
+	0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301,
+	0x0002, 0x0045, 0x032D, 0x0002, 0x0065, 0x032D, 0x0002, 0x0045,
+	0x0330, 0x0002, 0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306,
+	0x0003, 0x0065, 0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002,
+	0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304,
+	0x0002, 0x0048, 0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048,
+	0x0323, 0x0002, 0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002,
+	0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327,
+	0x0002, 0x0048, 0x032E, 0x0002, 0x0068, 0x032E, 0x0002, 0x0049,
+	0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301,
+	0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004B, 0x0301, 0x0002,
+	0x006B, 0x0301, 0x0002, 0x004B, 0x0323, 0x0002, 0x006B, 0x0323,
+	0x0002, 0x004B, 0x0331, 0x0002, 0x006B, 0x0331, 0x0002, 0x004C,
+	0x0323, 0x0002, 0x006C, 0x0323, 0x0003, 0x004C, 0x0323, 0x0304,
+	0x0003, 0x006C, 0x0323, 0x0304, 0x0002, 0x004C, 0x0331, 0x0002,
+	0x006C, 0x0331, 0x0002, 0x004C, 0x032D, 0x0002, 0x006C, 0x032D,
+	0x0002, 0x004D, 0x0301, 0x0002, 0x006D, 0x0301, 0x0002, 0x004D,
+	0x0307, 0x0002, 0x006D, 0x0307, 0x0002, 0x004D, 0x0323, 0x0002,
+	0x006D, 0x0323, 0x0002, 0x004E, 0x0307, 0x0002, 0x006E, 0x0307,
+	0x0002, 0x004E, 0x0323, 0x0002, 0x006E, 0x0323, 0x0002, 0x004E,
+	0x0331, 0x0002, 0x006E, 0x0331, 0x0002, 0x004E, 0x032D, 0x0002,
+	0x006E, 0x032D, 0x0003, 0x004F, 0x0303, 0x0301, 0x0003, 0x006F,
+	0x0303, 0x0301, 0x0003, 0x004F, 0x0303, 0x0308, 0x0003, 0x006F,
+	0x0303, 0x0308, 0x0003, 0x004F, 0x0304, 0x0300, 0x0003, 0x006F,
+	0x0304, 0x0300, 0x0003, 0x004F, 0x0304, 0x0301, 0x0003, 0x006F,
+	0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301,
+	0x0002, 0x0050, 0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052,
+	0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002,
+	0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072,
+	0x0323, 0x0304, 0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331,
+	0x0002, 0x0053, 0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053,
+	0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307,
+	0x0003, 0x0073, 0x0301, 0x0307, 0x0003, 0x0053, 0x030C, 0x0307,
+	0x0003, 0x0073, 0x030C, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307,
+	0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002,
+	0x0074, 0x0307, 0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323,
+	0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054,
+	0x032D, 0x0002, 0x0074, 0x032D, 0x0002, 0x0055, 0x0324, 0x0002,
+	0x0075, 0x0324, 0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330,
+	0x0002, 0x0055, 0x032D, 0x0002, 0x0075, 0x032D, 0x0003, 0x0055,
+	0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055,
+	0x0304, 0x0308, 0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056,
+	0x0303, 0x0002, 0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002,
+	0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300,
+	0x0002, 0x0057, 0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057,
+	0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002,
+	0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323,
+	0x0002, 0x0058, 0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058,
+	0x0308, 0x0002, 0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002,
+	0x0079, 0x0307, 0x0002, 0x005A, 0x0302, 0x0002, 0x007A, 0x0302,
+	0x0002, 0x005A, 0x0323, 0x0002, 0x007A, 0x0323, 0x0002, 0x005A,
+	0x0331, 0x0002, 0x007A, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002,
+	0x0074, 0x0308, 0x0002, 0x0077, 0x030A, 0x0002, 0x0079, 0x030A,
+	0x0002, 0x017F, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002, 0x0061,
+	0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301, 0x0003,
+	0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300, 0x0003,
+	0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309, 0x0003,
+	0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303, 0x0003,
+	0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302, 0x0003,
+	0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301, 0x0003,
+	0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300, 0x0003,
+	0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309, 0x0003,
+	0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303, 0x0003,
+	0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306, 0x0002,
+	0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045, 0x0309,
+	0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002, 0x0065,
+	0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065, 0x0302,
+	0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065, 0x0302,
+	0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065, 0x0302,
+	0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065, 0x0302,
+	0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065, 0x0323,
+	0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309, 0x0002,
+	0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004F, 0x0323,
+	0x0002, 0x006F, 0x0323, 0x0002, 0x004F, 0x0309, 0x0002, 0x006F,
+	0x0309, 0x0003, 0x004F, 0x0302, 0x0301, 0x0003, 0x006F, 0x0302,
+	0x0301, 0x0003, 0x004F, 0x0302, 0x0300, 0x0003, 0x006F, 0x0302,
+	0x0300, 0x0003, 0x004F, 0x0302, 0x0309, 0x0003, 0x006F, 0x0302,
+	0x0309, 0x0003, 0x004F, 0x0302, 0x0303, 0x0003, 0x006F, 0x0302,
+	0x0303, 0x0003, 0x004F, 0x0323, 0x0302, 0x0003, 0x006F, 0x0323,
+	0x0302, 0x0003, 0x004F, 0x031B, 0x0301, 0x0003, 0x006F, 0x031B,
+	0x0301, 0x0003, 0x004F, 0x031B, 0x0300, 0x0003, 0x006F, 0x031B,
+	0x0300, 0x0003, 0x004F, 0x031B, 0x0309, 0x0003, 0x006F, 0x031B,
+	0x0309, 0x0003, 0x004F, 0x031B, 0x0303, 0x0003, 0x006F, 0x031B,
+	0x0303, 0x0003, 0x004F, 0x031B, 0x0323, 0x0003, 0x006F, 0x031B,
+	0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323, 0x0002,
+	0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055, 0x031B,
+	0x0301, 0x0003, 0x0075, 0x031B, 0x0301, 0x0003, 0x0055, 0x031B,
+	0x0300, 0x0003, 0x0075, 0x031B, 0x0300, 0x0003, 0x0055, 0x031B,
+	0x0309, 0x0003, 0x0075, 0x031B, 0x0309, 0x0003, 0x0055, 0x031B,
+	0x0303, 0x0003, 0x0075, 0x031B, 0x0303, 0x0003, 0x0055, 0x031B,
+	0x0323, 0x0003, 0x0075, 0x031B, 0x0323, 0x0002, 0x0059, 0x0300,
+	0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002, 0x0079,
+	0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309, 0x0002,
+	0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03B1, 0x0313,
+	0x0002, 0x03B1, 0x0314, 0x0003, 0x03B1, 0x0313, 0x0300, 0x0003,
+	0x03B1, 0x0314, 0x0300, 0x0003, 0x03B1, 0x0313, 0x0301, 0x0003,
+	0x03B1, 0x0314, 0x0301, 0x0003, 0x03B1, 0x0313, 0x0342, 0x0003,
+	0x03B1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002, 0x0391,
+	0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391, 0x0314,
+	0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391, 0x0314,
+	0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314,
+	0x0342, 0x0002, 0x03B5, 0x0313, 0x0002, 0x03B5, 0x0314, 0x0003,
+	0x03B5, 0x0313, 0x0300, 0x0003, 0x03B5, 0x0314, 0x0300, 0x0003,
+	0x03B5, 0x0313, 0x0301, 0x0003, 0x03B5, 0x0314, 0x0301, 0x0002,
+	0x0395, 0x0313, 0x0002, 0x0395, 0x0314, 0x0003, 0x0395, 0x0313,
+	0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395, 0x0313,
+	0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03B7, 0x0313,
+	0x0002, 0x03B7, 0x0314, 0x0003, 0x03B7, 0x0313, 0x0300, 0x0003,
+	0x03B7, 0x0314, 0x0300, 0x0003, 0x03B7, 0x0313, 0x0301, 0x0003,
+	0x03B7, 0x0314, 0x0301, 0x0003, 0x03B7, 0x0313, 0x0342, 0x0003,
+	0x03B7, 0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002, 0x0397,
+	0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397, 0x0314,
+	0x0300, 0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397, 0x0314,
+	0x0301, 0x0003, 0x0397, 0x0313, 0x0342, 0x0003, 0x0397, 0x0314,
+	0x0342, 0x0002, 0x03B9, 0x0313, 0x0002, 0x03B9, 0x0314, 0x0003,
+	0x03B9, 0x0313, 0x0300, 0x0003, 0x03B9, 0x0314, 0x0300, 0x0003,
+	0x03B9, 0x0313, 0x0301, 0x0003, 0x03B9, 0x0314, 0x0301, 0x0003,
+	0x03B9, 0x0313, 0x0342, 0x0003, 0x03B9, 0x0314, 0x0342, 0x0002,
+	0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313,
+	0x0300, 0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399, 0x0313,
+	0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399, 0x0313,
+	0x0342, 0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03BF, 0x0313,
+	0x0002, 0x03BF, 0x0314, 0x0003, 0x03BF, 0x0313, 0x0300, 0x0003,
+	0x03BF, 0x0314, 0x0300, 0x0003, 0x03BF, 0x0313, 0x0301, 0x0003,
+	0x03BF, 0x0314, 0x0301, 0x0002, 0x039F, 0x0313, 0x0002, 0x039F,
+	0x0314, 0x0003, 0x039F, 0x0313, 0x0300, 0x0003, 0x039F, 0x0314,
+	0x0300, 0x0003, 0x039F, 0x0313, 0x0301, 0x0003, 0x039F, 0x0314,
+	0x0301, 0x0002, 0x03C5, 0x0313, 0x0002, 0x03C5, 0x0314, 0x0003,
+	0x03C5, 0x0313, 0x0300, 0x0003, 0x03C5, 0x0314, 0x0300, 0x0003,
+	0x03C5, 0x0313, 0x0301, 0x0003, 0x03C5, 0x0314, 0x0301, 0x0003,
+	0x03C5, 0x0313, 0x0342, 0x0003, 0x03C5, 0x0314, 0x0342, 0x0002,
+	0x03A5, 0x0314, 0x0003, 0x03A5, 0x0314, 0x0300, 0x0003, 0x03A5,
+	0x0314, 0x0301, 0x0003, 0x03A5, 0x0314, 0x0342, 0x0002, 0x03C9,
+	0x0313, 0x0002, 0x03C9, 0x0314, 0x0003, 0x03C9, 0x0313, 0x0300,
+	0x0003, 0x03C9, 0x0314, 0x0300, 0x0003, 0x03C9, 0x0313, 0x0301,
+	0x0003, 0x03C9, 0x0314, 0x0301, 0x0003, 0x03C9, 0x0313, 0x0342,
+	0x0003, 0x03C9, 0x0314, 0x0342, 0x0002, 0x03A9, 0x0313, 0x0002,
+	0x03A9, 0x0314, 0x0003, 0x03A9, 0x0313, 0x0300, 0x0003, 0x03A9,
+	0x0314, 0x0300, 0x0003, 0x03A9, 0x0313, 0x0301, 0x0003, 0x03A9,
+	0x0314, 0x0301, 0x0003, 0x03A9, 0x0313, 0x0342, 0x0003, 0x03A9,
+	0x0314, 0x0342, 0x0002, 0x03B1, 0x0300, 0x0002, 0x03B5, 0x0300,
+	0x0002, 0x03B7, 0x0300, 0x0002, 0x03B9, 0x0300, 0x0002, 0x03BF,
+	0x0300, 0x0002, 0x03C5, 0x0300, 0x0002, 0x03C9, 0x0300, 0x0003,
+	0x03B1, 0x0313, 0x0345, 0x0003, 0x03B1, 0x0314, 0x0345, 0x0004,
+	0x03B1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0300,
+	0x0345, 0x0004, 0x03B1, 0x0313, 0x0301, 0x0345, 0x0004, 0x03B1,
+	0x0314, 0x0301, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0342, 0x0345,
+	0x0004, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0003, 0x0391, 0x0313,
+	0x0345, 0x0003, 0x0391, 0x0314, 0x0345, 0x0004, 0x0391, 0x0313,
+	0x0300, 0x0345, 0x0004, 0x0391, 0x0314, 0x0300, 0x0345, 0x0004,
+	0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314, 0x0301,
+	0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345, 0x0004, 0x0391,
+	0x0314, 0x0342, 0x0345, 0x0003, 0x03B7, 0x0313, 0x0345, 0x0003,
+	0x03B7, 0x0314, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0300, 0x0345,
+	0x0004, 0x03B7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03B7, 0x0313,
+	0x0301, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0301, 0x0345, 0x0004,
+	0x03B7, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B7, 0x0314, 0x0342,
+	0x0345, 0x0003, 0x0397, 0x0313, 0x0345, 0x0003, 0x0397, 0x0314,
+	0x0345, 0x0004, 0x0397, 0x0313, 0x0300, 0x0345, 0x0004, 0x0397,
+	0x0314, 0x0300, 0x0345, 0x0004, 0x0397, 0x0313, 0x0301, 0x0345,
+	0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004, 0x0397, 0x0313,
+	0x0342, 0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345, 0x0003,
+	0x03C9, 0x0313, 0x0345, 0x0003, 0x03C9, 0x0314, 0x0345, 0x0004,
+	0x03C9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03C9, 0x0314, 0x0300,
+	0x0345, 0x0004, 0x03C9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03C9,
+	0x0314, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0342, 0x0345,
+	0x0004, 0x03C9, 0x0314, 0x0342, 0x0345, 0x0003, 0x03A9, 0x0313,
+	0x0345, 0x0003, 0x03A9, 0x0314, 0x0345, 0x0004, 0x03A9, 0x0313,
+	0x0300, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0300, 0x0345, 0x0004,
+	0x03A9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0301,
+	0x0345, 0x0004, 0x03A9, 0x0313, 0x0342, 0x0345, 0x0004, 0x03A9,
+	0x0314, 0x0342, 0x0345, 0x0002, 0x03B1, 0x0306, 0x0002, 0x03B1,
+	0x0304, 0x0003, 0x03B1, 0x0300, 0x0345, 0x0002, 0x03B1, 0x0345,
+	0x0003, 0x03B1, 0x0301, 0x0345, 0x0002, 0x03B1, 0x0342, 0x0003,
+	0x03B1, 0x0342, 0x0345, 0x0002, 0x0391, 0x0306, 0x0002, 0x0391,
+	0x0304, 0x0002, 0x0391, 0x0300, 0x0002, 0x0391, 0x0345, 0x0001,
+	0x03B9, 0x0002, 0x00A8, 0x0342, 0x0003, 0x03B7, 0x0300, 0x0345,
+	0x0002, 0x03B7, 0x0345, 0x0003, 0x03B7, 0x0301, 0x0345, 0x0002,
+	0x03B7, 0x0342, 0x0003, 0x03B7, 0x0342, 0x0345, 0x0002, 0x0395,
+	0x0300, 0x0002, 0x0397, 0x0300, 0x0002, 0x0397, 0x0345, 0x0002,
+	0x1FBF, 0x0300, 0x0002, 0x1FBF, 0x0301, 0x0002, 0x1FBF, 0x0342,
+	0x0002, 0x03B9, 0x0306, 0x0002, 0x03B9, 0x0304, 0x0003, 0x03B9,
+	0x0308, 0x0300, 0x0002, 0x03B9, 0x0342, 0x0003, 0x03B9, 0x0308,
+	0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002,
+	0x0399, 0x0300, 0x0002, 0x1FFE, 0x0300, 0x0002, 0x1FFE, 0x0301,
+	0x0002, 0x1FFE, 0x0342, 0x0002, 0x03C5, 0x0306, 0x0002, 0x03C5,
+	0x0304, 0x0003, 0x03C5, 0x0308, 0x0300, 0x0002, 0x03C1, 0x0313,
+	0x0002, 0x03C1, 0x0314, 0x0002, 0x03C5, 0x0342, 0x0003, 0x03C5,
+	0x0308, 0x0342, 0x0002, 0x03A5, 0x0306, 0x0002, 0x03A5, 0x0304,
+	0x0002, 0x03A5, 0x0300, 0x0002, 0x03A1, 0x0314, 0x0002, 0x00A8,
+	0x0300, 0x0001, 0x0060, 0x0003, 0x03C9, 0x0300, 0x0345, 0x0002,
+	0x03C9, 0x0345, 0x0003, 0x03C9, 0x0301, 0x0345, 0x0002, 0x03C9,
+	0x0342, 0x0003, 0x03C9, 0x0342, 0x0345, 0x0002, 0x039F, 0x0300,
+	0x0002, 0x03A9, 0x0300, 0x0002, 0x03A9, 0x0345, 0x0001, 0x00B4,
+	0x0001, 0x2002, 0x0001, 0x2003, 0x0001, 0x03A9, 0x0001, 0x004B,
+	0x0002, 0x2190, 0x0338, 0x0002, 0x2192, 0x0338, 0x0002, 0x2194,
+	0x0338, 0x0002, 0x21D0, 0x0338, 0x0002, 0x21D4, 0x0338, 0x0002,
+	0x21D2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338,
+	0x0002, 0x220B, 0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225,
+	0x0338, 0x0002, 0x223C, 0x0338, 0x0002, 0x2243, 0x0338, 0x0002,
+	0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003D, 0x0338,
+	0x0002, 0x2261, 0x0338, 0x0002, 0x224D, 0x0338, 0x0002, 0x003C,
+	0x0338, 0x0002, 0x003E, 0x0338, 0x0002, 0x2264, 0x0338, 0x0002,
+	0x2265, 0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338,
+	0x0002, 0x2276, 0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227A,
+	0x0338, 0x0002, 0x227B, 0x0338, 0x0002, 0x2282, 0x0338, 0x0002,
+	0x2283, 0x0338, 0x0002, 0x2286, 0x0338, 0x0002, 0x2287, 0x0338,
+	0x0002, 0x22A2, 0x0338, 0x0002, 0x22A8, 0x0338, 0x0002, 0x22A9,
+	0x0338, 0x0002, 0x22AB, 0x0338, 0x0002, 0x227C, 0x0338, 0x0002,
+	0x227D, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292, 0x0338,
+	0x0002, 0x22B2, 0x0338, 0x0002, 0x22B3, 0x0338, 0x0002, 0x22B4,
+	0x0338, 0x0002, 0x22B5, 0x0338, 0x0001, 0x3008, 0x0001, 0x3009,
+	0x0002, 0x2ADD, 0x0338, 0x0002, 0x304B, 0x3099, 0x0002, 0x304D,
+	0x3099, 0x0002, 0x304F, 0x3099, 0x0002, 0x3051, 0x3099, 0x0002,
+	0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057, 0x3099,
+	0x0002, 0x3059, 0x3099, 0x0002, 0x305B, 0x3099, 0x0002, 0x305D,
+	0x3099, 0x0002, 0x305F, 0x3099, 0x0002, 0x3061, 0x3099, 0x0002,
+	0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068, 0x3099,
+	0x0002, 0x306F, 0x3099, 0x0002, 0x306F, 0x309A, 0x0002, 0x3072,
+	0x3099, 0x0002, 0x3072, 0x309A, 0x0002, 0x3075, 0x3099, 0x0002,
+	0x3075, 0x309A, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078, 0x309A,
+	0x0002, 0x307B, 0x3099, 0x0002, 0x307B, 0x309A, 0x0002, 0x3046,
+	0x3099, 0x0002, 0x309D, 0x3099, 0x0002, 0x30AB, 0x3099, 0x0002,
+	0x30AD, 0x3099, 0x0002, 0x30AF, 0x3099, 0x0002, 0x30B1, 0x3099,
+	0x0002, 0x30B3, 0x3099, 0x0002, 0x30B5, 0x3099, 0x0002, 0x30B7,
+	0x3099, 0x0002, 0x30B9, 0x3099, 0x0002, 0x30BB, 0x3099, 0x0002,
+	0x30BD, 0x3099, 0x0002, 0x30BF, 0x3099, 0x0002, 0x30C1, 0x3099,
+	0x0002, 0x30C4, 0x3099, 0x0002, 0x30C6, 0x3099, 0x0002, 0x30C8,
+	0x3099, 0x0002, 0x30CF, 0x3099, 0x0002, 0x30CF, 0x309A, 0x0002,
+	0x30D2, 0x3099, 0x0002, 0x30D2, 0x309A, 0x0002, 0x30D5, 0x3099,
+	0x0002, 0x30D5, 0x309A, 0x0002, 0x30D8, 0x3099, 0x0002, 0x30D8,
+	0x309A, 0x0002, 0x30DB, 0x3099, 0x0002, 0x30DB, 0x309A, 0x0002,
+	0x30A6, 0x3099, 0x0002, 0x30EF, 0x3099, 0x0002, 0x30F0, 0x3099,
+	0x0002, 0x30F1, 0x3099, 0x0002, 0x30F2, 0x3099, 0x0002, 0x30FD,
+	0x3099, 0x0001, 0x8C48, 0x0001, 0x66F4, 0x0001, 0x8ECA, 0x0001,
+	0x8CC8, 0x0001, 0x6ED1, 0x0001, 0x4E32, 0x0001, 0x53E5, 0x0001,
+	0x9F9C, 0x0001, 0x5951, 0x0001, 0x91D1, 0x0001, 0x5587, 0x0001,
+	0x5948, 0x0001, 0x61F6, 0x0001, 0x7669, 0x0001, 0x7F85, 0x0001,
+	0x863F, 0x0001, 0x87BA, 0x0001, 0x88F8, 0x0001, 0x908F, 0x0001,
+	0x6A02, 0x0001, 0x6D1B, 0x0001, 0x70D9, 0x0001, 0x73DE, 0x0001,
+	0x843D, 0x0001, 0x916A, 0x0001, 0x99F1, 0x0001, 0x4E82, 0x0001,
+	0x5375, 0x0001, 0x6B04, 0x0001, 0x721B, 0x0001, 0x862D, 0x0001,
+	0x9E1E, 0x0001, 0x5D50, 0x0001, 0x6FEB, 0x0001, 0x85CD, 0x0001,
+	0x8964, 0x0001, 0x62C9, 0x0001, 0x81D8, 0x0001, 0x881F, 0x0001,
+	0x5ECA, 0x0001, 0x6717, 0x0001, 0x6D6A, 0x0001, 0x72FC, 0x0001,
+	0x90CE, 0x0001, 0x4F86, 0x0001, 0x51B7, 0x0001, 0x52DE, 0x0001,
+	0x64C4, 0x0001, 0x6AD3, 0x0001, 0x7210, 0x0001, 0x76E7, 0x0001,
+	0x8001, 0x0001, 0x8606, 0x0001, 0x865C, 0x0001, 0x8DEF, 0x0001,
+	0x9732, 0x0001, 0x9B6F, 0x0001, 0x9DFA, 0x0001, 0x788C, 0x0001,
+	0x797F, 0x0001, 0x7DA0, 0x0001, 0x83C9, 0x0001, 0x9304, 0x0001,
+	0x9E7F, 0x0001, 0x8AD6, 0x0001, 0x58DF, 0x0001, 0x5F04, 0x0001,
+	0x7C60, 0x0001, 0x807E, 0x0001, 0x7262, 0x0001, 0x78CA, 0x0001,
+	0x8CC2, 0x0001, 0x96F7, 0x0001, 0x58D8, 0x0001, 0x5C62, 0x0001,
+	0x6A13, 0x0001, 0x6DDA, 0x0001, 0x6F0F, 0x0001, 0x7D2F, 0x0001,
+	0x7E37, 0x0001, 0x964B, 0x0001, 0x52D2, 0x0001, 0x808B, 0x0001,
+	0x51DC, 0x0001, 0x51CC, 0x0001, 0x7A1C, 0x0001, 0x7DBE, 0x0001,
+	0x83F1, 0x0001, 0x9675, 0x0001, 0x8B80, 0x0001, 0x62CF, 0x0001,
+	0x8AFE, 0x0001, 0x4E39, 0x0001, 0x5BE7, 0x0001, 0x6012, 0x0001,
+	0x7387, 0x0001, 0x7570, 0x0001, 0x5317, 0x0001, 0x78FB, 0x0001,
+	0x4FBF, 0x0001, 0x5FA9, 0x0001, 0x4E0D, 0x0001, 0x6CCC, 0x0001,
+	0x6578, 0x0001, 0x7D22, 0x0001, 0x53C3, 0x0001, 0x585E, 0x0001,
+	0x7701, 0x0001, 0x8449, 0x0001, 0x8AAA, 0x0001, 0x6BBA, 0x0001,
+	0x8FB0, 0x0001, 0x6C88, 0x0001, 0x62FE, 0x0001, 0x82E5, 0x0001,
+	0x63A0, 0x0001, 0x7565, 0x0001, 0x4EAE, 0x0001, 0x5169, 0x0001,
+	0x51C9, 0x0001, 0x6881, 0x0001, 0x7CE7, 0x0001, 0x826F, 0x0001,
+	0x8AD2, 0x0001, 0x91CF, 0x0001, 0x52F5, 0x0001, 0x5442, 0x0001,
+	0x5973, 0x0001, 0x5EEC, 0x0001, 0x65C5, 0x0001, 0x6FFE, 0x0001,
+	0x792A, 0x0001, 0x95AD, 0x0001, 0x9A6A, 0x0001, 0x9E97, 0x0001,
+	0x9ECE, 0x0001, 0x529B, 0x0001, 0x66C6, 0x0001, 0x6B77, 0x0001,
+	0x8F62, 0x0001, 0x5E74, 0x0001, 0x6190, 0x0001, 0x6200, 0x0001,
+	0x649A, 0x0001, 0x6F23, 0x0001, 0x7149, 0x0001, 0x7489, 0x0001,
+	0x79CA, 0x0001, 0x7DF4, 0x0001, 0x806F, 0x0001, 0x8F26, 0x0001,
+	0x84EE, 0x0001, 0x9023, 0x0001, 0x934A, 0x0001, 0x5217, 0x0001,
+	0x52A3, 0x0001, 0x54BD, 0x0001, 0x70C8, 0x0001, 0x88C2, 0x0001,
+	0x5EC9, 0x0001, 0x5FF5, 0x0001, 0x637B, 0x0001, 0x6BAE, 0x0001,
+	0x7C3E, 0x0001, 0x7375, 0x0001, 0x4EE4, 0x0001, 0x56F9, 0x0001,
+	0x5DBA, 0x0001, 0x601C, 0x0001, 0x73B2, 0x0001, 0x7469, 0x0001,
+	0x7F9A, 0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96F6, 0x0001,
+	0x9748, 0x0001, 0x9818, 0x0001, 0x4F8B, 0x0001, 0x79AE, 0x0001,
+	0x91B4, 0x0001, 0x96B8, 0x0001, 0x60E1, 0x0001, 0x4E86, 0x0001,
+	0x50DA, 0x0001, 0x5BEE, 0x0001, 0x5C3F, 0x0001, 0x6599, 0x0001,
+	0x71CE, 0x0001, 0x7642, 0x0001, 0x84FC, 0x0001, 0x907C, 0x0001,
+	0x9F8D, 0x0001, 0x6688, 0x0001, 0x962E, 0x0001, 0x5289, 0x0001,
+	0x677B, 0x0001, 0x67F3, 0x0001, 0x6D41, 0x0001, 0x6E9C, 0x0001,
+	0x7409, 0x0001, 0x7559, 0x0001, 0x786B, 0x0001, 0x7D10, 0x0001,
+	0x985E, 0x0001, 0x516D, 0x0001, 0x622E, 0x0001, 0x9678, 0x0001,
+	0x502B, 0x0001, 0x5D19, 0x0001, 0x6DEA, 0x0001, 0x8F2A, 0x0001,
+	0x5F8B, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001, 0x9686, 0x0001,
+	0x5229, 0x0001, 0x540F, 0x0001, 0x5C65, 0x0001, 0x6613, 0x0001,
+	0x674E, 0x0001, 0x68A8, 0x0001, 0x6CE5, 0x0001, 0x7406, 0x0001,
+	0x75E2, 0x0001, 0x7F79, 0x0001, 0x88CF, 0x0001, 0x88E1, 0x0001,
+	0x91CC, 0x0001, 0x96E2, 0x0001, 0x533F, 0x0001, 0x6EBA, 0x0001,
+	0x541D, 0x0001, 0x71D0, 0x0001, 0x7498, 0x0001, 0x85FA, 0x0001,
+	0x96A3, 0x0001, 0x9C57, 0x0001, 0x9E9F, 0x0001, 0x6797, 0x0001,
+	0x6DCB, 0x0001, 0x81E8, 0x0001, 0x7ACB, 0x0001, 0x7B20, 0x0001,
+	0x7C92, 0x0001, 0x72C0, 0x0001, 0x7099, 0x0001, 0x8B58, 0x0001,
+	0x4EC0, 0x0001, 0x8336, 0x0001, 0x523A, 0x0001, 0x5207, 0x0001,
+	0x5EA6, 0x0001, 0x62D3, 0x0001, 0x7CD6, 0x0001, 0x5B85, 0x0001,
+	0x6D1E, 0x0001, 0x66B4, 0x0001, 0x8F3B, 0x0001, 0x884C, 0x0001,
+	0x964D, 0x0001, 0x898B, 0x0001, 0x5ED3, 0x0001, 0x5140, 0x0001,
+	0x55C0, 0x0001, 0x585A, 0x0001, 0x6674, 0x0001, 0x51DE, 0x0001,
+	0x732A, 0x0001, 0x76CA, 0x0001, 0x793C, 0x0001, 0x795E, 0x0001,
+	0x7965, 0x0001, 0x798F, 0x0001, 0x9756, 0x0001, 0x7CBE, 0x0001,
+	0x7FBD, 0x0001, 0x8612, 0x0001, 0x8AF8, 0x0001, 0x9038, 0x0001,
+	0x90FD, 0x0001, 0x98EF, 0x0001, 0x98FC, 0x0001, 0x9928, 0x0001,
+	0x9DB4, 0x0001, 0x90DE, 0x0001, 0x96B7, 0x0001, 0x4FAE, 0x0001,
+	0x50E7, 0x0001, 0x514D, 0x0001, 0x52C9, 0x0001, 0x52E4, 0x0001,
+	0x5351, 0x0001, 0x559D, 0x0001, 0x5606, 0x0001, 0x5668, 0x0001,
+	0x5840, 0x0001, 0x58A8, 0x0001, 0x5C64, 0x0001, 0x5C6E, 0x0001,
+	0x6094, 0x0001, 0x6168, 0x0001, 0x618E, 0x0001, 0x61F2, 0x0001,
+	0x654F, 0x0001, 0x65E2, 0x0001, 0x6691, 0x0001, 0x6885, 0x0001,
+	0x6D77, 0x0001, 0x6E1A, 0x0001, 0x6F22, 0x0001, 0x716E, 0x0001,
+	0x722B, 0x0001, 0x7422, 0x0001, 0x7891, 0x0001, 0x793E, 0x0001,
+	0x7949, 0x0001, 0x7948, 0x0001, 0x7950, 0x0001, 0x7956, 0x0001,
+	0x795D, 0x0001, 0x798D, 0x0001, 0x798E, 0x0001, 0x7A40, 0x0001,
+	0x7A81, 0x0001, 0x7BC0, 0x0001, 0x7E09, 0x0001, 0x7E41, 0x0001,
+	0x7F72, 0x0001, 0x8005, 0x0001, 0x81ED, 0x0001, 0x8279, 0x0001,
+	0x8457, 0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8B01, 0x0001,
+	0x8B39, 0x0001, 0x8CD3, 0x0001, 0x8D08, 0x0001, 0x8FB6, 0x0001,
+	0x96E3, 0x0001, 0x97FF, 0x0001, 0x983B, 0x0001, 0x6075, 0x0001,
+	0x242EE, 0x0001, 0x8218, 0x0001, 0x4E26, 0x0001, 0x51B5, 0x0001,
+	0x5168, 0x0001, 0x4F80, 0x0001, 0x5145, 0x0001, 0x5180, 0x0001,
+	0x52C7, 0x0001, 0x52FA, 0x0001, 0x5555, 0x0001, 0x5599, 0x0001,
+	0x55E2, 0x0001, 0x58B3, 0x0001, 0x5944, 0x0001, 0x5954, 0x0001,
+	0x5A62, 0x0001, 0x5B28, 0x0001, 0x5ED2, 0x0001, 0x5ED9, 0x0001,
+	0x5F69, 0x0001, 0x5FAD, 0x0001, 0x60D8, 0x0001, 0x614E, 0x0001,
+	0x6108, 0x0001, 0x6160, 0x0001, 0x6234, 0x0001, 0x63C4, 0x0001,
+	0x641C, 0x0001, 0x6452, 0x0001, 0x6556, 0x0001, 0x671B, 0x0001,
+	0x6756, 0x0001, 0x6B79, 0x0001, 0x6EDB, 0x0001, 0x6ECB, 0x0001,
+	0x701E, 0x0001, 0x77A7, 0x0001, 0x7235, 0x0001, 0x72AF, 0x0001,
+	0x7471, 0x0001, 0x7506, 0x0001, 0x753B, 0x0001, 0x761D, 0x0001,
+	0x761F, 0x0001, 0x76DB, 0x0001, 0x76F4, 0x0001, 0x774A, 0x0001,
+	0x7740, 0x0001, 0x78CC, 0x0001, 0x7AB1, 0x0001, 0x7C7B, 0x0001,
+	0x7D5B, 0x0001, 0x7F3E, 0x0001, 0x8352, 0x0001, 0x83EF, 0x0001,
+	0x8779, 0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8ABF, 0x0001,
+	0x8ACB, 0x0001, 0x8AED, 0x0001, 0x8B8A, 0x0001, 0x8F38, 0x0001,
+	0x9072, 0x0001, 0x9199, 0x0001, 0x9276, 0x0001, 0x967C, 0x0001,
+	0x97DB, 0x0001, 0x980B, 0x0001, 0x9B12, 0x0001, 0x2284A, 0x0001,
+	0x22844, 0x0001, 0x233D5, 0x0001, 0x3B9D, 0x0001, 0x4018, 0x0001,
+	0x4039, 0x0001, 0x25249, 0x0001, 0x25CD0, 0x0001, 0x27ED3, 0x0001,
+	0x9F43, 0x0001, 0x9F8E, 0x0002, 0x05D9, 0x05B4, 0x0002, 0x05F2,
+	0x05B7, 0x0002, 0x05E9, 0x05C1, 0x0002, 0x05E9, 0x05C2, 0x0003,
+	0x05E9, 0x05BC, 0x05C1, 0x0003, 0x05E9, 0x05BC, 0x05C2, 0x0002,
+	0x05D0, 0x05B7, 0x0002, 0x05D0, 0x05B8, 0x0002, 0x05D0, 0x05BC,
+	0x0002, 0x05D1, 0x05BC, 0x0002, 0x05D2, 0x05BC, 0x0002, 0x05D3,
+	0x05BC, 0x0002, 0x05D4, 0x05BC, 0x0002, 0x05D5, 0x05BC, 0x0002,
+	0x05D6, 0x05BC, 0x0002, 0x05D8, 0x05BC, 0x0002, 0x05D9, 0x05BC,
+	0x0002, 0x05DA, 0x05BC, 0x0002, 0x05DB, 0x05BC, 0x0002, 0x05DC,
+	0x05BC, 0x0002, 0x05DE, 0x05BC, 0x0002, 0x05E0, 0x05BC, 0x0002,
+	0x05E1, 0x05BC, 0x0002, 0x05E3, 0x05BC, 0x0002, 0x05E4, 0x05BC,
+	0x0002, 0x05E6, 0x05BC, 0x0002, 0x05E7, 0x05BC, 0x0002, 0x05E8,
+	0x05BC, 0x0002, 0x05E9, 0x05BC, 0x0002, 0x05EA, 0x05BC, 0x0002,
+	0x05D5, 0x05B9, 0x0002, 0x05D1, 0x05BF, 0x0002, 0x05DB, 0x05BF,
+	0x0002, 0x05E4, 0x05BF, 0x0002, 0x11099, 0x110BA, 0x0002, 0x1109B,
+	0x110BA, 0x0002, 0x110A5, 0x110BA, 0x0002, 0x11131, 0x11127, 0x0002,
+	0x11132, 0x11127, 0x0002, 0x11347, 0x1133E, 0x0002, 0x11347, 0x11357,
+	0x0002, 0x114B9, 0x114BA, 0x0002, 0x114B9, 0x114B0, 0x0002, 0x114B9,
+	0x114BD, 0x0002, 0x115B8, 0x115AF, 0x0002, 0x115B9, 0x115AF, 0x0002,
+	0x11935, 0x11930, 0x0002, 0x1D157, 0x1D165, 0x0002, 0x1D158, 0x1D165,
+	0x0003, 0x1D158, 0x1D165, 0x1D16E, 0x0003, 0x1D158, 0x1D165, 0x1D16F,
+	0x0003, 0x1D158, 0x1D165, 0x1D170, 0x0003, 0x1D158, 0x1D165, 0x1D171,
+	0x0003, 0x1D158, 0x1D165, 0x1D172, 0x0002, 0x1D1B9, 0x1D165, 0x0002,
+	0x1D1BA, 0x1D165, 0x0003, 0x1D1B9, 0x1D165, 0x1D16E, 0x0003, 0x1D1BA,
+	0x1D165, 0x1D16E, 0x0003, 0x1D1B9, 0x1D165, 0x1D16F, 0x0003, 0x1D1BA,
+	0x1D165, 0x1D16F, 0x0001, 0x4E3D, 0x0001, 0x4E38, 0x0001, 0x4E41,
+	0x0001, 0x20122, 0x0001, 0x4F60, 0x0001, 0x4FBB, 0x0001, 0x5002,
+	0x0001, 0x507A, 0x0001, 0x5099, 0x0001, 0x50CF, 0x0001, 0x349E,
+	0x0001, 0x2063A, 0x0001, 0x5154, 0x0001, 0x5164, 0x0001, 0x5177,
+	0x0001, 0x2051C, 0x0001, 0x34B9, 0x0001, 0x5167, 0x0001, 0x518D,
+	0x0001, 0x2054B, 0x0001, 0x5197, 0x0001, 0x51A4, 0x0001, 0x4ECC,
+	0x0001, 0x51AC, 0x0001, 0x291DF, 0x0001, 0x51F5, 0x0001, 0x5203,
+	0x0001, 0x34DF, 0x0001, 0x523B, 0x0001, 0x5246, 0x0001, 0x5272,
+	0x0001, 0x5277, 0x0001, 0x3515, 0x0001, 0x5305, 0x0001, 0x5306,
+	0x0001, 0x5349, 0x0001, 0x535A, 0x0001, 0x5373, 0x0001, 0x537D,
+	0x0001, 0x537F, 0x0001, 0x20A2C, 0x0001, 0x7070, 0x0001, 0x53CA,
+	0x0001, 0x53DF, 0x0001, 0x20B63, 0x0001, 0x53EB, 0x0001, 0x53F1,
+	0x0001, 0x5406, 0x0001, 0x549E, 0x0001, 0x5438, 0x0001, 0x5448,
+	0x0001, 0x5468, 0x0001, 0x54A2, 0x0001, 0x54F6, 0x0001, 0x5510,
+	0x0001, 0x5553, 0x0001, 0x5563, 0x0001, 0x5584, 0x0001, 0x55AB,
+	0x0001, 0x55B3, 0x0001, 0x55C2, 0x0001, 0x5716, 0x0001, 0x5717,
+	0x0001, 0x5651, 0x0001, 0x5674, 0x0001, 0x58EE, 0x0001, 0x57CE,
+	0x0001, 0x57F4, 0x0001, 0x580D, 0x0001, 0x578B, 0x0001, 0x5832,
+	0x0001, 0x5831, 0x0001, 0x58AC, 0x0001, 0x214E4, 0x0001, 0x58F2,
+	0x0001, 0x58F7, 0x0001, 0x5906, 0x0001, 0x591A, 0x0001, 0x5922,
+	0x0001, 0x5962, 0x0001, 0x216A8, 0x0001, 0x216EA, 0x0001, 0x59EC,
+	0x0001, 0x5A1B, 0x0001, 0x5A27, 0x0001, 0x59D8, 0x0001, 0x5A66,
+	0x0001, 0x36EE, 0x0001, 0x36FC, 0x0001, 0x5B08, 0x0001, 0x5B3E,
+	0x0001, 0x219C8, 0x0001, 0x5BC3, 0x0001, 0x5BD8, 0x0001, 0x5BF3,
+	0x0001, 0x21B18, 0x0001, 0x5BFF, 0x0001, 0x5C06, 0x0001, 0x5F53,
+	0x0001, 0x5C22, 0x0001, 0x3781, 0x0001, 0x5C60, 0x0001, 0x5CC0,
+	0x0001, 0x5C8D, 0x0001, 0x21DE4, 0x0001, 0x5D43, 0x0001, 0x21DE6,
+	0x0001, 0x5D6E, 0x0001, 0x5D6B, 0x0001, 0x5D7C, 0x0001, 0x5DE1,
+	0x0001, 0x5DE2, 0x0001, 0x382F, 0x0001, 0x5DFD, 0x0001, 0x5E28,
+	0x0001, 0x5E3D, 0x0001, 0x5E69, 0x0001, 0x3862, 0x0001, 0x22183,
+	0x0001, 0x387C, 0x0001, 0x5EB0, 0x0001, 0x5EB3, 0x0001, 0x5EB6,
+	0x0001, 0x2A392, 0x0001, 0x5EFE, 0x0001, 0x22331, 0x0001, 0x8201,
+	0x0001, 0x5F22, 0x0001, 0x38C7, 0x0001, 0x232B8, 0x0001, 0x261DA,
+	0x0001, 0x5F62, 0x0001, 0x5F6B, 0x0001, 0x38E3, 0x0001, 0x5F9A,
+	0x0001, 0x5FCD, 0x0001, 0x5FD7, 0x0001, 0x5FF9, 0x0001, 0x6081,
+	0x0001, 0x393A, 0x0001, 0x391C, 0x0001, 0x226D4, 0x0001, 0x60C7,
+	0x0001, 0x6148, 0x0001, 0x614C, 0x0001, 0x617A, 0x0001, 0x61B2,
+	0x0001, 0x61A4, 0x0001, 0x61AF, 0x0001, 0x61DE, 0x0001, 0x6210,
+	0x0001, 0x621B, 0x0001, 0x625D, 0x0001, 0x62B1, 0x0001, 0x62D4,
+	0x0001, 0x6350, 0x0001, 0x22B0C, 0x0001, 0x633D, 0x0001, 0x62FC,
+	0x0001, 0x6368, 0x0001, 0x6383, 0x0001, 0x63E4, 0x0001, 0x22BF1,
+	0x0001, 0x6422, 0x0001, 0x63C5, 0x0001, 0x63A9, 0x0001, 0x3A2E,
+	0x0001, 0x6469, 0x0001, 0x647E, 0x0001, 0x649D, 0x0001, 0x6477,
+	0x0001, 0x3A6C, 0x0001, 0x656C, 0x0001, 0x2300A, 0x0001, 0x65E3,
+	0x0001, 0x66F8, 0x0001, 0x6649, 0x0001, 0x3B19, 0x0001, 0x3B08,
+	0x0001, 0x3AE4, 0x0001, 0x5192, 0x0001, 0x5195, 0x0001, 0x6700,
+	0x0001, 0x669C, 0x0001, 0x80AD, 0x0001, 0x43D9, 0x0001, 0x6721,
+	0x0001, 0x675E, 0x0001, 0x6753, 0x0001, 0x233C3, 0x0001, 0x3B49,
+	0x0001, 0x67FA, 0x0001, 0x6785, 0x0001, 0x6852, 0x0001, 0x2346D,
+	0x0001, 0x688E, 0x0001, 0x681F, 0x0001, 0x6914, 0x0001, 0x6942,
+	0x0001, 0x69A3, 0x0001, 0x69EA, 0x0001, 0x6AA8, 0x0001, 0x236A3,
+	0x0001, 0x6ADB, 0x0001, 0x3C18, 0x0001, 0x6B21, 0x0001, 0x238A7,
+	0x0001, 0x6B54, 0x0001, 0x3C4E, 0x0001, 0x6B72, 0x0001, 0x6B9F,
+	0x0001, 0x6BBB, 0x0001, 0x23A8D, 0x0001, 0x21D0B, 0x0001, 0x23AFA,
+	0x0001, 0x6C4E, 0x0001, 0x23CBC, 0x0001, 0x6CBF, 0x0001, 0x6CCD,
+	0x0001, 0x6C67, 0x0001, 0x6D16, 0x0001, 0x6D3E, 0x0001, 0x6D69,
+	0x0001, 0x6D78, 0x0001, 0x6D85, 0x0001, 0x23D1E, 0x0001, 0x6D34,
+	0x0001, 0x6E2F, 0x0001, 0x6E6E, 0x0001, 0x3D33, 0x0001, 0x6EC7,
+	0x0001, 0x23ED1, 0x0001, 0x6DF9, 0x0001, 0x6F6E, 0x0001, 0x23F5E,
+	0x0001, 0x23F8E, 0x0001, 0x6FC6, 0x0001, 0x7039, 0x0001, 0x701B,
+	0x0001, 0x3D96, 0x0001, 0x704A, 0x0001, 0x707D, 0x0001, 0x7077,
+	0x0001, 0x70AD, 0x0001, 0x20525, 0x0001, 0x7145, 0x0001, 0x24263,
+	0x0001, 0x719C, 0x0001, 0x243AB, 0x0001, 0x7228, 0x0001, 0x7250,
+	0x0001, 0x24608, 0x0001, 0x7280, 0x0001, 0x7295, 0x0001, 0x24735,
+	0x0001, 0x24814, 0x0001, 0x737A, 0x0001, 0x738B, 0x0001, 0x3EAC,
+	0x0001, 0x73A5, 0x0001, 0x3EB8, 0x0001, 0x7447, 0x0001, 0x745C,
+	0x0001, 0x7485, 0x0001, 0x74CA, 0x0001, 0x3F1B, 0x0001, 0x7524,
+	0x0001, 0x24C36, 0x0001, 0x753E, 0x0001, 0x24C92, 0x0001, 0x2219F,
+	0x0001, 0x7610, 0x0001, 0x24FA1, 0x0001, 0x24FB8, 0x0001, 0x25044,
+	0x0001, 0x3FFC, 0x0001, 0x4008, 0x0001, 0x250F3, 0x0001, 0x250F2,
+	0x0001, 0x25119, 0x0001, 0x25133, 0x0001, 0x771E, 0x0001, 0x771F,
+	0x0001, 0x778B, 0x0001, 0x4046, 0x0001, 0x4096, 0x0001, 0x2541D,
+	0x0001, 0x784E, 0x0001, 0x40E3, 0x0001, 0x25626, 0x0001, 0x2569A,
+	0x0001, 0x256C5, 0x0001, 0x79EB, 0x0001, 0x412F, 0x0001, 0x7A4A,
+	0x0001, 0x7A4F, 0x0001, 0x2597C, 0x0001, 0x25AA7, 0x0001, 0x7AEE,
+	0x0001, 0x4202, 0x0001, 0x25BAB, 0x0001, 0x7BC6, 0x0001, 0x7BC9,
+	0x0001, 0x4227, 0x0001, 0x25C80, 0x0001, 0x7CD2, 0x0001, 0x42A0,
+	0x0001, 0x7CE8, 0x0001, 0x7CE3, 0x0001, 0x7D00, 0x0001, 0x25F86,
+	0x0001, 0x7D63, 0x0001, 0x4301, 0x0001, 0x7DC7, 0x0001, 0x7E02,
+	0x0001, 0x7E45, 0x0001, 0x4334, 0x0001, 0x26228, 0x0001, 0x26247,
+	0x0001, 0x4359, 0x0001, 0x262D9, 0x0001, 0x7F7A, 0x0001, 0x2633E,
+	0x0001, 0x7F95, 0x0001, 0x7FFA, 0x0001, 0x264DA, 0x0001, 0x26523,
+	0x0001, 0x8060, 0x0001, 0x265A8, 0x0001, 0x8070, 0x0001, 0x2335F,
+	0x0001, 0x43D5, 0x0001, 0x80B2, 0x0001, 0x8103, 0x0001, 0x440B,
+	0x0001, 0x813E, 0x0001, 0x5AB5, 0x0001, 0x267A7, 0x0001, 0x267B5,
+	0x0001, 0x23393, 0x0001, 0x2339C, 0x0001, 0x8204, 0x0001, 0x8F9E,
+	0x0001, 0x446B, 0x0001, 0x8291, 0x0001, 0x828B, 0x0001, 0x829D,
+	0x0001, 0x52B3, 0x0001, 0x82B1, 0x0001, 0x82B3, 0x0001, 0x82BD,
+	0x0001, 0x82E6, 0x0001, 0x26B3C, 0x0001, 0x831D, 0x0001, 0x8363,
+	0x0001, 0x83AD, 0x0001, 0x8323, 0x0001, 0x83BD, 0x0001, 0x83E7,
+	0x0001, 0x8353, 0x0001, 0x83CA, 0x0001, 0x83CC, 0x0001, 0x83DC,
+	0x0001, 0x26C36, 0x0001, 0x26D6B, 0x0001, 0x26CD5, 0x0001, 0x452B,
+	0x0001, 0x84F1, 0x0001, 0x84F3, 0x0001, 0x8516, 0x0001, 0x273CA,
+	0x0001, 0x8564, 0x0001, 0x26F2C, 0x0001, 0x455D, 0x0001, 0x4561,
+	0x0001, 0x26FB1, 0x0001, 0x270D2, 0x0001, 0x456B, 0x0001, 0x8650,
+	0x0001, 0x8667, 0x0001, 0x8669, 0x0001, 0x86A9, 0x0001, 0x8688,
+	0x0001, 0x870E, 0x0001, 0x86E2, 0x0001, 0x8728, 0x0001, 0x876B,
+	0x0001, 0x8786, 0x0001, 0x45D7, 0x0001, 0x87E1, 0x0001, 0x8801,
+	0x0001, 0x45F9, 0x0001, 0x8860, 0x0001, 0x8863, 0x0001, 0x27667,
+	0x0001, 0x88D7, 0x0001, 0x88DE, 0x0001, 0x4635, 0x0001, 0x88FA,
+	0x0001, 0x34BB, 0x0001, 0x278AE, 0x0001, 0x27966, 0x0001, 0x46BE,
+	0x0001, 0x46C7, 0x0001, 0x8AA0, 0x0001, 0x8C55, 0x0001, 0x27CA8,
+	0x0001, 0x8CAB, 0x0001, 0x8CC1, 0x0001, 0x8D1B, 0x0001, 0x8D77,
+	0x0001, 0x27F2F, 0x0001, 0x20804, 0x0001, 0x8DCB, 0x0001, 0x8DBC,
+	0x0001, 0x8DF0, 0x0001, 0x208DE, 0x0001, 0x8ED4, 0x0001, 0x285D2,
+	0x0001, 0x285ED, 0x0001, 0x9094, 0x0001, 0x90F1, 0x0001, 0x9111,
+	0x0001, 0x2872E, 0x0001, 0x911B, 0x0001, 0x9238, 0x0001, 0x92D7,
+	0x0001, 0x92D8, 0x0001, 0x927C, 0x0001, 0x93F9, 0x0001, 0x9415,
+	0x0001, 0x28BFA, 0x0001, 0x958B, 0x0001, 0x4995, 0x0001, 0x95B7,
+	0x0001, 0x28D77, 0x0001, 0x49E6, 0x0001, 0x96C3, 0x0001, 0x5DB2,
+	0x0001, 0x9723, 0x0001, 0x29145, 0x0001, 0x2921A, 0x0001, 0x4A6E,
+	0x0001, 0x4A76, 0x0001, 0x97E0, 0x0001, 0x2940A, 0x0001, 0x4AB2,
+	0x0001, 0x29496, 0x0001, 0x9829, 0x0001, 0x295B6, 0x0001, 0x98E2,
+	0x0001, 0x4B33, 0x0001, 0x9929, 0x0001, 0x99A7, 0x0001, 0x99C2,
+	0x0001, 0x99FE, 0x0001, 0x4BCE, 0x0001, 0x29B30, 0x0001, 0x9C40,
+	0x0001, 0x9CFD, 0x0001, 0x4CCE, 0x0001, 0x4CED, 0x0001, 0x9D67,
+	0x0001, 0x2A0CE, 0x0001, 0x4CF8, 0x0001, 0x2A105, 0x0001, 0x2A20E,
+	0x0001, 0x2A291, 0x0001, 0x9EBB, 0x0001, 0x4D56, 0x0001, 0x9EF9,
+	0x0001, 0x9EFE, 0x0001, 0x9F05, 0x0001, 0x9F0F, 0x0001, 0x9F16,
+	0x0001, 0x9F3B, 0x0001, 0x2A600,
+};
+
+/* Primary composites, sorted by first and then second character */
+static const CompositionPair norm_compositions[] = {
+	{ 0x003C, 0x0338, 0x226E },
+	{ 0x003D, 0x0338, 0x2260 },
+	{ 0x003E, 0x0338, 0x226F },
+	{ 0x0041, 0x0300, 0x00C0 },
+	{ 0x0041, 0x0301, 0x00C1 },
+	{ 0x0041, 0x0302, 0x00C2 },
+	{ 0x0041, 0x0303, 0x00C3 },
+	{ 0x0041, 0x0304, 0x0100 },
+	{ 0x0041, 0x0306, 0x0102 },
+	{ 0x0041, 0x0307, 0x0226 },
+	{ 0x0041, 0x0308, 0x00C4 },
+	{ 0x0041, 0x0309, 0x1EA2 },
+	{ 0x0041, 0x030A, 0x00C5 },
+	{ 0x0041, 0x030C, 0x01CD },
+	{ 0x0041, 0x030F, 0x0200 },
+	{ 0x0041, 0x0311, 0x0202 },
+	{ 0x0041, 0x0323, 0x1EA0 },
+	{ 0x0041, 0x0325, 0x1E00 },
+	{ 0x0041, 0x0328, 0x0104 },
+	{ 0x0042, 0x0307, 0x1E02 },
+	{ 0x0042, 0x0323, 0x1E04 },
+	{ 0x0042, 0x0331, 0x1E06 },
+	{ 0x0043, 0x0301, 0x0106 },
+	{ 0x0043, 0x0302, 0x0108 },
+	{ 0x0043, 0x0307, 0x010A },
+	{ 0x0043, 0x030C, 0x010C },
+	{ 0x0043, 0x0327, 0x00C7 },
+	{ 0x0044, 0x0307, 0x1E0A },
+	{ 0x0044, 0x030C, 0x010E },
+	{ 0x0044, 0x0323, 0x1E0C },
+	{ 0x0044, 0x0327, 0x1E10 },
+	{ 0x0044, 0x032D, 0x1E12 },
+	{ 0x0044, 0x0331, 0x1E0E },
+	{ 0x0045, 0x0300, 0x00C8 },
+	{ 0x0045, 0x0301, 0x00C9 },
+	{ 0x0045, 0x0302, 0x00CA },
+	{ 0x0045, 0x0303, 0x1EBC },
+	{ 0x0045, 0x0304, 0x0112 },
+	{ 0x0045, 0x0306, 0x0114 },
+	{ 0x0045, 0x0307, 0x0116 },
+	{ 0x0045, 0x0308, 0x00CB },
+	{ 0x0045, 0x0309, 0x1EBA },
+	{ 0x0045, 0x030C, 0x011A },
+	{ 0x0045, 0x030F, 0x0204 },
+	{ 0x0045, 0x0311, 0x0206 },
+	{ 0x0045, 0x0323, 0x1EB8 },
+	{ 0x0045, 0x0327, 0x0228 },
+	{ 0x0045, 0x0328, 0x0118 },
+	{ 0x0045, 0x032D, 0x1E18 },
+	{ 0x0045, 0x0330, 0x1E1A },
+	{ 0x0046, 0x0307, 0x1E1E },
+	{ 0x0047, 0x0301, 0x01F4 },
+	{ 0x0047, 0x0302, 0x011C },
+	{ 0x0047, 0x0304, 0x1E20 },
+	{ 0x0047, 0x0306, 0x011E },
+	{ 0x0047, 0x0307, 0x0120 },
+	{ 0x0047, 0x030C, 0x01E6 },
+	{ 0x0047, 0x0327, 0x0122 },
+	{ 0x0048, 0x0302, 0x0124 },
+	{ 0x0048, 0x0307, 0x1E22 },
+	{ 0x0048, 0x0308, 0x1E26 },
+	{ 0x0048, 0x030C, 0x021E },
+	{ 0x0048, 0x0323, 0x1E24 },
+	{ 0x0048, 0x0327, 0x1E28 },
+	{ 0x0048, 0x032E, 0x1E2A },
+	{ 0x0049, 0x0300, 0x00CC },
+	{ 0x0049, 0x0301, 0x00CD },
+	{ 0x0049, 0x0302, 0x00CE },
+	{ 0x0049, 0x0303, 0x0128 },
+	{ 0x0049, 0x0304, 0x012A },
+	{ 0x0049, 0x0306, 0x012C },
+	{ 0x0049, 0x0307, 0x0130 },
+	{ 0x0049, 0x0308, 0x00CF },
+	{ 0x0049, 0x0309, 0x1EC8 },
+	{ 0x0049, 0x030C, 0x01CF },
+	{ 0x0049, 0x030F, 0x0208 },
+	{ 0x0049, 0x0311, 0x020A },
+	{ 0x0049, 0x0323, 0x1ECA },
+	{ 0x0049, 0x0328, 0x012E },
+	{ 0x0049, 0x0330, 0x1E2C },
+	{ 0x004A, 0x0302, 0x0134 },
+	{ 0x004B, 0x0301, 0x1E30 },
+	{ 0x004B, 0x030C, 0x01E8 },
+	{ 0x004B, 0x0323, 0x1E32 },
+	{ 0x004B, 0x0327, 0x0136 },
+	{ 0x004B, 0x0331, 0x1E34 },
+	{ 0x004C, 0x0301, 0x0139 },
+	{ 0x004C, 0x030C, 0x013D },
+	{ 0x004C, 0x0323, 0x1E36 },
+	{ 0x004C, 0x0327, 0x013B },
+	{ 0x004C, 0x032D, 0x1E3C },
+	{ 0x004C, 0x0331, 0x1E3A },
+	{ 0x004D, 0x0301, 0x1E3E },
+	{ 0x004D, 0x0307, 0x1E40 },
+	{ 0x004D, 0x0323, 0x1E42 },
+	{ 0x004E, 0x0300, 0x01F8 },
+	{ 0x004E, 0x0301, 0x0143 },
+	{ 0x004E, 0x0303, 0x00D1 },
+	{ 0x004E, 0x0307, 0x1E44 },
+	{ 0x004E, 0x030C, 0x0147 },
+	{ 0x004E, 0x0323, 0x1E46 },
+	{ 0x004E, 0x0327, 0x0145 },
+	{ 0x004E, 0x032D, 0x1E4A },
+	{ 0x004E, 0x0331, 0x1E48 },
+	{ 0x004F, 0x0300, 0x00D2 },
+	{ 0x004F, 0x0301, 0x00D3 },
+	{ 0x004F, 0x0302, 0x00D4 },
+	{ 0x004F, 0x0303, 0x00D5 },
+	{ 0x004F, 0x0304, 0x014C },
+	{ 0x004F, 0x0306, 0x014E },
+	{ 0x004F, 0x0307, 0x022E },
+	{ 0x004F, 0x0308, 0x00D6 },
+	{ 0x004F, 0x0309, 0x1ECE },
+	{ 0x004F, 0x030B, 0x0150 },
+	{ 0x004F, 0x030C, 0x01D1 },
+	{ 0x004F, 0x030F, 0x020C },
+	{ 0x004F, 0x0311, 0x020E },
+	{ 0x004F, 0x031B, 0x01A0 },
+	{ 0x004F, 0x0323, 0x1ECC },
+	{ 0x004F, 0x0328, 0x01EA },
+	{ 0x0050, 0x0301, 0x1E54 },
+	{ 0x0050, 0x0307, 0x1E56 },
+	{ 0x0052, 0x0301, 0x0154 },
+	{ 0x0052, 0x0307, 0x1E58 },
+	{ 0x0052, 0x030C, 0x0158 },
+	{ 0x0052, 0x030F, 0x0210 },
+	{ 0x0052, 0x0311, 0x0212 },
+	{ 0x0052, 0x0323, 0x1E5A },
+	{ 0x0052, 0x0327, 0x0156 },
+	{ 0x0052, 0x0331, 0x1E5E },
+	{ 0x0053, 0x0301, 0x015A },
+	{ 0x0053, 0x0302, 0x015C },
+	{ 0x0053, 0x0307, 0x1E60 },
+	{ 0x0053, 0x030C, 0x0160 },
+	{ 0x0053, 0x0323, 0x1E62 },
+	{ 0x0053, 0x0326, 0x0218 },
+	{ 0x0053, 0x0327, 0x015E },
+	{ 0x0054, 0x0307, 0x1E6A },
+	{ 0x0054, 0x030C, 0x0164 },
+	{ 0x0054, 0x0323, 0x1E6C },
+	{ 0x0054, 0x0326, 0x021A },
+	{ 0x0054, 0x0327, 0x0162 },
+	{ 0x0054, 0x032D, 0x1E70 },
+	{ 0x0054, 0x0331, 0x1E6E },
+	{ 0x0055, 0x0300, 0x00D9 },
+	{ 0x0055, 0x0301, 0x00DA },
+	{ 0x0055, 0x0302, 0x00DB },
+	{ 0x0055, 0x0303, 0x0168 },
+	{ 0x0055, 0x0304, 0x016A },
+	{ 0x0055, 0x0306, 0x016C },
+	{ 0x0055, 0x0308, 0x00DC },
+	{ 0x0055, 0x0309, 0x1EE6 },
+	{ 0x0055, 0x030A, 0x016E },
+	{ 0x0055, 0x030B, 0x0170 },
+	{ 0x0055, 0x030C, 0x01D3 },
+	{ 0x0055, 0x030F, 0x0214 },
+	{ 0x0055, 0x0311, 0x0216 },
+	{ 0x0055, 0x031B, 0x01AF },
+	{ 0x0055, 0x0323, 0x1EE4 },
+	{ 0x0055, 0x0324, 0x1E72 },
+	{ 0x0055, 0x0328, 0x0172 },
+	{ 0x0055, 0x032D, 0x1E76 },
+	{ 0x0055, 0x0330, 0x1E74 },
+	{ 0x0056, 0x0303, 0x1E7C },
+	{ 0x0056, 0x0323, 0x1E7E },
+	{ 0x0057, 0x0300, 0x1E80 },
+	{ 0x0057, 0x0301, 0x1E82 },
+	{ 0x0057, 0x0302, 0x0174 },
+	{ 0x0057, 0x0307, 0x1E86 },
+	{ 0x0057, 0x0308, 0x1E84 },
+	{ 0x0057, 0x0323, 0x1E88 },
+	{ 0x0058, 0x0307, 0x1E8A },
+	{ 0x0058, 0x0308, 0x1E8C },
+	{ 0x0059, 0x0300, 0x1EF2 },
+	{ 0x0059, 0x0301, 0x00DD },
+	{ 0x0059, 0x0302, 0x0176 },
+	{ 0x0059, 0x0303, 0x1EF8 },
+	{ 0x0059, 0x0304, 0x0232 },
+	{ 0x0059, 0x0307, 0x1E8E },
+	{ 0x0059, 0x0308, 0x0178 },
+	{ 0x0059, 0x0309, 0x1EF6 },
+	{ 0x0059, 0x0323, 0x1EF4 },
+	{ 0x005A, 0x0301, 0x0179 },
+	{ 0x005A, 0x0302, 0x1E90 },
+	{ 0x005A, 0x0307, 0x017B },
+	{ 0x005A, 0x030C, 0x017D },
+	{ 0x005A, 0x0323, 0x1E92 },
+	{ 0x005A, 0x0331, 0x1E94 },
+	{ 0x0061, 0x0300, 0x00E0 },
+	{ 0x0061, 0x0301, 0x00E1 },
+	{ 0x0061, 0x0302, 0x00E2 },
+	{ 0x0061, 0x0303, 0x00E3 },
+	{ 0x0061, 0x0304, 0x0101 },
+	{ 0x0061, 0x0306, 0x0103 },
+	{ 0x0061, 0x0307, 0x0227 },
+	{ 0x0061, 0x0308, 0x00E4 },
+	{ 0x0061, 0x0309, 0x1EA3 },
+	{ 0x0061, 0x030A, 0x00E5 },
+	{ 0x0061, 0x030C, 0x01CE },
+	{ 0x0061, 0x030F, 0x0201 },
+	{ 0x0061, 0x0311, 0x0203 },
+	{ 0x0061, 0x0323, 0x1EA1 },
+	{ 0x0061, 0x0325, 0x1E01 },
+	{ 0x0061, 0x0328, 0x0105 },
+	{ 0x0062, 0x0307, 0x1E03 },
+	{ 0x0062, 0x0323, 0x1E05 },
+	{ 0x0062, 0x0331, 0x1E07 },
+	{ 0x0063, 0x0301, 0x0107 },
+	{ 0x0063, 0x0302, 0x0109 },
+	{ 0x0063, 0x0307, 0x010B },
+	{ 0x0063, 0x030C, 0x010D },
+	{ 0x0063, 0x0327, 0x00E7 },
+	{ 0x0064, 0x0307, 0x1E0B },
+	{ 0x0064, 0x030C, 0x010F },
+	{ 0x0064, 0x0323, 0x1E0D },
+	{ 0x0064, 0x0327, 0x1E11 },
+	{ 0x0064, 0x032D, 0x1E13 },
+	{ 0x0064, 0x0331, 0x1E0F },
+	{ 0x0065, 0x0300, 0x00E8 },
+	{ 0x0065, 0x0301, 0x00E9 },
+	{ 0x0065, 0x0302, 0x00EA },
+	{ 0x0065, 0x0303, 0x1EBD },
+	{ 0x0065, 0x0304, 0x0113 },
+	{ 0x0065, 0x0306, 0x0115 },
+	{ 0x0065, 0x0307, 0x0117 },
+	{ 0x0065, 0x0308, 0x00EB },
+	{ 0x0065, 0x0309, 0x1EBB },
+	{ 0x0065, 0x030C, 0x011B },
+	{ 0x0065, 0x030F, 0x0205 },
+	{ 0x0065, 0x0311, 0x0207 },
+	{ 0x0065, 0x0323, 0x1EB9 },
+	{ 0x0065, 0x0327, 0x0229 },
+	{ 0x0065, 0x0328, 0x0119 },
+	{ 0x0065, 0x032D, 0x1E19 },
+	{ 0x0065, 0x0330, 0x1E1B },
+	{ 0x0066, 0x0307, 0x1E1F },
+	{ 0x0067, 0x0301, 0x01F5 },
+	{ 0x0067, 0x0302, 0x011D },
+	{ 0x0067, 0x0304, 0x1E21 },
+	{ 0x0067, 0x0306, 0x011F },
+	{ 0x0067, 0x0307, 0x0121 },
+	{ 0x0067, 0x030C, 0x01E7 },
+	{ 0x0067, 0x0327, 0x0123 },
+	{ 0x0068, 0x0302, 0x0125 },
+	{ 0x0068, 0x0307, 0x1E23 },
+	{ 0x0068, 0x0308, 0x1E27 },
+	{ 0x0068, 0x030C, 0x021F },
+	{ 0x0068, 0x0323, 0x1E25 },
+	{ 0x0068, 0x0327, 0x1E29 },
+	{ 0x0068, 0x032E, 0x1E2B },
+	{ 0x0068, 0x0331, 0x1E96 },
+	{ 0x0069, 0x0300, 0x00EC },
+	{ 0x0069, 0x0301, 0x00ED },
+	{ 0x0069, 0x0302, 0x00EE },
+	{ 0x0069, 0x0303, 0x0129 },
+	{ 0x0069, 0x0304, 0x012B },
+	{ 0x0069, 0x0306, 0x012D },
+	{ 0x0069, 0x0308, 0x00EF },
+	{ 0x0069, 0x0309, 0x1EC9 },
+	{ 0x0069, 0x030C, 0x01D0 },
+	{ 0x0069, 0x030F, 0x0209 },
+	{ 0x0069, 0x0311, 0x020B },
+	{ 0x0069, 0x0323, 0x1ECB },
+	{ 0x0069, 0x0328, 0x012F },
+	{ 0x0069, 0x0330, 0x1E2D },
+	{ 0x006A, 0x0302, 0x0135 },
+	{ 0x006A, 0x030C, 0x01F0 },
+	{ 0x006B, 0x0301, 0x1E31 },
+	{ 0x006B, 0x030C, 0x01E9 },
+	{ 0x006B, 0x0323, 0x1E33 },
+	{ 0x006B, 0x0327, 0x0137 },
+	{ 0x006B, 0x0331, 0x1E35 },
+	{ 0x006C, 0x0301, 0x013A },
+	{ 0x006C, 0x030C, 0x013E },
+	{ 0x006C, 0x0323, 0x1E37 },
+	{ 0x006C, 0x0327, 0x013C },
+	{ 0x006C, 0x032D, 0x1E3D },
+	{ 0x006C, 0x0331, 0x1E3B },
+	{ 0x006D, 0x0301, 0x1E3F },
+	{ 0x006D, 0x0307, 0x1E41 },
+	{ 0x006D, 0x0323, 0x1E43 },
+	{ 0x006E, 0x0300, 0x01F9 },
+	{ 0x006E, 0x0301, 0x0144 },
+	{ 0x006E, 0x0303, 0x00F1 },
+	{ 0x006E, 0x0307, 0x1E45 },
+	{ 0x006E, 0x030C, 0x0148 },
+	{ 0x006E, 0x0323, 0x1E47 },
+	{ 0x006E, 0x0327, 0x0146 },
+	{ 0x006E, 0x032D, 0x1E4B },
+	{ 0x006E, 0x0331, 0x1E49 },
+	{ 0x006F, 0x0300, 0x00F2 },
+	{ 0x006F, 0x0301, 0x00F3 },
+	{ 0x006F, 0x0302, 0x00F4 },
+	{ 0x006F, 0x0303, 0x00F5 },
+	{ 0x006F, 0x0304, 0x014D },
+	{ 0x006F, 0x0306, 0x014F },
+	{ 0x006F, 0x0307, 0x022F },
+	{ 0x006F, 0x0308, 0x00F6 },
+	{ 0x006F, 0x0309, 0x1ECF },
+	{ 0x006F, 0x030B, 0x0151 },
+	{ 0x006F, 0x030C, 0x01D2 },
+	{ 0x006F, 0x030F, 0x020D },
+	{ 0x006F, 0x0311, 0x020F },
+	{ 0x006F, 0x031B, 0x01A1 },
+	{ 0x006F, 0x0323, 0x1ECD },
+	{ 0x006F, 0x0328, 0x01EB },
+	{ 0x0070, 0x0301, 0x1E55 },
+	{ 0x0070, 0x0307, 0x1E57 },
+	{ 0x0072, 0x0301, 0x0155 },
+	{ 0x0072, 0x0307, 0x1E59 },
+	{ 0x0072, 0x030C, 0x0159 },
+	{ 0x0072, 0x030F, 0x0211 },
+	{ 0x0072, 0x0311, 0x0213 },
+	{ 0x0072, 0x0323, 0x1E5B },
+	{ 0x0072, 0x0327, 0x0157 },
+	{ 0x0072, 0x0331, 0x1E5F },
+	{ 0x0073, 0x0301, 0x015B },
+	{ 0x0073, 0x0302, 0x015D },
+	{ 0x0073, 0x0307, 0x1E61 },
+	{ 0x0073, 0x030C, 0x0161 },
+	{ 0x0073, 0x0323, 0x1E63 },
+	{ 0x0073, 0x0326, 0x0219 },
+	{ 0x0073, 0x0327, 0x015F },
+	{ 0x0074, 0x0307, 0x1E6B },
+	{ 0x0074, 0x0308, 0x1E97 },
+	{ 0x0074, 0x030C, 0x0165 },
+	{ 0x0074, 0x0323, 0x1E6D },
+	{ 0x0074, 0x0326, 0x021B },
+	{ 0x0074, 0x0327, 0x0163 },
+	{ 0x0074, 0x032D, 0x1E71 },
+	{ 0x0074, 0x0331, 0x1E6F },
+	{ 0x0075, 0x0300, 0x00F9 },
+	{ 0x0075, 0x0301, 0x00FA },
+	{ 0x0075, 0x0302, 0x00FB },
+	{ 0x0075, 0x0303, 0x0169 },
+	{ 0x0075, 0x0304, 0x016B },
+	{ 0x0075, 0x0306, 0x016D },
+	{ 0x0075, 0x0308, 0x00FC },
+	{ 0x0075, 0x0309, 0x1EE7 },
+	{ 0x0075, 0x030A, 0x016F },
+	{ 0x0075, 0x030B, 0x0171 },
+	{ 0x0075, 0x030C, 0x01D4 },
+	{ 0x0075, 0x030F, 0x0215 },
+	{ 0x0075, 0x0311, 0x0217 },
+	{ 0x0075, 0x031B, 0x01B0 },
+	{ 0x0075, 0x0323, 0x1EE5 },
+	{ 0x0075, 0x0324, 0x1E73 },
+	{ 0x0075, 0x0328, 0x0173 },
+	{ 0x0075, 0x032D, 0x1E77 },
+	{ 0x0075, 0x0330, 0x1E75 },
+	{ 0x0076, 0x0303, 0x1E7D },
+	{ 0x0076, 0x0323, 0x1E7F },
+	{ 0x0077, 0x0300, 0x1E81 },
+	{ 0x0077, 0x0301, 0x1E83 },
+	{ 0x0077, 0x0302, 0x0175 },
+	{ 0x0077, 0x0307, 0x1E87 },
+	{ 0x0077, 0x0308, 0x1E85 },
+	{ 0x0077, 0x030A, 0x1E98 },
+	{ 0x0077, 0x0323, 0x1E89 },
+	{ 0x0078, 0x0307, 0x1E8B },
+	{ 0x0078, 0x0308, 0x1E8D },
+	{ 0x0079, 0x0300, 0x1EF3 },
+	{ 0x0079, 0x0301, 0x00FD },
+	{ 0x0079, 0x0302, 0x0177 },
+	{ 0x0079, 0x0303, 0x1EF9 },
+	{ 0x0079, 0x0304, 0x0233 },
+	{ 0x0079, 0x0307, 0x1E8F },
+	{ 0x0079, 0x0308, 0x00FF },
+	{ 0x0079, 0x0309, 0x1EF7 },
+	{ 0x0079, 0x030A, 0x1E99 },
+	{ 0x0079, 0x0323, 0x1EF5 },
+	{ 0x007A, 0x0301, 0x017A },
+	{ 0x007A, 0x0302, 0x1E91 },
+	{ 0x007A, 0x0307, 0x017C },
+	{ 0x007A, 0x030C, 0x017E },
+	{ 0x007A, 0x0323, 0x1E93 },
+	{ 0x007A, 0x0331, 0x1E95 },
+	{ 0x00A8, 0x0300, 0x1FED },
+	{ 0x00A8, 0x0301, 0x0385 },
+	{ 0x00A8, 0x0342, 0x1FC1 },
+	{ 0x00C2, 0x0300, 0x1EA6 },
+	{ 0x00C2, 0x0301, 0x1EA4 },
+	{ 0x00C2, 0x0303, 0x1EAA },
+	{ 0x00C2, 0x0309, 0x1EA8 },
+	{ 0x00C4, 0x0304, 0x01DE },
+	{ 0x00C5, 0x0301, 0x01FA },
+	{ 0x00C6, 0x0301, 0x01FC },
+	{ 0x00C6, 0x0304, 0x01E2 },
+	{ 0x00C7, 0x0301, 0x1E08 },
+	{ 0x00CA, 0x0300, 0x1EC0 },
+	{ 0x00CA, 0x0301, 0x1EBE },
+	{ 0x00CA, 0x0303, 0x1EC4 },
+	{ 0x00CA, 0x0309, 0x1EC2 },
+	{ 0x00CF, 0x0301, 0x1E2E },
+	{ 0x00D4, 0x0300, 0x1ED2 },
+	{ 0x00D4, 0x0301, 0x1ED0 },
+	{ 0x00D4, 0x0303, 0x1ED6 },
+	{ 0x00D4, 0x0309, 0x1ED4 },
+	{ 0x00D5, 0x0301, 0x1E4C },
+	{ 0x00D5, 0x0304, 0x022C },
+	{ 0x00D5, 0x0308, 0x1E4E },
+	{ 0x00D6, 0x0304, 0x022A },
+	{ 0x00D8, 0x0301, 0x01FE },
+	{ 0x00DC, 0x0300, 0x01DB },
+	{ 0x00DC, 0x0301, 0x01D7 },
+	{ 0x00DC, 0x0304, 0x01D5 },
+	{ 0x00DC, 0x030C, 0x01D9 },
+	{ 0x00E2, 0x0300, 0x1EA7 },
+	{ 0x00E2, 0x0301, 0x1EA5 },
+	{ 0x00E2, 0x0303, 0x1EAB },
+	{ 0x00E2, 0x0309, 0x1EA9 },
+	{ 0x00E4, 0x0304, 0x01DF },
+	{ 0x00E5, 0x0301, 0x01FB },
+	{ 0x00E6, 0x0301, 0x01FD },
+	{ 0x00E6, 0x0304, 0x01E3 },
+	{ 0x00E7, 0x0301, 0x1E09 },
+	{ 0x00EA, 0x0300, 0x1EC1 },
+	{ 0x00EA, 0x0301, 0x1EBF },
+	{ 0x00EA, 0x0303, 0x1EC5 },
+	{ 0x00EA, 0x0309, 0x1EC3 },
+	{ 0x00EF, 0x0301, 0x1E2F },
+	{ 0x00F4, 0x0300, 0x1ED3 },
+	{ 0x00F4, 0x0301, 0x1ED1 },
+	{ 0x00F4, 0x0303, 0x1ED7 },
+	{ 0x00F4, 0x0309, 0x1ED5 },
+	{ 0x00F5, 0x0301, 0x1E4D },
+	{ 0x00F5, 0x0304, 0x022D },
+	{ 0x00F5, 0x0308, 0x1E4F },
+	{ 0x00F6, 0x0304, 0x022B },
+	{ 0x00F8, 0x0301, 0x01FF },
+	{ 0x00FC, 0x0300, 0x01DC },
+	{ 0x00FC, 0x0301, 0x01D8 },
+	{ 0x00FC, 0x0304, 0x01D6 },
+	{ 0x00FC, 0x030C, 0x01DA },
+	{ 0x0102, 0x0300, 0x1EB0 },
+	{ 0x0102, 0x0301, 0x1EAE },
+	{ 0x0102, 0x0303, 0x1EB4 },
+	{ 0x0102, 0x0309, 0x1EB2 },
+	{ 0x0103, 0x0300, 0x1EB1 },
+	{ 0x0103, 0x0301, 0x1EAF },
+	{ 0x0103, 0x0303, 0x1EB5 },
+	{ 0x0103, 0x0309, 0x1EB3 },
+	{ 0x0112, 0x0300, 0x1E14 },
+	{ 0x0112, 0x0301, 0x1E16 },
+	{ 0x0113, 0x0300, 0x1E15 },
+	{ 0x0113, 0x0301, 0x1E17 },
+	{ 0x014C, 0x0300, 0x1E50 },
+	{ 0x014C, 0x0301, 0x1E52 },
+	{ 0x014D, 0x0300, 0x1E51 },
+	{ 0x014D, 0x0301, 0x1E53 },
+	{ 0x015A, 0x0307, 0x1E64 },
+	{ 0x015B, 0x0307, 0x1E65 },
+	{ 0x0160, 0x0307, 0x1E66 },
+	{ 0x0161, 0x0307, 0x1E67 },
+	{ 0x0168, 0x0301, 0x1E78 },
+	{ 0x0169, 0x0301, 0x1E79 },
+	{ 0x016A, 0x0308, 0x1E7A },
+	{ 0x016B, 0x0308, 0x1E7B },
+	{ 0x017F, 0x0307, 0x1E9B },
+	{ 0x01A0, 0x0300, 0x1EDC },
+	{ 0x01A0, 0x0301, 0x1EDA },
+	{ 0x01A0, 0x0303, 0x1EE0 },
+	{ 0x01A0, 0x0309, 0x1EDE },
+	{ 0x01A0, 0x0323, 0x1EE2 },
+	{ 0x01A1, 0x0300, 0x1EDD },
+	{ 0x01A1, 0x0301, 0x1EDB },
+	{ 0x01A1, 0x0303, 0x1EE1 },
+	{ 0x01A1, 0x0309, 0x1EDF },
+	{ 0x01A1, 0x0323, 0x1EE3 },
+	{ 0x01AF, 0x0300, 0x1EEA },
+	{ 0x01AF, 0x0301, 0x1EE8 },
+	{ 0x01AF, 0x0303, 0x1EEE },
+	{ 0x01AF, 0x0309, 0x1EEC },
+	{ 0x01AF, 0x0323, 0x1EF0 },
+	{ 0x01B0, 0x0300, 0x1EEB },
+	{ 0x01B0, 0x0301, 0x1EE9 },
+	{ 0x01B0, 0x0303, 0x1EEF },
+	{ 0x01B0, 0x0309, 0x1EED },
+	{ 0x01B0, 0x0323, 0x1EF1 },
+	{ 0x01B7, 0x030C, 0x01EE },
+	{ 0x01EA, 0x0304, 0x01EC },
+	{ 0x01EB, 0x0304, 0x01ED },
+	{ 0x0226, 0x0304, 0x01E0 },
+	{ 0x0227, 0x0304, 0x01E1 },
+	{ 0x0228, 0x0306, 0x1E1C },
+	{ 0x0229, 0x0306, 0x1E1D },
+	{ 0x022E, 0x0304, 0x0230 },
+	{ 0x022F, 0x0304, 0x0231 },
+	{ 0x0292, 0x030C, 0x01EF },
+	{ 0x0391, 0x0300, 0x1FBA },
+	{ 0x0391, 0x0301, 0x0386 },
+	{ 0x0391, 0x0304, 0x1FB9 },
+	{ 0x0391, 0x0306, 0x1FB8 },
+	{ 0x0391, 0x0313, 0x1F08 },
+	{ 0x0391, 0x0314, 0x1F09 },
+	{ 0x0391, 0x0345, 0x1FBC },
+	{ 0x0395, 0x0300, 0x1FC8 },
+	{ 0x0395, 0x0301, 0x0388 },
+	{ 0x0395, 0x0313, 0x1F18 },
+	{ 0x0395, 0x0314, 0x1F19 },
+	{ 0x0397, 0x0300, 0x1FCA },
+	{ 0x0397, 0x0301, 0x0389 },
+	{ 0x0397, 0x0313, 0x1F28 },
+	{ 0x0397, 0x0314, 0x1F29 },
+	{ 0x0397, 0x0345, 0x1FCC },
+	{ 0x0399, 0x0300, 0x1FDA },
+	{ 0x0399, 0x0301, 0x038A },
+	{ 0x0399, 0x0304, 0x1FD9 },
+	{ 0x0399, 0x0306, 0x1FD8 },
+	{ 0x0399, 0x0308, 0x03AA },
+	{ 0x0399, 0x0313, 0x1F38 },
+	{ 0x0399, 0x0314, 0x1F39 },
+	{ 0x039F, 0x0300, 0x1FF8 },
+	{ 0x039F, 0x0301, 0x038C },
+	{ 0x039F, 0x0313, 0x1F48 },
+	{ 0x039F, 0x0314, 0x1F49 },
+	{ 0x03A1, 0x0314, 0x1FEC },
+	{ 0x03A5, 0x0300, 0x1FEA },
+	{ 0x03A5, 0x0301, 0x038E },
+	{ 0x03A5, 0x0304, 0x1FE9 },
+	{ 0x03A5, 0x0306, 0x1FE8 },
+	{ 0x03A5, 0x0308, 0x03AB },
+	{ 0x03A5, 0x0314, 0x1F59 },
+	{ 0x03A9, 0x0300, 0x1FFA },
+	{ 0x03A9, 0x0301, 0x038F },
+	{ 0x03A9, 0x0313, 0x1F68 },
+	{ 0x03A9, 0x0314, 0x1F69 },
+	{ 0x03A9, 0x0345, 0x1FFC },
+	{ 0x03AC, 0x0345, 0x1FB4 },
+	{ 0x03AE, 0x0345, 0x1FC4 },
+	{ 0x03B1, 0x0300, 0x1F70 },
+	{ 0x03B1, 0x0301, 0x03AC },
+	{ 0x03B1, 0x0304, 0x1FB1 },
+	{ 0x03B1, 0x0306, 0x1FB0 },
+	{ 0x03B1, 0x0313, 0x1F00 },
+	{ 0x03B1, 0x0314, 0x1F01 },
+	{ 0x03B1, 0x0342, 0x1FB6 },
+	{ 0x03B1, 0x0345, 0x1FB3 },
+	{ 0x03B5, 0x0300, 0x1F72 },
+	{ 0x03B5, 0x0301, 0x03AD },
+	{ 0x03B5, 0x0313, 0x1F10 },
+	{ 0x03B5, 0x0314, 0x1F11 },
+	{ 0x03B7, 0x0300, 0x1F74 },
+	{ 0x03B7, 0x0301, 0x03AE },
+	{ 0x03B7, 0x0313, 0x1F20 },
+	{ 0x03B7, 0x0314, 0x1F21 },
+	{ 0x03B7, 0x0342, 0x1FC6 },
+	{ 0x03B7, 0x0345, 0x1FC3 },
+	{ 0x03B9, 0x0300, 0x1F76 },
+	{ 0x03B9, 0x0301, 0x03AF },
+	{ 0x03B9, 0x0304, 0x1FD1 },
+	{ 0x03B9, 0x0306, 0x1FD0 },
+	{ 0x03B9, 0x0308, 0x03CA },
+	{ 0x03B9, 0x0313, 0x1F30 },
+	{ 0x03B9, 0x0314, 0x1F31 },
+	{ 0x03B9, 0x0342, 0x1FD6 },
+	{ 0x03BF, 0x0300, 0x1F78 },
+	{ 0x03BF, 0x0301, 0x03CC },
+	{ 0x03BF, 0x0313, 0x1F40 },
+	{ 0x03BF, 0x0314, 0x1F41 },
+	{ 0x03C1, 0x0313, 0x1FE4 },
+	{ 0x03C1, 0x0314, 0x1FE5 },
+	{ 0x03C5, 0x0300, 0x1F7A },
+	{ 0x03C5, 0x0301, 0x03CD },
+	{ 0x03C5, 0x0304, 0x1FE1 },
+	{ 0x03C5, 0x0306, 0x1FE0 },
+	{ 0x03C5, 0x0308, 0x03CB },
+	{ 0x03C5, 0x0313, 0x1F50 },
+	{ 0x03C5, 0x0314, 0x1F51 },
+	{ 0x03C5, 0x0342, 0x1FE6 },
+	{ 0x03C9, 0x0300, 0x1F7C },
+	{ 0x03C9, 0x0301, 0x03CE },
+	{ 0x03C9, 0x0313, 0x1F60 },
+	{ 0x03C9, 0x0314, 0x1F61 },
+	{ 0x03C9, 0x0342, 0x1FF6 },
+	{ 0x03C9, 0x0345, 0x1FF3 },
+	{ 0x03CA, 0x0300, 0x1FD2 },
+	{ 0x03CA, 0x0301, 0x0390 },
+	{ 0x03CA, 0x0342, 0x1FD7 },
+	{ 0x03CB, 0x0300, 0x1FE2 },
+	{ 0x03CB, 0x0301, 0x03B0 },
+	{ 0x03CB, 0x0342, 0x1FE7 },
+	{ 0x03CE, 0x0345, 0x1FF4 },
+	{ 0x03D2, 0x0301, 0x03D3 },
+	{ 0x03D2, 0x0308, 0x03D4 },
+	{ 0x0406, 0x0308, 0x0407 },
+	{ 0x0410, 0x0306, 0x04D0 },
+	{ 0x0410, 0x0308, 0x04D2 },
+	{ 0x0413, 0x0301, 0x0403 },
+	{ 0x0415, 0x0300, 0x0400 },
+	{ 0x0415, 0x0306, 0x04D6 },
+	{ 0x0415, 0x0308, 0x0401 },
+	{ 0x0416, 0x0306, 0x04C1 },
+	{ 0x0416, 0x0308, 0x04DC },
+	{ 0x0417, 0x0308, 0x04DE },
+	{ 0x0418, 0x0300, 0x040D },
+	{ 0x0418, 0x0304, 0x04E2 },
+	{ 0x0418, 0x0306, 0x0419 },
+	{ 0x0418, 0x0308, 0x04E4 },
+	{ 0x041A, 0x0301, 0x040C },
+	{ 0x041E, 0x0308, 0x04E6 },
+	{ 0x0423, 0x0304, 0x04EE },
+	{ 0x0423, 0x0306, 0x040E },
+	{ 0x0423, 0x0308, 0x04F0 },
+	{ 0x0423, 0x030B, 0x04F2 },
+	{ 0x0427, 0x0308, 0x04F4 },
+	{ 0x042B, 0x0308, 0x04F8 },
+	{ 0x042D, 0x0308, 0x04EC },
+	{ 0x0430, 0x0306, 0x04D1 },
+	{ 0x0430, 0x0308, 0x04D3 },
+	{ 0x0433, 0x0301, 0x0453 },
+	{ 0x0435, 0x0300, 0x0450 },
+	{ 0x0435, 0x0306, 0x04D7 },
+	{ 0x0435, 0x0308, 0x0451 },
+	{ 0x0436, 0x0306, 0x04C2 },
+	{ 0x0436, 0x0308, 0x04DD },
+	{ 0x0437, 0x0308, 0x04DF },
+	{ 0x0438, 0x0300, 0x045D },
+	{ 0x0438, 0x0304, 0x04E3 },
+	{ 0x0438, 0x0306, 0x0439 },
+	{ 0x0438, 0x0308, 0x04E5 },
+	{ 0x043A, 0x0301, 0x045C },
+	{ 0x043E, 0x0308, 0x04E7 },
+	{ 0x0443, 0x0304, 0x04EF },
+	{ 0x0443, 0x0306, 0x045E },
+	{ 0x0443, 0x0308, 0x04F1 },
+	{ 0x0443, 0x030B, 0x04F3 },
+	{ 0x0447, 0x0308, 0x04F5 },
+	{ 0x044B, 0x0308, 0x04F9 },
+	{ 0x044D, 0x0308, 0x04ED },
+	{ 0x0456, 0x0308, 0x0457 },
+	{ 0x0474, 0x030F, 0x0476 },
+	{ 0x0475, 0x030F, 0x0477 },
+	{ 0x04D8, 0x0308, 0x04DA },
+	{ 0x04D9, 0x0308, 0x04DB },
+	{ 0x04E8, 0x0308, 0x04EA },
+	{ 0x04E9, 0x0308, 0x04EB },
+	{ 0x0627, 0x0653, 0x0622 },
+	{ 0x0627, 0x0654, 0x0623 },
+	{ 0x0627, 0x0655, 0x0625 },
+	{ 0x0648, 0x0654, 0x0624 },
+	{ 0x064A, 0x0654, 0x0626 },
+	{ 0x06C1, 0x0654, 0x06C2 },
+	{ 0x06D2, 0x0654, 0x06D3 },
+	{ 0x06D5, 0x0654, 0x06C0 },
+	{ 0x0928, 0x093C, 0x0929 },
+	{ 0x0930, 0x093C, 0x0931 },
+	{ 0x0933, 0x093C, 0x0934 },
+	{ 0x09C7, 0x09BE, 0x09CB },
+	{ 0x09C7, 0x09D7, 0x09CC },
+	{ 0x0B47, 0x0B3E, 0x0B4B },
+	{ 0x0B47, 0x0B56, 0x0B48 },
+	{ 0x0B47, 0x0B57, 0x0B4C },
+	{ 0x0B92, 0x0BD7, 0x0B94 },
+	{ 0x0BC6, 0x0BBE, 0x0BCA },
+	{ 0x0BC6, 0x0BD7, 0x0BCC },
+	{ 0x0BC7, 0x0BBE, 0x0BCB },
+	{ 0x0C46, 0x0C56, 0x0C48 },
+	{ 0x0CBF, 0x0CD5, 0x0CC0 },
+	{ 0x0CC6, 0x0CC2, 0x0CCA },
+	{ 0x0CC6, 0x0CD5, 0x0CC7 },
+	{ 0x0CC6, 0x0CD6, 0x0CC8 },
+	{ 0x0CCA, 0x0CD5, 0x0CCB },
+	{ 0x0D46, 0x0D3E, 0x0D4A },
+	{ 0x0D46, 0x0D57, 0x0D4C },
+	{ 0x0D47, 0x0D3E, 0x0D4B },
+	{ 0x0DD9, 0x0DCA, 0x0DDA },
+	{ 0x0DD9, 0x0DCF, 0x0DDC },
+	{ 0x0DD9, 0x0DDF, 0x0DDE },
+	{ 0x0DDC, 0x0DCA, 0x0DDD },
+	{ 0x1025, 0x102E, 0x1026 },
+	{ 0x1B05, 0x1B35, 0x1B06 },
+	{ 0x1B07, 0x1B35, 0x1B08 },
+	{ 0x1B09, 0x1B35, 0x1B0A },
+	{ 0x1B0B, 0x1B35, 0x1B0C },
+	{ 0x1B0D, 0x1B35, 0x1B0E },
+	{ 0x1B11, 0x1B35, 0x1B12 },
+	{ 0x1B3A, 0x1B35, 0x1B3B },
+	{ 0x1B3C, 0x1B35, 0x1B3D },
+	{ 0x1B3E, 0x1B35, 0x1B40 },
+	{ 0x1B3F, 0x1B35, 0x1B41 },
+	{ 0x1B42, 0x1B35, 0x1B43 },
+	{ 0x1E36, 0x0304, 0x1E38 },
+	{ 0x1E37, 0x0304, 0x1E39 },
+	{ 0x1E5A, 0x0304, 0x1E5C },
+	{ 0x1E5B, 0x0304, 0x1E5D },
+	{ 0x1E62, 0x0307, 0x1E68 },
+	{ 0x1E63, 0x0307, 0x1E69 },
+	{ 0x1EA0, 0x0302, 0x1EAC },
+	{ 0x1EA0, 0x0306, 0x1EB6 },
+	{ 0x1EA1, 0x0302, 0x1EAD },
+	{ 0x1EA1, 0x0306, 0x1EB7 },
+	{ 0x1EB8, 0x0302, 0x1EC6 },
+	{ 0x1EB9, 0x0302, 0x1EC7 },
+	{ 0x1ECC, 0x0302, 0x1ED8 },
+	{ 0x1ECD, 0x0302, 0x1ED9 },
+	{ 0x1F00, 0x0300, 0x1F02 },
+	{ 0x1F00, 0x0301, 0x1F04 },
+	{ 0x1F00, 0x0342, 0x1F06 },
+	{ 0x1F00, 0x0345, 0x1F80 },
+	{ 0x1F01, 0x0300, 0x1F03 },
+	{ 0x1F01, 0x0301, 0x1F05 },
+	{ 0x1F01, 0x0342, 0x1F07 },
+	{ 0x1F01, 0x0345, 0x1F81 },
+	{ 0x1F02, 0x0345, 0x1F82 },
+	{ 0x1F03, 0x0345, 0x1F83 },
+	{ 0x1F04, 0x0345, 0x1F84 },
+	{ 0x1F05, 0x0345, 0x1F85 },
+	{ 0x1F06, 0x0345, 0x1F86 },
+	{ 0x1F07, 0x0345, 0x1F87 },
+	{ 0x1F08, 0x0300, 0x1F0A },
+	{ 0x1F08, 0x0301, 0x1F0C },
+	{ 0x1F08, 0x0342, 0x1F0E },
+	{ 0x1F08, 0x0345, 0x1F88 },
+	{ 0x1F09, 0x0300, 0x1F0B },
+	{ 0x1F09, 0x0301, 0x1F0D },
+	{ 0x1F09, 0x0342, 0x1F0F },
+	{ 0x1F09, 0x0345, 0x1F89 },
+	{ 0x1F0A, 0x0345, 0x1F8A },
+	{ 0x1F0B, 0x0345, 0x1F8B },
+	{ 0x1F0C, 0x0345, 0x1F8C },
+	{ 0x1F0D, 0x0345, 0x1F8D },
+	{ 0x1F0E, 0x0345, 0x1F8E },
+	{ 0x1F0F, 0x0345, 0x1F8F },
+	{ 0x1F10, 0x0300, 0x1F12 },
+	{ 0x1F10, 0x0301, 0x1F14 },
+	{ 0x1F11, 0x0300, 0x1F13 },
+	{ 0x1F11, 0x0301, 0x1F15 },
+	{ 0x1F18, 0x0300, 0x1F1A },
+	{ 0x1F18, 0x0301, 0x1F1C },
+	{ 0x1F19, 0x0300, 0x1F1B },
+	{ 0x1F19, 0x0301, 0x1F1D },
+	{ 0x1F20, 0x0300, 0x1F22 },
+	{ 0x1F20, 0x0301, 0x1F24 },
+	{ 0x1F20, 0x0342, 0x1F26 },
+	{ 0x1F20, 0x0345, 0x1F90 },
+	{ 0x1F21, 0x0300, 0x1F23 },
+	{ 0x1F21, 0x0301, 0x1F25 },
+	{ 0x1F21, 0x0342, 0x1F27 },
+	{ 0x1F21, 0x0345, 0x1F91 },
+	{ 0x1F22, 0x0345, 0x1F92 },
+	{ 0x1F23, 0x0345, 0x1F93 },
+	{ 0x1F24, 0x0345, 0x1F94 },
+	{ 0x1F25, 0x0345, 0x1F95 },
+	{ 0x1F26, 0x0345, 0x1F96 },
+	{ 0x1F27, 0x0345, 0x1F97 },
+	{ 0x1F28, 0x0300, 0x1F2A },
+	{ 0x1F28, 0x0301, 0x1F2C },
+	{ 0x1F28, 0x0342, 0x1F2E },
+	{ 0x1F28, 0x0345, 0x1F98 },
+	{ 0x1F29, 0x0300, 0x1F2B },
+	{ 0x1F29, 0x0301, 0x1F2D },
+	{ 0x1F29, 0x0342, 0x1F2F },
+	{ 0x1F29, 0x0345, 0x1F99 },
+	{ 0x1F2A, 0x0345, 0x1F9A },
+	{ 0x1F2B, 0x0345, 0x1F9B },
+	{ 0x1F2C, 0x0345, 0x1F9C },
+	{ 0x1F2D, 0x0345, 0x1F9D },
+	{ 0x1F2E, 0x0345, 0x1F9E },
+	{ 0x1F2F, 0x0345, 0x1F9F },
+	{ 0x1F30, 0x0300, 0x1F32 },
+	{ 0x1F30, 0x0301, 0x1F34 },
+	{ 0x1F30, 0x0342, 0x1F36 },
+	{ 0x1F31, 0x0300, 0x1F33 },
+	{ 0x1F31, 0x0301, 0x1F35 },
+	{ 0x1F31, 0x0342, 0x1F37 },
+	{ 0x1F38, 0x0300, 0x1F3A },
+	{ 0x1F38, 0x0301, 0x1F3C },
+	{ 0x1F38, 0x0342, 0x1F3E },
+	{ 0x1F39, 0x0300, 0x1F3B },
+	{ 0x1F39, 0x0301, 0x1F3D },
+	{ 0x1F39, 0x0342, 0x1F3F },
+	{ 0x1F40, 0x0300, 0x1F42 },
+	{ 0x1F40, 0x0301, 0x1F44 },
+	{ 0x1F41, 0x0300, 0x1F43 },
+	{ 0x1F41, 0x0301, 0x1F45 },
+	{ 0x1F48, 0x0300, 0x1F4A },
+	{ 0x1F48, 0x0301, 0x1F4C },
+	{ 0x1F49, 0x0300, 0x1F4B },
+	{ 0x1F49, 0x0301, 0x1F4D },
+	{ 0x1F50, 0x0300, 0x1F52 },
+	{ 0x1F50, 0x0301, 0x1F54 },
+	{ 0x1F50, 0x0342, 0x1F56 },
+	{ 0x1F51, 0x0300, 0x1F53 },
+	{ 0x1F51, 0x0301, 0x1F55 },
+	{ 0x1F51, 0x0342, 0x1F57 },
+	{ 0x1F59, 0x0300, 0x1F5B },
+	{ 0x1F59, 0x0301, 0x1F5D },
+	{ 0x1F59, 0x0342, 0x1F5F },
+	{ 0x1F60, 0x0300, 0x1F62 },
+	{ 0x1F60, 0x0301, 0x1F64 },
+	{ 0x1F60, 0x0342, 0x1F66 },
+	{ 0x1F60, 0x0345, 0x1FA0 },
+	{ 0x1F61, 0x0300, 0x1F63 },
+	{ 0x1F61, 0x0301, 0x1F65 },
+	{ 0x1F61, 0x0342, 0x1F67 },
+	{ 0x1F61, 0x0345, 0x1FA1 },
+	{ 0x1F62, 0x0345, 0x1FA2 },
+	{ 0x1F63, 0x0345, 0x1FA3 },
+	{ 0x1F64, 0x0345, 0x1FA4 },
+	{ 0x1F65, 0x0345, 0x1FA5 },
+	{ 0x1F66, 0x0345, 0x1FA6 },
+	{ 0x1F67, 0x0345, 0x1FA7 },
+	{ 0x1F68, 0x0300, 0x1F6A },
+	{ 0x1F68, 0x0301, 0x1F6C },
+	{ 0x1F68, 0x0342, 0x1F6E },
+	{ 0x1F68, 0x0345, 0x1FA8 },
+	{ 0x1F69, 0x0300, 0x1F6B },
+	{ 0x1F69, 0x0301, 0x1F6D },
+	{ 0x1F69, 0x0342, 0x1F6F },
+	{ 0x1F69, 0x0345, 0x1FA9 },
+	{ 0x1F6A, 0x0345, 0x1FAA },
+	{ 0x1F6B, 0x0345, 0x1FAB },
+	{ 0x1F6C, 0x0345, 0x1FAC },
+	{ 0x1F6D, 0x0345, 0x1FAD },
+	{ 0x1F6E, 0x0345, 0x1FAE },
+	{ 0x1F6F, 0x0345, 0x1FAF },
+	{ 0x1F70, 0x0345, 0x1FB2 },
+	{ 0x1F74, 0x0345, 0x1FC2 },
+	{ 0x1F7C, 0x0345, 0x1FF2 },
+	{ 0x1FB6, 0x0345, 0x1FB7 },
+	{ 0x1FBF, 0x0300, 0x1FCD },
+	{ 0x1FBF, 0x0301, 0x1FCE },
+	{ 0x1FBF, 0x0342, 0x1FCF },
+	{ 0x1FC6, 0x0345, 0x1FC7 },
+	{ 0x1FF6, 0x0345, 0x1FF7 },
+	{ 0x1FFE, 0x0300, 0x1FDD },
+	{ 0x1FFE, 0x0301, 0x1FDE },
+	{ 0x1FFE, 0x0342, 0x1FDF },
+	{ 0x2190, 0x0338, 0x219A },
+	{ 0x2192, 0x0338, 0x219B },
+	{ 0x2194, 0x0338, 0x21AE },
+	{ 0x21D0, 0x0338, 0x21CD },
+	{ 0x21D2, 0x0338, 0x21CF },
+	{ 0x21D4, 0x0338, 0x21CE },
+	{ 0x2203, 0x0338, 0x2204 },
+	{ 0x2208, 0x0338, 0x2209 },
+	{ 0x220B, 0x0338, 0x220C },
+	{ 0x2223, 0x0338, 0x2224 },
+	{ 0x2225, 0x0338, 0x2226 },
+	{ 0x223C, 0x0338, 0x2241 },
+	{ 0x2243, 0x0338, 0x2244 },
+	{ 0x2245, 0x0338, 0x2247 },
+	{ 0x2248, 0x0338, 0x2249 },
+	{ 0x224D, 0x0338, 0x226D },
+	{ 0x2261, 0x0338, 0x2262 },
+	{ 0x2264, 0x0338, 0x2270 },
+	{ 0x2265, 0x0338, 0x2271 },
+	{ 0x2272, 0x0338, 0x2274 },
+	{ 0x2273, 0x0338, 0x2275 },
+	{ 0x2276, 0x0338, 0x2278 },
+	{ 0x2277, 0x0338, 0x2279 },
+	{ 0x227A, 0x0338, 0x2280 },
+	{ 0x227B, 0x0338, 0x2281 },
+	{ 0x227C, 0x0338, 0x22E0 },
+	{ 0x227D, 0x0338, 0x22E1 },
+	{ 0x2282, 0x0338, 0x2284 },
+	{ 0x2283, 0x0338, 0x2285 },
+	{ 0x2286, 0x0338, 0x2288 },
+	{ 0x2287, 0x0338, 0x2289 },
+	{ 0x2291, 0x0338, 0x22E2 },
+	{ 0x2292, 0x0338, 0x22E3 },
+	{ 0x22A2, 0x0338, 0x22AC },
+	{ 0x22A8, 0x0338, 0x22AD },
+	{ 0x22A9, 0x0338, 0x22AE },
+	{ 0x22AB, 0x0338, 0x22AF },
+	{ 0x22B2, 0x0338, 0x22EA },
+	{ 0x22B3, 0x0338, 0x22EB },
+	{ 0x22B4, 0x0338, 0x22EC },
+	{ 0x22B5, 0x0338, 0x22ED },
+	{ 0x3046, 0x3099, 0x3094 },
+	{ 0x304B, 0x3099, 0x304C },
+	{ 0x304D, 0x3099, 0x304E },
+	{ 0x304F, 0x3099, 0x3050 },
+	{ 0x3051, 0x3099, 0x3052 },
+	{ 0x3053, 0x3099, 0x3054 },
+	{ 0x3055, 0x3099, 0x3056 },
+	{ 0x3057, 0x3099, 0x3058 },
+	{ 0x3059, 0x3099, 0x305A },
+	{ 0x305B, 0x3099, 0x305C },
+	{ 0x305D, 0x3099, 0x305E },
+	{ 0x305F, 0x3099, 0x3060 },
+	{ 0x3061, 0x3099, 0x3062 },
+	{ 0x3064, 0x3099, 0x3065 },
+	{ 0x3066, 0x3099, 0x3067 },
+	{ 0x3068, 0x3099, 0x3069 },
+	{ 0x306F, 0x3099, 0x3070 },
+	{ 0x306F, 0x309A, 0x3071 },
+	{ 0x3072, 0x3099, 0x3073 },
+	{ 0x3072, 0x309A, 0x3074 },
+	{ 0x3075, 0x3099, 0x3076 },
+	{ 0x3075, 0x309A, 0x3077 },
+	{ 0x3078, 0x3099, 0x3079 },
+	{ 0x3078, 0x309A, 0x307A },
+	{ 0x307B, 0x3099, 0x307C },
+	{ 0x307B, 0x309A, 0x307D },
+	{ 0x309D, 0x3099, 0x309E },
+	{ 0x30A6, 0x3099, 0x30F4 },
+	{ 0x30AB, 0x3099, 0x30AC },
+	{ 0x30AD, 0x3099, 0x30AE },
+	{ 0x30AF, 0x3099, 0x30B0 },
+	{ 0x30B1, 0x3099, 0x30B2 },
+	{ 0x30B3, 0x3099, 0x30B4 },
+	{ 0x30B5, 0x3099, 0x30B6 },
+	{ 0x30B7, 0x3099, 0x30B8 },
+	{ 0x30B9, 0x3099, 0x30BA },
+	{ 0x30BB, 0x3099, 0x30BC },
+	{ 0x30BD, 0x3099, 0x30BE },
+	{ 0x30BF, 0x3099, 0x30C0 },
+	{ 0x30C1, 0x3099, 0x30C2 },
+	{ 0x30C4, 0x3099, 0x30C5 },
+	{ 0x30C6, 0x3099, 0x30C7 },
+	{ 0x30C8, 0x3099, 0x30C9 },
+	{ 0x30CF, 0x3099, 0x30D0 },
+	{ 0x30CF, 0x309A, 0x30D1 },
+	{ 0x30D2, 0x3099, 0x30D3 },
+	{ 0x30D2, 0x309A, 0x30D4 },
+	{ 0x30D5, 0x3099, 0x30D6 },
+	{ 0x30D5, 0x309A, 0x30D7 },
+	{ 0x30D8, 0x3099, 0x30D9 },
+	{ 0x30D8, 0x309A, 0x30DA },
+	{ 0x30DB, 0x3099, 0x30DC },
+	{ 0x30DB, 0x309A, 0x30DD },
+	{ 0x30EF, 0x3099, 0x30F7 },
+	{ 0x30F0, 0x3099, 0x30F8 },
+	{ 0x30F1, 0x3099, 0x30F9 },
+	{ 0x30F2, 0x3099, 0x30FA },
+	{ 0x30FD, 0x3099, 0x30FE },
+	{ 0x11099, 0x110BA, 0x1109A },
+	{ 0x1109B, 0x110BA, 0x1109C },
+	{ 0x110A5, 0x110BA, 0x110AB },
+	{ 0x11131, 0x11127, 0x1112E },
+	{ 0x11132, 0x11127, 0x1112F },
+	{ 0x11347, 0x1133E, 0x1134B },
+	{ 0x11347, 0x11357, 0x1134C },
+	{ 0x114B9, 0x114B0, 0x114BC },
+	{ 0x114B9, 0x114BA, 0x114BB },
+	{ 0x114B9, 0x114BD, 0x114BE },
+	{ 0x115B8, 0x115AF, 0x115BA },
+	{ 0x115B9, 0x115AF, 0x115BB },
+	{ 0x11935, 0x11930, 0x11938 },
+};
+
+#endif /* UNICODE_TABLES_H */
@@ -15,7 +15,8 @@
 
 extern GPrivate glk_data_key;
 
-static winid_t
+/* Internal function: create a window with a specified rock value */
+winid_t
 window_new_common(glui32 rock)
 {
 	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
@@ -26,6 +27,7 @@ window_new_common(glui32 rock)
 	win->magic = MAGIC_WINDOW;
 	win->rock = rock;
 	win->librock = g_strdup_printf("%p", win);
+	win->updatetag = ++glk_data->last_updatetag;
 	if(glk_data->register_obj)
 		win->disprock = (*glk_data->register_obj)(win, gidisp_Class_Window);
 	
@@ -75,16 +77,21 @@ window_close_common(winid_t win, gboolean destroy_node)
 	g_slist_free(win->current_extra_line_terminators);
 	
 	g_string_free(win->buffer, TRUE);
+	g_clear_pointer(&win->graphics_batch, g_array_unref);
 	g_hash_table_destroy(win->hyperlinks);
 	g_free(win->current_hyperlink);
+	g_free(win->grid_chars);
+	g_free(win->grid_tags);
 
 	if(win->backing_store)
 		cairo_surface_destroy(win->backing_store);
 	g_clear_object(&win->font_override);
 	g_clear_object(&win->background_override);
 
-	if (win->vadjustment)
+	if (win->vadjustment) {
 		g_clear_signal_handler(&win->pager_adjustment_handler, win->vadjustment);
+		g_clear_signal_handler(&win->scrollback_adjustment_handler, win->vadjustment);
+	}
 
 	g_mutex_clear(&win->lock);
 
@@ -695,7 +702,7 @@ glk_window_close(winid_t win, stream_result_t *result)
 
 	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
 
-	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+	ui_message_sync_arrange();
 
 	g_mutex_lock(&glk_data->arrange_lock); /* Prevent redraw while we're trashing the window */
 
@@ -817,7 +824,7 @@ glk_window_clear(winid_t win)
 		case wintype_TextGrid:
 		case wintype_Graphics:
 			/* Wait for the window's size to be updated */
-			ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+			ui_message_sync_arrange();
 			/* fall through */
 		case wintype_TextBuffer:
 			ui_message_queue(ui_message_new(UI_MESSAGE_CLEAR_WINDOW, win));
@@ -956,7 +963,7 @@ glk_window_get_size(winid_t win, glui32 *widthptr, glui32 *heightptr)
         case wintype_TextGrid:
 		case wintype_Graphics:
 			/* Wait until the window's size is current */
-			ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+			ui_message_sync_arrange();
 
 			g_mutex_lock(&win->lock);
             if(widthptr != NULL)
@@ -968,7 +975,7 @@ glk_window_get_size(winid_t win, glui32 *widthptr, glui32 *heightptr)
             
         case wintype_TextBuffer:
 			/* Wait until the window's size is current */
-			ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+			ui_message_sync_arrange();
 
 			g_mutex_lock(&win->lock);
             if(widthptr != NULL)
@@ -1072,7 +1079,7 @@ glk_window_set_arrangement(winid_t win, glui32 method, glui32 size, winid_t keyw
 
 	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
 
-	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+	ui_message_sync_arrange();
 
 	g_mutex_lock(&glk_data->arrange_lock);
 	if(keywin != NULL && !g_node_is_ancestor(win->window_node, keywin->window_node)) {
@@ -1107,7 +1114,7 @@ glk_window_get_arrangement(winid_t win, glui32 *methodptr, glui32 *sizeptr, wini
 
 	ChimaraGlkPrivate *glk_data = g_private_get(&glk_data_key);
 
-	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+	ui_message_sync_arrange();
 
 	g_mutex_lock(&glk_data->arrange_lock);
 	if(methodptr)
@@ -1157,7 +1164,7 @@ glk_window_move_cursor(winid_t win, glui32 xpos, glui32 ypos)
 	g_return_if_fail(win->type == wintype_TextGrid);
 
 	/* Wait until the window's size is current */
-	ui_message_queue_and_await(ui_message_new(UI_MESSAGE_SYNC_ARRANGE, NULL));
+	ui_message_sync_arrange();
 
 	g_mutex_lock(&win->lock);
 
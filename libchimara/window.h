@@ -33,6 +33,7 @@ struct glk_window_struct
 	the window */
 	glui32 magic, rock;
 	char *librock; /* "library rock" - unique string identifier */
+	glui32 updatetag; /* identifies the window in autosave files */
 	gidispatch_rock_t disprock;
 	glui32 type;
 
@@ -40,6 +41,8 @@ struct glk_window_struct
 	/* Streams associated with the window */
 	strid_t window_stream;  /* returned by get_window_stream() */
 	strid_t echo_stream;    /* returned by get_echo_stream() */
+	/* Drawing operations not yet sent to the UI thread (graphics only) */
+	GArray *graphics_batch;  /* element-type: struct graphics_op */
 
 	/* These fields may be accessed by both the Glk thread and the UI thread. Any
 	access must be protected by locking the @lock mutex. */
@@ -95,6 +98,12 @@ struct glk_window_struct
 	GtkTextChildAnchor *input_anchor;
 	GtkWidget *input_entry;
 	gulong line_input_entry_changed;
+	/* Shadow copy of the text grid's contents, one cell per character, so
+	that printing only has to touch the cells that change (text grids only) */
+	gunichar *grid_chars;
+	GtkTextTag **grid_tags;  /* NULL if the cell must be redrawn */
+	glui32 grid_columns;
+	glui32 grid_rows;
 	/* Signal handlers */
 	gulong char_input_keypress_handler;
 	gulong line_input_keypress_handler;
@@ -105,6 +114,7 @@ struct glk_window_struct
 	gulong size_allocate_handler;
 	gulong pager_keypress_handler;
 	gulong pager_adjustment_handler;
+	gulong scrollback_adjustment_handler;
 	/* Window buffer (text buffers and grids only) */
 	GString *buffer;
 	GtkTextTag *zcolor;
@@ -124,4 +134,6 @@ struct glk_window_struct
 	gboolean currently_paging;
 };
 
+G_GNUC_INTERNAL winid_t window_new_common(glui32 rock);
+
 #endif
@@ -376,6 +376,13 @@ on_command(ChimaraIF *glk, const char *input, const char *response, Test *test)
             char *next;
             uint64_t width = g_ascii_strtoull(check->text, &next, 10);
             uint64_t height = g_ascii_strtoull(next, NULL, 10);
+            int headless_height;
+            if (chimara_glk_get_headless_size(CHIMARA_GLK(glk), NULL, &headless_height)) {
+                if (height == 0)
+                    height = headless_height;
+                chimara_glk_set_headless_size(CHIMARA_GLK(glk), width, height);
+                break;
+            }
             GtkWidget *win = gtk_widget_get_toplevel(GTK_WIDGET(glk));
             int current_height;
             gtk_window_get_size(GTK_WINDOW(win), NULL, &current_height);
@@ -428,6 +435,12 @@ on_command(ChimaraIF *glk, const char *input, const char *response, Test *test)
     }
 }
 
+static gboolean headless = FALSE;
+static GOptionEntry option_entries[] = {
+    { "headless", 'H', G_OPTION_FLAG_NONE, G_OPTION_ARG_NONE, &headless, "Run without putting the widget in a window", NULL },
+    { NULL },
+};
+
 int
 main(int argc, char *argv[])
 {
@@ -437,16 +450,31 @@ main(int argc, char *argv[])
 
     gtk_init(&argc, &argv);
 
+    g_autoptr(GOptionContext) options = g_option_context_new("REGTEST");
+    g_option_context_add_main_entries(options, option_entries, NULL);
+    if (!g_option_context_parse(options, &argc, &argv, &error)) {
+        g_print("Bail out! %s\n", error->message);
+        return 77;
+    }
+
     GtkWidget *glk = chimara_if_new();
     chimara_glk_set_interactive(CHIMARA_GLK(glk), FALSE);
     chimara_if_set_preferred_interpreter(CHIMARA_IF(glk), CHIMARA_IF_FORMAT_GLULX, CHIMARA_IF_INTERPRETER_GLULXE);
     chimara_if_set_preferred_interpreter(CHIMARA_IF(glk), CHIMARA_IF_FORMAT_GLULX_BLORB, CHIMARA_IF_INTERPRETER_GLULXE);
     chimara_glk_set_css_from_string(CHIMARA_GLK(glk), "buffer { font-size: 10pt; }");
 
-    GtkWidget *win = gtk_offscreen_window_new();
-    gtk_window_set_default_size(GTK_WINDOW(win), 800, 600);
-    gtk_container_add(GTK_CONTAINER(win), glk);
-    gtk_widget_show_all(win);
+    /* In headless mode, the widget lays out its windows by itself and is never
+     * realized */
+    GtkWidget *win = NULL;
+    if (headless) {
+        g_object_ref_sink(glk);
+        chimara_glk_set_headless_size(CHIMARA_GLK(glk), 800, 600);
+    } else {
+        win = gtk_offscreen_window_new();
+        gtk_window_set_default_size(GTK_WINDOW(win), 800, 600);
+        gtk_container_add(GTK_CONTAINER(win), glk);
+        gtk_widget_show_all(win);
+    }
 
     if(argc < 2) {
         g_print("Bail out! Must provide a regtest specification\n");
@@ -493,7 +521,10 @@ main(int argc, char *argv[])
         }
     }
 
-    gtk_widget_destroy(win);
+    if (win)
+        gtk_widget_destroy(win);
+    else
+        g_object_unref(glk);
 
     return 0;
 }
@@ -0,0 +1,84 @@
+#include <stdio.h>
+
+#include <libchimara/glk.h>
+
+/* Draws a 100x100 map of tiles in a graphics window, once per frame, and
+ * reports the number of frames per second. Each frame ends with glk_select(),
+ * which waits until the UI has drawn everything. Run it with plugin-loader. */
+
+#define MAP_SIZE 100
+#define FRAMES 200
+
+static double
+seconds_since(glktimeval_t *start)
+{
+    glktimeval_t now;
+    glk_current_time(&now);
+    return (double)(now.low_sec - start->low_sec) + (now.microsec - start->microsec) / 1e6;
+}
+
+static void
+draw_map(winid_t win, glui32 tile_size, unsigned frame)
+{
+    for (glui32 y = 0; y < MAP_SIZE; y++) {
+        for (glui32 x = 0; x < MAP_SIZE; x++) {
+            glui32 red = (x * 255 / MAP_SIZE + frame) & 0xff;
+            glui32 green = (y * 255 / MAP_SIZE) & 0xff;
+            glui32 blue = ((x + y) * 4 + frame * 3) & 0xff;
+            glk_window_fill_rect(win, (red << 16) | (green << 8) | blue,
+                x * tile_size, y * tile_size, tile_size, tile_size);
+        }
+    }
+}
+
+void
+glk_main(void)
+{
+    if (!glk_gestalt(gestalt_Graphics, 0) || !glk_gestalt(gestalt_Timer, 0))
+        return;
+
+    winid_t mainwin = glk_window_open(NULL, 0, 0, wintype_TextBuffer, 0);
+    if (!mainwin)
+        return;
+    winid_t graphwin = glk_window_open(mainwin, winmethod_Above | winmethod_Proportional, 80, wintype_Graphics, 0);
+    if (!graphwin)
+        return;
+    glk_set_window(mainwin);
+
+    glui32 width, height;
+    glk_window_get_size(graphwin, &width, &height);
+    glui32 tile_size = width < height ? width / MAP_SIZE : height / MAP_SIZE;
+    if (tile_size == 0)
+        tile_size = 1;
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "Drawing %d frames of %dx%d tiles of %u pixels...\n",
+        FRAMES, MAP_SIZE, MAP_SIZE, tile_size);
+    glk_put_string(buffer);
+
+    event_t ev;
+    glktimeval_t start;
+    glk_current_time(&start);
+    glk_request_timer_events(1);
+
+    for (unsigned frame = 0; frame < FRAMES; frame++) {
+        draw_map(graphwin, tile_size, frame);
+        do
+            glk_select(&ev);
+        while (ev.type != evtype_Timer);
+    }
+
+    glk_request_timer_events(0);
+    double elapsed = seconds_since(&start);
+
+    snprintf(buffer, sizeof(buffer), "%d frames in %.2f s: %.1f frames/sec\n",
+        FRAMES, elapsed, FRAMES / elapsed);
+    glk_put_string(buffer);
+    printf("%s", buffer);
+
+    glk_put_string("Press a key to quit.\n");
+    glk_request_char_event(mainwin);
+    do
+        glk_select(&ev);
+    while (ev.type != evtype_CharInput);
+}
@@ -0,0 +1,106 @@
+#include <stdio.h>
+
+#include <libchimara/glk.h>
+
+/* Copies large buffers through memory streams of the other character width,
+ * which makes the library widen Latin-1 text to UCS-4 and narrow UCS-4 text to
+ * Latin-1, and reports how long each direction takes. Run it with
+ * plugin-loader. */
+
+#define BUFFER_SIZE 4096
+#define ROUNDS 20000
+
+static char latin1[BUFFER_SIZE];
+static glui32 ucs4[BUFFER_SIZE];
+
+static double
+seconds_since(glktimeval_t *start)
+{
+    glktimeval_t now;
+    glk_current_time(&now);
+    return (double)(now.low_sec - start->low_sec) + (now.microsec - start->microsec) / 1e6;
+}
+
+/* Writes Latin-1 text to a Unicode memory stream, and reads it back as
+ * Unicode from a byte memory stream */
+static double
+time_widening(void)
+{
+    glktimeval_t start;
+    strid_t uni = glk_stream_open_memory_uni(ucs4, BUFFER_SIZE, filemode_Write, 0);
+    strid_t bytes = glk_stream_open_memory(latin1, BUFFER_SIZE, filemode_Read, 0);
+
+    glk_current_time(&start);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        glk_stream_set_position(uni, 0, seekmode_Start);
+        glk_put_buffer_stream(uni, latin1, BUFFER_SIZE);
+        glk_stream_set_position(bytes, 0, seekmode_Start);
+        glk_get_buffer_stream_uni(bytes, ucs4, BUFFER_SIZE);
+    }
+    double elapsed = seconds_since(&start);
+
+    glk_stream_close(uni, NULL);
+    glk_stream_close(bytes, NULL);
+    return elapsed;
+}
+
+/* Writes Unicode text to a byte memory stream, and reads it back as Latin-1
+ * from a Unicode memory stream */
+static double
+time_narrowing(void)
+{
+    glktimeval_t start;
+    strid_t bytes = glk_stream_open_memory(latin1, BUFFER_SIZE, filemode_Write, 0);
+    strid_t uni = glk_stream_open_memory_uni(ucs4, BUFFER_SIZE, filemode_Read, 0);
+
+    glk_current_time(&start);
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        glk_stream_set_position(bytes, 0, seekmode_Start);
+        glk_put_buffer_stream_uni(bytes, ucs4, BUFFER_SIZE);
+        glk_stream_set_position(uni, 0, seekmode_Start);
+        glk_get_buffer_stream(uni, latin1, BUFFER_SIZE);
+    }
+    double elapsed = seconds_since(&start);
+
+    glk_stream_close(bytes, NULL);
+    glk_stream_close(uni, NULL);
+    return elapsed;
+}
+
+void
+glk_main(void)
+{
+    if (!glk_gestalt(gestalt_Unicode, 0) || !glk_gestalt(gestalt_Timer, 0))
+        return;
+
+    winid_t mainwin = glk_window_open(NULL, 0, 0, wintype_TextBuffer, 0);
+    if (!mainwin)
+        return;
+    glk_set_window(mainwin);
+
+    for (unsigned ix = 0; ix < BUFFER_SIZE; ix++) {
+        latin1[ix] = 0x20 + ix % 0xdf;
+        ucs4[ix] = 0x20 + ix % 0xdf;
+    }
+
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer), "Copying %d buffers of %d characters each way...\n",
+        ROUNDS, BUFFER_SIZE);
+    glk_put_string(buffer);
+
+    double widening = time_widening();
+    double narrowing = time_narrowing();
+
+    snprintf(buffer, sizeof(buffer), "Widening: %.2f s, %.1f MB/s\nNarrowing: %.2f s, %.1f MB/s\n",
+        widening, 2.0 * ROUNDS * BUFFER_SIZE / widening / 1e6,
+        narrowing, 2.0 * ROUNDS * BUFFER_SIZE / narrowing / 1e6);
+    glk_put_string(buffer);
+    printf("%s", buffer);
+
+    glk_put_string("Press a key to quit.\n");
+    glk_request_char_event(mainwin);
+    event_t ev;
+    do
+        glk_select(&ev);
+    while (ev.type != evtype_CharInput);
+}
@@ -0,0 +1,59 @@
+#include <glib.h>
+#include <gtk/gtk.h>
+
+#include <libchimara/chimara-glk.h>
+
+static GtkWidget *glk;
+
+static void
+assert_histogram(GVariant *metrics, const char *key)
+{
+    g_autoptr(GVariant) histogram = g_variant_lookup_value(metrics, key, G_VARIANT_TYPE_VARDICT);
+    g_assert_nonnull(histogram);
+
+    guint64 count, sum;
+    g_assert_true(g_variant_lookup(histogram, "count", "t", &count));
+    g_assert_true(g_variant_lookup(histogram, "sum", "t", &sum));
+    g_autoptr(GVariant) buckets = g_variant_lookup_value(histogram, "buckets", G_VARIANT_TYPE("at"));
+    g_assert_nonnull(buckets);
+    g_assert_cmpuint(g_variant_n_children(histogram), ==, 3);
+}
+
+static void
+test_metrics_keys(void)
+{
+    g_autoptr(GVariant) metrics = g_variant_ref_sink(chimara_glk_get_metrics(CHIMARA_GLK(glk)));
+    g_assert_nonnull(metrics);
+    g_assert_true(g_variant_is_of_type(metrics, G_VARIANT_TYPE_VARDICT));
+
+    g_autoptr(GVariant) messages = g_variant_lookup_value(metrics, "ui-messages", G_VARIANT_TYPE("a{su}"));
+    g_assert_nonnull(messages);
+
+    assert_histogram(metrics, "ui-round-trip-usec");
+    assert_histogram(metrics, "flush-bytes");
+    assert_histogram(metrics, "select-wait-usec");
+
+    static const char *counters[] = {
+        "ui-messages-pending", "events-pending", "events-dropped",
+        "image-cache-hits", "image-cache-misses", "blorb-chunk-loads",
+    };
+    for (size_t ix = 0; ix < G_N_ELEMENTS(counters); ix++) {
+        guint32 value;
+        g_assert_true(g_variant_lookup(metrics, counters[ix], "u", &value));
+        g_assert_cmpuint(value, ==, 0);
+    }
+
+    g_assert_cmpuint(g_variant_n_children(metrics), ==, 4 + G_N_ELEMENTS(counters));
+}
+
+int
+main(int argc, char *argv[])
+{
+    gtk_test_init(&argc, &argv);
+
+    glk = chimara_glk_new();
+
+    g_test_add_func("/metrics/keys", test_metrics_keys);
+
+    return g_test_run();
+}
@@ -0,0 +1,138 @@
+#include <stdint.h>
+
+#include <gtk/gtk.h>
+#include <libchimara/chimara-glk.h>
+#include <libchimara/chimara-if.h>
+
+/* Times N consecutive short sessions of the same game. Each session starts the
+ * game, lets it run until it first waits for input, and stops it again. Outside
+ * of the timed part, it also checks that every session printed something, then
+ * types a command and checks that the game responds to it, so that a plugin
+ * which does not survive being reset is caught.
+ *
+ * Usage: plugin-reload-benchmark [-n SESSIONS] [-p] [-c COMMAND] GAMEFILE
+ *
+ * With -p, the widget's persistent-plugin mode is turned on, so that the
+ * interpreter plugin is reset instead of reloaded between sessions, if it
+ * supports that. Compare the timings with and without -p. */
+
+typedef struct {
+    gboolean stopped;
+    int responses;
+} Session;
+
+static void
+on_waiting(ChimaraGlk *glk)
+{
+    gtk_main_quit();
+}
+
+static void
+on_stopped(ChimaraGlk *glk, Session *session)
+{
+    session->stopped = TRUE;
+    gtk_main_quit();
+}
+
+static void
+on_command(ChimaraIF *glk, const char *input, const char *response, Session *session)
+{
+    if (response && *response)
+        session->responses++;
+}
+
+int
+main(int argc, char *argv[])
+{
+    g_autoptr(GError) error = NULL;
+    int sessions = 20;
+    gboolean persistent = FALSE;
+    g_autofree char *command = NULL;
+    g_auto(GStrv) games = NULL;
+
+    GOptionEntry entries[] = {
+        { "sessions", 'n', 0, G_OPTION_ARG_INT, &sessions, "Number of sessions to run (default: 20)", "SESSIONS" },
+        { "persistent", 'p', 0, G_OPTION_ARG_NONE, &persistent, "Keep the interpreter plugin loaded between sessions", NULL },
+        { "command", 'c', 0, G_OPTION_ARG_STRING, &command, "Command to type in each session (default: look)", "COMMAND" },
+        { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &games, NULL, "GAMEFILE" },
+        { NULL }
+    };
+    g_autoptr(GOptionContext) context = g_option_context_new("- time consecutive short game sessions");
+    g_option_context_add_main_entries(context, entries, NULL);
+    g_option_context_add_group(context, gtk_get_option_group(TRUE));
+    if (!g_option_context_parse(context, &argc, &argv, &error)) {
+        g_printerr("%s\n", error->message);
+        return 2;
+    }
+    if (!games || !games[0] || sessions < 1) {
+        g_printerr("Must provide a game file and a positive number of sessions\n");
+        return 2;
+    }
+    if (!command)
+        command = g_strdup("look");
+
+    GtkWidget *glk = chimara_if_new();
+    chimara_glk_set_interactive(CHIMARA_GLK(glk), FALSE);
+    chimara_glk_set_persistent_plugin(CHIMARA_GLK(glk), persistent);
+    Session session;
+    g_signal_connect(glk, "waiting", G_CALLBACK(on_waiting), NULL);
+    g_signal_connect(glk, "stopped", G_CALLBACK(on_stopped), &session);
+    g_signal_connect(glk, "command", G_CALLBACK(on_command), &session);
+
+    GtkWidget *win = gtk_offscreen_window_new();
+    gtk_window_set_default_size(GTK_WINDOW(win), 800, 600);
+    gtk_container_add(GTK_CONTAINER(win), glk);
+    gtk_widget_show_all(win);
+
+    g_autofree double *times = g_new0(double, sessions);
+    for (int ix = 0; ix < sessions; ix++) {
+        session.stopped = FALSE;
+        session.responses = 0;
+        int64_t start = g_get_monotonic_time();
+
+        if (!chimara_if_run_game(CHIMARA_IF(glk), games[0], &error)) {
+            g_printerr("Error starting game: %s\n", error->message);
+            return 1;
+        }
+        gtk_main();
+        int64_t waiting = g_get_monotonic_time();
+
+        if (session.stopped || session.responses == 0) {
+            g_printerr("session %d: game stopped or printed nothing before waiting for input\n", ix + 1);
+            return 1;
+        }
+        if (chimara_glk_is_line_input_pending(CHIMARA_GLK(glk)))
+            chimara_glk_feed_line_input(CHIMARA_GLK(glk), command);
+        else if (chimara_glk_is_char_input_pending(CHIMARA_GLK(glk)))
+            chimara_glk_feed_char_input(CHIMARA_GLK(glk), GDK_KEY_space);
+        else {
+            g_printerr("session %d: game is not waiting for line or character input\n", ix + 1);
+            return 1;
+        }
+        gtk_main();
+        if (session.stopped || session.responses < 2) {
+            g_printerr("session %d: game did not respond to input\n", ix + 1);
+            return 1;
+        }
+
+        int64_t stop = g_get_monotonic_time();
+        chimara_glk_stop(CHIMARA_GLK(glk));
+        chimara_glk_wait(CHIMARA_GLK(glk));
+
+        times[ix] = ((waiting - start) + (g_get_monotonic_time() - stop)) / 1000.0;
+        g_print("session %d: %.2f ms\n", ix + 1, times[ix]);
+    }
+
+    double min = times[0], max = times[0], total = 0.0;
+    for (int ix = 0; ix < sessions; ix++) {
+        min = MIN(min, times[ix]);
+        max = MAX(max, times[ix]);
+        total += times[ix];
+    }
+    g_print("%d sessions (%s): mean %.2f ms, min %.2f ms, max %.2f ms\n",
+        sessions, persistent ? "persistent plugin" : "plugin reloaded",
+        total / sessions, min, max);
+
+    gtk_widget_destroy(win);
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+
+#include "glk.h"
+#include "glkstart.h"
+#include "glkunit.h"
+
+#define STATE_FILE "autosave-state.glkdata"
+#define DATA_FILE "autosave-data.glkdata"
+
+/* Save the library state to a file, read it back, and replace all the
+ * objects with the ones from the file */
+static int
+save_and_restore(void)
+{
+    frefid_t ref = glk_fileref_create_by_name(fileusage_Data | fileusage_BinaryMode, STATE_FILE, 0);
+    ASSERT_NONNULL(ref, "Fileref creation should succeed");
+
+    strid_t file = glk_stream_open_file(ref, filemode_Write, 0);
+    ASSERT_NONNULL(file, "Opening the state file for writing should succeed");
+    ASSERT_EQUAL(1, glkunix_save_library_state(file, file, NULL, NULL));
+    glk_stream_close(file, NULL);
+
+    file = glk_stream_open_file(ref, filemode_Read, 0);
+    ASSERT_NONNULL(file, "Opening the state file for reading should succeed");
+    glkunix_library_state_t state = glkunix_load_library_state(file, NULL, NULL);
+    glk_stream_close(file, NULL);
+    ASSERT_NONNULL(state, "Loading the library state should succeed");
+
+    /* The state file's own fileref is part of the state, so it comes back too */
+    glui32 ref_tag = glkunix_fileref_get_updatetag(ref);
+    glui32 success = glkunix_update_from_library_state(state);
+    glkunix_library_state_free(state);
+    ASSERT_EQUAL(1, success);
+    ASSERT_EQUAL(0xFFFFFFFE, glkunix_get_last_event_type());
+
+    ref = glkunix_fileref_find_by_updatetag(ref_tag);
+    ASSERT_NONNULL(ref, "The state file's fileref should be restored");
+    glk_fileref_delete_file(ref);
+    glk_fileref_destroy(ref);
+
+    SUCCEED;
+}
+
+static int
+test_autosave_round_trips_windows(void)
+{
+    winid_t root = glk_window_open(0, 0, 0, wintype_TextBuffer, 10);
+    ASSERT_NONNULL(root, "Opening the root window should succeed");
+    winid_t grid = glk_window_open(root, winmethod_Above | winmethod_Fixed, 3, wintype_TextGrid, 11);
+    ASSERT_NONNULL(grid, "Opening the grid window should succeed");
+    glk_stream_set_current(glk_window_get_stream(root));
+
+    glui32 root_tag = glkunix_window_get_updatetag(root);
+    glui32 grid_tag = glkunix_window_get_updatetag(grid);
+    ASSERT_NOT_EQUAL(root_tag, grid_tag);
+
+    if (!save_and_restore())
+        return 0;
+
+    root = glkunix_window_find_by_updatetag(root_tag);
+    grid = glkunix_window_find_by_updatetag(grid_tag);
+    ASSERT_NONNULL(root, "The root window should be restored");
+    ASSERT_NONNULL(grid, "The grid window should be restored");
+    ASSERT_SAME(glk_window_get_root(), glk_window_get_parent(grid));
+    ASSERT_EQUAL(wintype_TextBuffer, glk_window_get_type(root));
+    ASSERT_EQUAL(wintype_TextGrid, glk_window_get_type(grid));
+    ASSERT_EQUAL(10, glk_window_get_rock(root));
+    ASSERT_EQUAL(11, glk_window_get_rock(grid));
+    ASSERT_SAME(glk_window_get_stream(root), glk_stream_get_current());
+
+    glui32 method, size;
+    glk_window_get_arrangement(glk_window_get_parent(grid), &method, &size, NULL);
+    ASSERT_EQUAL(winmethod_Above | winmethod_Fixed, method & (winmethod_DirMask | winmethod_DivisionMask));
+    ASSERT_EQUAL(3, size);
+
+    glk_window_close(glk_window_get_root(), NULL);
+
+    SUCCEED;
+}
+
+static int
+test_autosave_round_trips_filerefs_and_streams(void)
+{
+    frefid_t ref = glk_fileref_create_by_name(fileusage_Data | fileusage_BinaryMode, DATA_FILE, 20);
+    ASSERT_NONNULL(ref, "Fileref creation should succeed");
+    strid_t file = glk_stream_open_file(ref, filemode_Write, 21);
+    ASSERT_NONNULL(file, "Opening the data file should succeed");
+    glk_put_string_stream(file, "hello");
+    strid_t resource = glk_stream_open_resource(3, 22);
+    ASSERT_NONNULL(resource, "Opening the resource stream should succeed");
+    glk_stream_set_position(resource, 4, seekmode_Start);
+
+    glui32 ref_tag = glkunix_fileref_get_updatetag(ref);
+    glui32 file_tag = glkunix_stream_get_updatetag(file);
+    glui32 resource_tag = glkunix_stream_get_updatetag(resource);
+
+    if (!save_and_restore())
+        return 0;
+
+    ref = glkunix_fileref_find_by_updatetag(ref_tag);
+    file = glkunix_stream_find_by_updatetag(file_tag);
+    resource = glkunix_stream_find_by_updatetag(resource_tag);
+    ASSERT_NONNULL(ref, "The fileref should be restored");
+    ASSERT_NONNULL(file, "The file stream should be restored");
+    ASSERT_NONNULL(resource, "The resource stream should be restored");
+    ASSERT_EQUAL(20, glk_fileref_get_rock(ref));
+    ASSERT_EQUAL(21, glk_stream_get_rock(file));
+    ASSERT_EQUAL(22, glk_stream_get_rock(resource));
+    ASSERT_EQUAL(5, glk_stream_get_position(file));
+    ASSERT_EQUAL(4, glk_stream_get_position(resource));
+
+    /* The restored streams carry on from where they were */
+    glk_put_string_stream(file, " world");
+    glk_stream_close(file, NULL);
+    char buf[12];
+    file = glk_stream_open_file(ref, filemode_Read, 0);
+    ASSERT_NONNULL(file, "Reopening the data file should succeed");
+    ASSERT_EQUAL(11, glk_get_buffer_stream(file, buf, sizeof(buf)));
+    glk_stream_close(file, NULL);
+
+    glk_stream_close(resource, NULL);
+    glk_fileref_delete_file(ref);
+    glk_fileref_destroy(ref);
+
+    SUCCEED;
+}
+
+struct TestDescription tests[] = {
+    { "autosave restores windows, their arrangement and the current stream",
+        test_autosave_round_trips_windows },
+    { "autosave restores filerefs, and file and resource streams with their positions",
+        test_autosave_round_trips_filerefs_and_streams },
+    { NULL, NULL }
+};
@@ -0,0 +1,122 @@
+#include <string.h>
+
+#include "glk.h"
+#include "glkunit.h"
+
+#define ASSERT_BUFFER(expected, actual, count) \
+    _ASSERT(memcmp((expected), (actual), (count) * sizeof(glui32)) == 0, \
+        "%s matches %s", #actual, #expected)
+
+static int
+test_lower_case_ascii_and_latin1(void)
+{
+    glui32 buf[] = { 'H', 'e', 'L', 'L', 'o', 0xC9, 0xDE, '1' };
+    glui32 expected[] = { 'h', 'e', 'l', 'l', 'o', 0xE9, 0xFE, '1' };
+
+    ASSERT_EQUAL(8, glk_buffer_to_lower_case_uni(buf, 8, 8));
+    ASSERT_BUFFER(expected, buf, 8);
+
+    SUCCEED;
+}
+
+static int
+test_upper_case_expands_in_place(void)
+{
+    /* "straße" - the sharp s becomes two characters in upper case */
+    glui32 buf[8] = { 's', 't', 'r', 'a', 0xDF, 'e' };
+    glui32 expected[] = { 'S', 'T', 'R', 'A', 'S', 'S', 'E' };
+
+    ASSERT_EQUAL(7, glk_buffer_to_upper_case_uni(buf, 8, 6));
+    ASSERT_BUFFER(expected, buf, 7);
+
+    SUCCEED;
+}
+
+static int
+test_upper_case_truncates_but_counts(void)
+{
+    /* "ŉ" (N preceded by apostrophe) and "ﬃ" both expand */
+    glui32 buf[3] = { 0x149, 0xFB03, 'x' };
+    glui32 expected[] = { 0x2BC, 'N', 'F' };
+
+    ASSERT_EQUAL(6, glk_buffer_to_upper_case_uni(buf, 3, 3));
+    ASSERT_BUFFER(expected, buf, 3);
+
+    SUCCEED;
+}
+
+static int
+test_title_case_expands_first_character(void)
+{
+    glui32 buf[6] = { 0xFB03, 'X', 'E', 'D' };
+    glui32 lowered[] = { 'F', 'f', 'i', 'x', 'e', 'd' };
+    glui32 unchanged[] = { 'F', 'f', 'i', 'X', 'E', 'D' };
+
+    ASSERT_EQUAL(6, glk_buffer_to_title_case_uni(buf, 6, 4, 1));
+    ASSERT_BUFFER(lowered, buf, 6);
+
+    buf[0] = 0xFB03;
+    buf[1] = 'X';
+    buf[2] = 'E';
+    buf[3] = 'D';
+    ASSERT_EQUAL(6, glk_buffer_to_title_case_uni(buf, 6, 4, 0));
+    ASSERT_BUFFER(unchanged, buf, 6);
+
+    SUCCEED;
+}
+
+static int
+test_decompose_reorders_combining_characters(void)
+{
+    /* "ệ" followed by a combining dot below that should come before the
+     * circumflex; and a Hangul syllable */
+    glui32 buf[8] = { 0x1EC7, 0xAC01 };
+    glui32 expected[] = { 'e', 0x323, 0x302, 0x1100, 0x1161, 0x11A8 };
+
+    ASSERT_EQUAL(6, glk_buffer_canon_decompose_uni(buf, 8, 2));
+    ASSERT_BUFFER(expected, buf, 6);
+
+    SUCCEED;
+}
+
+static int
+test_normalize_composes(void)
+{
+    glui32 buf[] = { 'e', 0x302, 0x323, 0x1100, 0x1161, 0x11A8, 'a' };
+    glui32 expected[] = { 0x1EC7, 0xAC01, 'a' };
+
+    ASSERT_EQUAL(3, glk_buffer_canon_normalize_uni(buf, 7, 7));
+    ASSERT_BUFFER(expected, buf, 3);
+
+    SUCCEED;
+}
+
+static int
+test_normalize_full_buffer_whose_decomposition_does_not_fit(void)
+{
+    glui32 buf[] = { 0xE9, 0x1EC7, 0xC5 };
+    glui32 expected[] = { 0xE9, 0x1EC7, 0xC5 };
+
+    ASSERT_EQUAL(3, glk_buffer_canon_normalize_uni(buf, 3, 3));
+    ASSERT_BUFFER(expected, buf, 3);
+
+    SUCCEED;
+}
+
+struct TestDescription tests[] = {
+    { "glk_buffer_to_lower_case_uni() converts ASCII and Latin-1",
+        test_lower_case_ascii_and_latin1 },
+    { "glk_buffer_to_upper_case_uni() expands characters in place",
+        test_upper_case_expands_in_place },
+    { "glk_buffer_to_upper_case_uni() truncates at the buffer length",
+        test_upper_case_truncates_but_counts },
+    { "glk_buffer_to_title_case_uni() expands the first character",
+        test_title_case_expands_first_character },
+    { "glk_buffer_canon_decompose_uni() reorders combining characters",
+        test_decompose_reorders_combining_characters },
+    { "glk_buffer_canon_normalize_uni() composes characters",
+        test_normalize_composes },
+    { "glk_buffer_canon_normalize_uni() works when the decomposition overflows",
+        test_normalize_full_buffer_whose_decomposition_does_not_fit },
+    { NULL, NULL }
+};
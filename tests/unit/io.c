@@ -453,6 +453,38 @@ test_glk_put_buffer_stream_uni_writes_utf8_to_unicode_text_file(void)
     SUCCEED;
 }
 
+static int
+test_read_write_file_stream_reads_back_buffered_output(void)
+{
+    frefid_t ref = glk_fileref_create_temp(fileusage_BinaryMode | fileusage_Data, 0);
+    ASSERT_NONNULL(ref, "temp fileref should succeed");
+
+    strid_t stream = glk_stream_open_file(ref, filemode_ReadWrite, 0);
+    ASSERT_NONNULL(stream, "read-write stream should succeed");
+
+    /* Write more than one block, so some of it goes to the writer thread */
+    int i;
+    for (i = 0; i < 10000; i++)
+        glk_put_char_stream(stream, 'a' + i % 26);
+    ASSERT_EQUAL(10000, glk_stream_get_position(stream));
+
+    glk_stream_set_position(stream, 9998, seekmode_Start);
+    ASSERT_EQUAL('a' + 9998 % 26, glk_get_char_stream(stream));
+
+    /* Switch back to writing, and then reading without seeking in between */
+    glk_put_char_stream(stream, 'X');
+    glk_stream_set_position(stream, -1, seekmode_End);
+    ASSERT_EQUAL('X', glk_get_char_stream(stream));
+    ASSERT_EQUAL(-1, glk_get_char_stream(stream));
+
+    glk_stream_close(stream, /* counts = */ NULL);
+
+    glk_fileref_delete_file(ref);
+    glk_fileref_destroy(ref);
+
+    SUCCEED;
+}
+
 struct TestDescription tests[] = {
     { "glk_put_char() writes UTF-8 to a Unicode text file",
         test_glk_put_char_writes_utf8_to_unicode_text_file },
@@ -478,5 +510,7 @@ struct TestDescription tests[] = {
         test_glk_put_buffer_uni_writes_utf8_to_unicode_text_file },
     { "glk_put_buffer_stream_uni() writes UTF-8 to a Unicode text file",
         test_glk_put_buffer_stream_uni_writes_utf8_to_unicode_text_file },
+    { "a read-write file stream reads back its buffered output",
+        test_read_write_file_stream_reads_back_buffered_output },
     { NULL, NULL }
 };
@@ -0,0 +1,78 @@
+#include "config.h"
+
+#include "glk.h"
+#include "glkunit.h"
+#include "schannel.h"
+
+#define SILENCE 3
+
+/* glk_schannel_play_multi() pins the pipeline's base time to start the sounds
+ * together; afterwards the channel must go back to keeping its own running
+ * time, or the next sound is played against the old base time */
+#if HAVE_SOUND
+#define ASSERT_OWN_RUNNING_TIME(chan) \
+    ASSERT(gst_element_get_start_time((chan)->pipeline) != GST_CLOCK_TIME_NONE)
+#else
+#define ASSERT_OWN_RUNNING_TIME(chan)
+#endif
+
+static int
+test_play_ext_after_play_multi_and_stop(void)
+{
+    if (!glk_gestalt(gestalt_Sound2, 0))
+        SUCCEED;
+
+    schanid_t chan = glk_schannel_create(0);
+    ASSERT_NONNULL(chan, "Creating the sound channel should succeed");
+    glui32 snd = SILENCE;
+
+    ASSERT_EQUAL(1, glk_schannel_play_multi(&chan, 1, &snd, 1, 0));
+    glk_schannel_stop(chan);
+    ASSERT_OWN_RUNNING_TIME(chan);
+
+    ASSERT_EQUAL(1, glk_schannel_play_ext(chan, SILENCE, 1, 0));
+    ASSERT_OWN_RUNNING_TIME(chan);
+
+    glk_schannel_destroy(chan);
+
+    SUCCEED;
+}
+
+static int
+test_play_ext_after_play_multi_finishes(void)
+{
+    if (!glk_gestalt(gestalt_Sound2, 0))
+        SUCCEED;
+
+    schanid_t chan = glk_schannel_create(0);
+    ASSERT_NONNULL(chan, "Creating the sound channel should succeed");
+    glui32 snd = SILENCE;
+
+    ASSERT_EQUAL(1, glk_schannel_play_multi(&chan, 1, &snd, 1, 1));
+    event_t event;
+    do
+        glk_select(&event);
+    while (event.type != evtype_SoundNotify);
+    ASSERT_EQUAL(SILENCE, event.val1);
+    ASSERT_EQUAL(1, event.val2);
+    ASSERT_OWN_RUNNING_TIME(chan);
+
+    ASSERT_EQUAL(1, glk_schannel_play_ext(chan, SILENCE, 1, 2));
+    ASSERT_OWN_RUNNING_TIME(chan);
+    do
+        glk_select(&event);
+    while (event.type != evtype_SoundNotify);
+    ASSERT_EQUAL(2, event.val2);
+
+    glk_schannel_destroy(chan);
+
+    SUCCEED;
+}
+
+struct TestDescription tests[] = {
+    { "glk_schannel_play_ext() after glk_schannel_play_multi() and glk_schannel_stop() keeps its own running time",
+        test_play_ext_after_play_multi_and_stop },
+    { "glk_schannel_play_ext() after a glk_schannel_play_multi() sound finishes keeps its own running time",
+        test_play_ext_after_play_multi_finishes },
+    { NULL, NULL }
+};
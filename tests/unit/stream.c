@@ -114,6 +114,132 @@ test_glk_stream_open_resource_uni_reads_form_chunk_including_header(void)
     SUCCEED;
 }
 
+static int
+test_glk_put_buffer_stream_widens_into_unicode_memory_stream(void)
+{
+    char text[40];
+    for (int i = 0; i < 40; i++)
+        text[i] = (char)(0x70 + i); /* crosses 0x80 */
+    glui32 buf[32];
+    memset(buf, 0, sizeof(buf));
+
+    strid_t stream = glk_stream_open_memory_uni(buf, 32, filemode_Write, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+    glk_put_buffer_stream(stream, text, 40);
+
+    stream_result_t counts;
+    glk_stream_close(stream, &counts);
+    ASSERT_EQUAL(counts.writecount, 40);
+    for (int i = 0; i < 32; i++)
+        ASSERT_EQUAL(buf[i], (glui32)(0x70 + i));
+
+    SUCCEED;
+}
+
+static int
+test_glk_put_buffer_stream_uni_narrows_into_memory_stream(void)
+{
+    glui32 text[20];
+    for (int i = 0; i < 20; i++)
+        text[i] = (i % 2)? 0xE0 + i : 0x100 + i;
+    char buf[20];
+
+    strid_t stream = glk_stream_open_memory(buf, 20, filemode_Write, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+    glk_put_buffer_stream_uni(stream, text, 20);
+    glk_stream_close(stream, NULL);
+
+    for (int i = 0; i < 20; i++)
+        ASSERT_EQUAL((unsigned char)buf[i], (i % 2)? 0xE0 + i : '?');
+
+    SUCCEED;
+}
+
+static int
+test_glk_get_buffer_stream_uni_widens_from_memory_stream(void)
+{
+    char buf[20];
+    for (int i = 0; i < 20; i++)
+        buf[i] = (char)(0xF0 + i);
+
+    strid_t stream = glk_stream_open_memory(buf, 20, filemode_Read, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+
+    glui32 text[24];
+    glui32 read = glk_get_buffer_stream_uni(stream, text, 24);
+    ASSERT_EQUAL(read, 20);
+    for (int i = 0; i < 20; i++)
+        ASSERT_EQUAL(text[i], (glui32)(unsigned char)(0xF0 + i));
+
+    glk_stream_close(stream, NULL);
+
+    SUCCEED;
+}
+
+static int
+test_glk_get_buffer_stream_narrows_from_unicode_memory_stream(void)
+{
+    glui32 buf[20];
+    for (int i = 0; i < 20; i++)
+        buf[i] = (i % 3)? 0x41 + i : 0x2014;
+
+    strid_t stream = glk_stream_open_memory_uni(buf, 20, filemode_Read, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+
+    char text[24];
+    glui32 read = glk_get_buffer_stream(stream, text, 24);
+    ASSERT_EQUAL(read, 20);
+    for (int i = 0; i < 20; i++)
+        ASSERT_EQUAL(text[i], (i % 3)? 0x41 + i : '?');
+
+    glk_stream_close(stream, NULL);
+
+    SUCCEED;
+}
+
+static int
+test_memory_stream_seek_past_end_does_not_overrun_buffer(void)
+{
+    /* Only the first half of each buffer belongs to the stream; the rest
+     * must not be touched */
+    char buf[16];
+    glui32 ubuf[16];
+    memset(buf, 'x', sizeof(buf));
+    for (int i = 0; i < 16; i++)
+        ubuf[i] = 'x';
+    char text[4] = { 'a', 'b', 'c', 'd' };
+    glui32 utext[4] = { 'a', 'b', 'c', 'd' };
+    char readbuf[4];
+    glui32 ureadbuf[4];
+
+    strid_t stream = glk_stream_open_memory(buf, 8, filemode_ReadWrite, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+    glk_stream_set_position(stream, 12, seekmode_Start);
+    glk_put_buffer_stream(stream, text, 4);
+    glk_put_buffer_stream_uni(stream, utext, 4);
+    ASSERT_EQUAL(glk_get_buffer_stream(stream, readbuf, 4), 0);
+    ASSERT_EQUAL(glk_get_buffer_stream_uni(stream, ureadbuf, 4), 0);
+    ASSERT_EQUAL(glk_get_line_stream(stream, readbuf, 4), 0);
+    glk_stream_close(stream, NULL);
+
+    stream = glk_stream_open_memory_uni(ubuf, 8, filemode_ReadWrite, 0);
+    ASSERT_NONNULL(stream, "Opening memory stream should succeed");
+    glk_stream_set_position(stream, 12, seekmode_Start);
+    glk_put_buffer_stream(stream, text, 4);
+    glk_put_buffer_stream_uni(stream, utext, 4);
+    ASSERT_EQUAL(glk_get_buffer_stream(stream, readbuf, 4), 0);
+    ASSERT_EQUAL(glk_get_buffer_stream_uni(stream, ureadbuf, 4), 0);
+    ASSERT_EQUAL(glk_get_line_stream_uni(stream, ureadbuf, 4), 0);
+    glk_stream_close(stream, NULL);
+
+    for (int i = 0; i < 16; i++) {
+        ASSERT_EQUAL(buf[i], 'x');
+        ASSERT_EQUAL(ubuf[i], 'x');
+    }
+
+    SUCCEED;
+}
+
 struct TestDescription tests[] = {
     { "glk_stream_open_file() returns NULL for a nonexistent file in read mode",
         test_glk_stream_open_file_nonexistent },
@@ -127,5 +253,15 @@ struct TestDescription tests[] = {
         test_glk_stream_open_resource_reads_form_chunk_including_header },
     { "glk_stream_open_resource_uni() reads a FORM chunk including header",
         test_glk_stream_open_resource_uni_reads_form_chunk_including_header },
+    { "glk_put_buffer_stream() widens Latin-1 into a Unicode memory stream",
+        test_glk_put_buffer_stream_widens_into_unicode_memory_stream },
+    { "glk_put_buffer_stream_uni() narrows Unicode into a byte memory stream",
+        test_glk_put_buffer_stream_uni_narrows_into_memory_stream },
+    { "glk_get_buffer_stream_uni() widens Latin-1 from a byte memory stream",
+        test_glk_get_buffer_stream_uni_widens_from_memory_stream },
+    { "glk_get_buffer_stream() narrows Unicode from a Unicode memory stream",
+        test_glk_get_buffer_stream_narrows_from_unicode_memory_stream },
+    { "Reading and writing a memory stream after seeking past its end stays inside the buffer",
+        test_memory_stream_seek_past_end_does_not_overrun_buffer },
     { NULL, NULL }
 };